@@ -169,6 +169,14 @@ uint32_t TAccountService_authenticate_user_result::read(::apache::thrift::protoc
           xfer += iprot->skip(ftype);
         }
         break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -199,6 +207,10 @@ uint32_t TAccountService_authenticate_user_result::write(::apache::thrift::proto
     xfer += oprot->writeFieldBegin("e2", ::apache::thrift::protocol::T_STRUCT, 2);
     xfer += this->e2.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 3);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -255,6 +267,14 @@ uint32_t TAccountService_authenticate_user_presult::read(::apache::thrift::proto
           xfer += iprot->skip(ftype);
         }
         break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -460,6 +480,14 @@ uint32_t TAccountService_create_account_result::read(::apache::thrift::protocol:
           xfer += iprot->skip(ftype);
         }
         break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -490,6 +518,10 @@ uint32_t TAccountService_create_account_result::write(::apache::thrift::protocol
     xfer += oprot->writeFieldBegin("e2", ::apache::thrift::protocol::T_STRUCT, 2);
     xfer += this->e2.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 3);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -546,6 +578,14 @@ uint32_t TAccountService_create_account_presult::read(::apache::thrift::protocol
           xfer += iprot->skip(ftype);
         }
         break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -695,6 +735,14 @@ uint32_t TAccountService_retrieve_standard_account_result::read(::apache::thrift
           xfer += iprot->skip(ftype);
         }
         break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -721,6 +769,10 @@ uint32_t TAccountService_retrieve_standard_account_result::write(::apache::thrif
     xfer += oprot->writeFieldBegin("e", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->e.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 2);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -769,6 +821,304 @@ uint32_t TAccountService_retrieve_standard_account_presult::read(::apache::thrif
           xfer += iprot->skip(ftype);
         }
         break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
+TAccountService_retrieve_standard_accounts_args::~TAccountService_retrieve_standard_accounts_args() noexcept {
+}
+
+
+uint32_t TAccountService_retrieve_standard_accounts_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->request_metadata.read(iprot);
+          this->__isset.request_metadata = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->account_ids.clear();
+            uint32_t _size58;
+            ::apache::thrift::protocol::TType _etype61;
+            xfer += iprot->readListBegin(_etype61, _size58);
+            this->account_ids.resize(_size58);
+            uint32_t _i62;
+            for (_i62 = 0; _i62 < _size58; ++_i62)
+            {
+              xfer += iprot->readI32(this->account_ids[_i62]);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.account_ids = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t TAccountService_retrieve_standard_accounts_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("TAccountService_retrieve_standard_accounts_args");
+
+  xfer += oprot->writeFieldBegin("request_metadata", ::apache::thrift::protocol::T_STRUCT, 1);
+  xfer += this->request_metadata.write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("account_ids", ::apache::thrift::protocol::T_LIST, 2);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I32, static_cast<uint32_t>(this->account_ids.size()));
+    std::vector<int32_t> ::const_iterator _iter63;
+    for (_iter63 = this->account_ids.begin(); _iter63 != this->account_ids.end(); ++_iter63)
+    {
+      xfer += oprot->writeI32((*_iter63));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+TAccountService_retrieve_standard_accounts_pargs::~TAccountService_retrieve_standard_accounts_pargs() noexcept {
+}
+
+
+uint32_t TAccountService_retrieve_standard_accounts_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("TAccountService_retrieve_standard_accounts_pargs");
+
+  xfer += oprot->writeFieldBegin("request_metadata", ::apache::thrift::protocol::T_STRUCT, 1);
+  xfer += (*(this->request_metadata)).write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("account_ids", ::apache::thrift::protocol::T_LIST, 2);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I32, static_cast<uint32_t>((*(this->account_ids)).size()));
+    std::vector<int32_t> ::const_iterator _iter64;
+    for (_iter64 = (*(this->account_ids)).begin(); _iter64 != (*(this->account_ids)).end(); ++_iter64)
+    {
+      xfer += oprot->writeI32((*_iter64));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+TAccountService_retrieve_standard_accounts_result::~TAccountService_retrieve_standard_accounts_result() noexcept {
+}
+
+
+uint32_t TAccountService_retrieve_standard_accounts_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_MAP) {
+          {
+            this->success.clear();
+            uint32_t _size65;
+            ::apache::thrift::protocol::TType _ktype66;
+            ::apache::thrift::protocol::TType _vtype67;
+            xfer += iprot->readMapBegin(_ktype66, _vtype67, _size65);
+            uint32_t _i69;
+            for (_i69 = 0; _i69 < _size65; ++_i69)
+            {
+              int32_t _key70;
+              xfer += iprot->readI32(_key70);
+              TAccount& _val71 = this->success[_key70];
+              xfer += _val71.read(iprot);
+            }
+            xfer += iprot->readMapEnd();
+          }
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t TAccountService_retrieve_standard_accounts_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("TAccountService_retrieve_standard_accounts_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_MAP, 0);
+    {
+      xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_I32, ::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->success.size()));
+      std::map<int32_t, TAccount> ::const_iterator _iter72;
+      for (_iter72 = this->success.begin(); _iter72 != this->success.end(); ++_iter72)
+      {
+        xfer += oprot->writeI32(_iter72->first);
+        xfer += _iter72->second.write(oprot);
+      }
+      xfer += oprot->writeMapEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+TAccountService_retrieve_standard_accounts_presult::~TAccountService_retrieve_standard_accounts_presult() noexcept {
+}
+
+
+uint32_t TAccountService_retrieve_standard_accounts_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_MAP) {
+          {
+            (*(this->success)).clear();
+            uint32_t _size73;
+            ::apache::thrift::protocol::TType _ktype74;
+            ::apache::thrift::protocol::TType _vtype75;
+            xfer += iprot->readMapBegin(_ktype74, _vtype75, _size73);
+            uint32_t _i77;
+            for (_i77 = 0; _i77 < _size73; ++_i77)
+            {
+              int32_t _key78;
+              xfer += iprot->readI32(_key78);
+              TAccount& _val79 = (*(this->success))[_key78];
+              xfer += _val79.read(iprot);
+            }
+            xfer += iprot->readMapEnd();
+          }
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -918,6 +1268,14 @@ uint32_t TAccountService_retrieve_expanded_account_result::read(::apache::thrift
           xfer += iprot->skip(ftype);
         }
         break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -944,6 +1302,10 @@ uint32_t TAccountService_retrieve_expanded_account_result::write(::apache::thrif
     xfer += oprot->writeFieldBegin("e", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->e.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 2);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -992,6 +1354,14 @@ uint32_t TAccountService_retrieve_expanded_account_presult::read(::apache::thrif
           xfer += iprot->skip(ftype);
         }
         break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1205,6 +1575,14 @@ uint32_t TAccountService_update_account_result::read(::apache::thrift::protocol:
           xfer += iprot->skip(ftype);
         }
         break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1239,6 +1617,10 @@ uint32_t TAccountService_update_account_result::write(::apache::thrift::protocol
     xfer += oprot->writeFieldBegin("e3", ::apache::thrift::protocol::T_STRUCT, 3);
     xfer += this->e3.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 4);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -1303,6 +1685,14 @@ uint32_t TAccountService_update_account_presult::read(::apache::thrift::protocol
           xfer += iprot->skip(ftype);
         }
         break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1452,6 +1842,14 @@ uint32_t TAccountService_delete_account_result::read(::apache::thrift::protocol:
           xfer += iprot->skip(ftype);
         }
         break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1478,6 +1876,10 @@ uint32_t TAccountService_delete_account_result::write(::apache::thrift::protocol
     xfer += oprot->writeFieldBegin("e2", ::apache::thrift::protocol::T_STRUCT, 2);
     xfer += this->e2.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 3);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -1526,6 +1928,14 @@ uint32_t TAccountService_delete_account_presult::read(::apache::thrift::protocol
           xfer += iprot->skip(ftype);
         }
         break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1601,6 +2011,9 @@ void TAccountServiceClient::recv_authenticate_user(TAccount& _return)
   if (result.__isset.e2) {
     throw result.e2;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "authenticate_user failed: unknown result");
 }
 
@@ -1669,6 +2082,9 @@ void TAccountServiceClient::recv_create_account(TAccount& _return)
   if (result.__isset.e2) {
     throw result.e2;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "create_account failed: unknown result");
 }
 
@@ -1731,9 +2147,74 @@ void TAccountServiceClient::recv_retrieve_standard_account(TAccount& _return)
   if (result.__isset.e) {
     throw result.e;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "retrieve_standard_account failed: unknown result");
 }
 
+void TAccountServiceClient::retrieve_standard_accounts(std::map<int32_t, TAccount> & _return, const TRequestMetadata& request_metadata, const std::vector<int32_t> & account_ids)
+{
+  send_retrieve_standard_accounts(request_metadata, account_ids);
+  recv_retrieve_standard_accounts(_return);
+}
+
+void TAccountServiceClient::send_retrieve_standard_accounts(const TRequestMetadata& request_metadata, const std::vector<int32_t> & account_ids)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("retrieve_standard_accounts", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  TAccountService_retrieve_standard_accounts_pargs args;
+  args.request_metadata = &request_metadata;
+  args.account_ids = &account_ids;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void TAccountServiceClient::recv_retrieve_standard_accounts(std::map<int32_t, TAccount> & _return)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("retrieve_standard_accounts") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  TAccountService_retrieve_standard_accounts_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
+  }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "retrieve_standard_accounts failed: unknown result");
+}
+
 void TAccountServiceClient::retrieve_expanded_account(TAccount& _return, const TRequestMetadata& request_metadata, const int32_t account_id)
 {
   send_retrieve_expanded_account(request_metadata, account_id);
@@ -1793,6 +2274,9 @@ void TAccountServiceClient::recv_retrieve_expanded_account(TAccount& _return)
   if (result.__isset.e) {
     throw result.e;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "retrieve_expanded_account failed: unknown result");
 }
 
@@ -1864,6 +2348,9 @@ void TAccountServiceClient::recv_update_account(TAccount& _return)
   if (result.__isset.e3) {
     throw result.e3;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "update_account failed: unknown result");
 }
 
@@ -1924,6 +2411,9 @@ void TAccountServiceClient::recv_delete_account()
   if (result.__isset.e2) {
     throw result.e2;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   return;
 }
 
@@ -1977,6 +2467,9 @@ void TAccountServiceProcessor::process_authenticate_user(int32_t seqid, ::apache
   } catch (TAccountDeactivatedException &e2) {
     result.e2 = e2;
     result.__isset.e2 = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TAccountService.authenticate_user");
@@ -2037,6 +2530,9 @@ void TAccountServiceProcessor::process_create_account(int32_t seqid, ::apache::t
   } catch (TAccountUsernameAlreadyExistsException &e2) {
     result.e2 = e2;
     result.__isset.e2 = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TAccountService.create_account");
@@ -2094,6 +2590,9 @@ void TAccountServiceProcessor::process_retrieve_standard_account(int32_t seqid,
   } catch (TAccountNotFoundException &e) {
     result.e = e;
     result.__isset.e = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TAccountService.retrieve_standard_account");
@@ -2123,6 +2622,63 @@ void TAccountServiceProcessor::process_retrieve_standard_account(int32_t seqid,
   }
 }
 
+void TAccountServiceProcessor::process_retrieve_standard_accounts(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("TAccountService.retrieve_standard_accounts", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "TAccountService.retrieve_standard_accounts");
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "TAccountService.retrieve_standard_accounts");
+  }
+
+  TAccountService_retrieve_standard_accounts_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "TAccountService.retrieve_standard_accounts", bytes);
+  }
+
+  TAccountService_retrieve_standard_accounts_result result;
+  try {
+    iface_->retrieve_standard_accounts(result.success, args.request_metadata, args.account_ids);
+    result.__isset.success = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "TAccountService.retrieve_standard_accounts");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("retrieve_standard_accounts", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "TAccountService.retrieve_standard_accounts");
+  }
+
+  oprot->writeMessageBegin("retrieve_standard_accounts", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "TAccountService.retrieve_standard_accounts", bytes);
+  }
+}
+
 void TAccountServiceProcessor::process_retrieve_expanded_account(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
@@ -2151,6 +2707,9 @@ void TAccountServiceProcessor::process_retrieve_expanded_account(int32_t seqid,
   } catch (TAccountNotFoundException &e) {
     result.e = e;
     result.__isset.e = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TAccountService.retrieve_expanded_account");
@@ -2214,6 +2773,9 @@ void TAccountServiceProcessor::process_update_account(int32_t seqid, ::apache::t
   } catch (TAccountNotFoundException &e3) {
     result.e3 = e3;
     result.__isset.e3 = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TAccountService.update_account");
@@ -2273,6 +2835,9 @@ void TAccountServiceProcessor::process_delete_account(int32_t seqid, ::apache::t
   } catch (TAccountNotFoundException &e2) {
     result.e2 = e2;
     result.__isset.e2 = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TAccountService.delete_account");
@@ -2392,6 +2957,10 @@ void TAccountServiceConcurrentClient::recv_authenticate_user(TAccount& _return,
         sentry.commit();
         throw result.e2;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       // in a bad state, don't commit
       throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "authenticate_user failed: unknown result");
     }
@@ -2488,6 +3057,10 @@ void TAccountServiceConcurrentClient::recv_create_account(TAccount& _return, con
         sentry.commit();
         throw result.e2;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       // in a bad state, don't commit
       throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "create_account failed: unknown result");
     }
@@ -2577,6 +3150,10 @@ void TAccountServiceConcurrentClient::recv_retrieve_standard_account(TAccount& _
         sentry.commit();
         throw result.e;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       // in a bad state, don't commit
       throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "retrieve_standard_account failed: unknown result");
     }
@@ -2588,6 +3165,95 @@ void TAccountServiceConcurrentClient::recv_retrieve_standard_account(TAccount& _
   } // end while(true)
 }
 
+void TAccountServiceConcurrentClient::retrieve_standard_accounts(std::map<int32_t, TAccount> & _return, const TRequestMetadata& request_metadata, const std::vector<int32_t> & account_ids)
+{
+  int32_t seqid = send_retrieve_standard_accounts(request_metadata, account_ids);
+  recv_retrieve_standard_accounts(_return, seqid);
+}
+
+int32_t TAccountServiceConcurrentClient::send_retrieve_standard_accounts(const TRequestMetadata& request_metadata, const std::vector<int32_t> & account_ids)
+{
+  int32_t cseqid = this->sync_->generateSeqId();
+  ::apache::thrift::async::TConcurrentSendSentry sentry(this->sync_.get());
+  oprot_->writeMessageBegin("retrieve_standard_accounts", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  TAccountService_retrieve_standard_accounts_pargs args;
+  args.request_metadata = &request_metadata;
+  args.account_ids = &account_ids;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+
+  sentry.commit();
+  return cseqid;
+}
+
+void TAccountServiceConcurrentClient::recv_retrieve_standard_accounts(std::map<int32_t, TAccount> & _return, const int32_t seqid)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  // the read mutex gets dropped and reacquired as part of waitForWork()
+  // The destructor of this sentry wakes up other clients
+  ::apache::thrift::async::TConcurrentRecvSentry sentry(this->sync_.get(), seqid);
+
+  while(true) {
+    if(!this->sync_->getPending(fname, mtype, rseqid)) {
+      iprot_->readMessageBegin(fname, mtype, rseqid);
+    }
+    if(seqid == rseqid) {
+      if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+        ::apache::thrift::TApplicationException x;
+        x.read(iprot_);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+        sentry.commit();
+        throw x;
+      }
+      if (mtype != ::apache::thrift::protocol::T_REPLY) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+      }
+      if (fname.compare("retrieve_standard_accounts") != 0) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+
+        // in a bad state, don't commit
+        using ::apache::thrift::protocol::TProtocolException;
+        throw TProtocolException(TProtocolException::INVALID_DATA);
+      }
+      TAccountService_retrieve_standard_accounts_presult result;
+      result.success = &_return;
+      result.read(iprot_);
+      iprot_->readMessageEnd();
+      iprot_->getTransport()->readEnd();
+
+      if (result.__isset.success) {
+        // _return pointer has now been filled
+        sentry.commit();
+        return;
+      }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
+      // in a bad state, don't commit
+      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "retrieve_standard_accounts failed: unknown result");
+    }
+    // seqid != rseqid
+    this->sync_->updatePending(fname, mtype, rseqid);
+
+    // this will temporarily unlock the readMutex, and let other clients get work done
+    this->sync_->waitForWork(seqid);
+  } // end while(true)
+}
+
 void TAccountServiceConcurrentClient::retrieve_expanded_account(TAccount& _return, const TRequestMetadata& request_metadata, const int32_t account_id)
 {
   int32_t seqid = send_retrieve_expanded_account(request_metadata, account_id);
@@ -2666,6 +3332,10 @@ void TAccountServiceConcurrentClient::recv_retrieve_expanded_account(TAccount& _
         sentry.commit();
         throw result.e;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       // in a bad state, don't commit
       throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "retrieve_expanded_account failed: unknown result");
     }
@@ -2766,6 +3436,10 @@ void TAccountServiceConcurrentClient::recv_update_account(TAccount& _return, con
         sentry.commit();
         throw result.e3;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       // in a bad state, don't commit
       throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "update_account failed: unknown result");
     }
@@ -2853,6 +3527,10 @@ void TAccountServiceConcurrentClient::recv_delete_account(const int32_t seqid)
         sentry.commit();
         throw result.e2;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       sentry.commit();
       return;
     }
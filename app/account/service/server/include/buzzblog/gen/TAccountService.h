@@ -25,6 +25,7 @@ class TAccountServiceIf {
   virtual void authenticate_user(TAccount& _return, const TRequestMetadata& request_metadata, const std::string& username, const std::string& password) = 0;
   virtual void create_account(TAccount& _return, const TRequestMetadata& request_metadata, const std::string& username, const std::string& password, const std::string& first_name, const std::string& last_name) = 0;
   virtual void retrieve_standard_account(TAccount& _return, const TRequestMetadata& request_metadata, const int32_t account_id) = 0;
+  virtual void retrieve_standard_accounts(std::map<int32_t, TAccount> & _return, const TRequestMetadata& request_metadata, const std::vector<int32_t> & account_ids) = 0;
   virtual void retrieve_expanded_account(TAccount& _return, const TRequestMetadata& request_metadata, const int32_t account_id) = 0;
   virtual void update_account(TAccount& _return, const TRequestMetadata& request_metadata, const int32_t account_id, const std::string& password, const std::string& first_name, const std::string& last_name) = 0;
   virtual void delete_account(const TRequestMetadata& request_metadata, const int32_t account_id) = 0;
@@ -66,6 +67,9 @@ class TAccountServiceNull : virtual public TAccountServiceIf {
   void retrieve_standard_account(TAccount& /* _return */, const TRequestMetadata& /* request_metadata */, const int32_t /* account_id */) {
     return;
   }
+  void retrieve_standard_accounts(std::map<int32_t, TAccount> & /* _return */, const TRequestMetadata& /* request_metadata */, const std::vector<int32_t> & /* account_ids */) {
+    return;
+  }
   void retrieve_expanded_account(TAccount& /* _return */, const TRequestMetadata& /* request_metadata */, const int32_t /* account_id */) {
     return;
   }
@@ -141,10 +145,11 @@ class TAccountService_authenticate_user_pargs {
 };
 
 typedef struct _TAccountService_authenticate_user_result__isset {
-  _TAccountService_authenticate_user_result__isset() : success(false), e1(false), e2(false) {}
+  _TAccountService_authenticate_user_result__isset() : success(false), e1(false), e2(false), overloaded(false) {}
   bool success :1;
   bool e1 :1;
   bool e2 :1;
+  bool overloaded :1;
 } _TAccountService_authenticate_user_result__isset;
 
 class TAccountService_authenticate_user_result {
@@ -159,6 +164,7 @@ class TAccountService_authenticate_user_result {
   TAccount success;
   TAccountInvalidCredentialsException e1;
   TAccountDeactivatedException e2;
+  TServerOverloadedException overloaded;
 
   _TAccountService_authenticate_user_result__isset __isset;
 
@@ -168,6 +174,8 @@ class TAccountService_authenticate_user_result {
 
   void __set_e2(const TAccountDeactivatedException& val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TAccountService_authenticate_user_result & rhs) const
   {
     if (!(success == rhs.success))
@@ -176,6 +184,8 @@ class TAccountService_authenticate_user_result {
       return false;
     if (!(e2 == rhs.e2))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TAccountService_authenticate_user_result &rhs) const {
@@ -190,10 +200,11 @@ class TAccountService_authenticate_user_result {
 };
 
 typedef struct _TAccountService_authenticate_user_presult__isset {
-  _TAccountService_authenticate_user_presult__isset() : success(false), e1(false), e2(false) {}
+  _TAccountService_authenticate_user_presult__isset() : success(false), e1(false), e2(false), overloaded(false) {}
   bool success :1;
   bool e1 :1;
   bool e2 :1;
+  bool overloaded :1;
 } _TAccountService_authenticate_user_presult__isset;
 
 class TAccountService_authenticate_user_presult {
@@ -204,6 +215,7 @@ class TAccountService_authenticate_user_presult {
   TAccount* success;
   TAccountInvalidCredentialsException e1;
   TAccountDeactivatedException e2;
+  TServerOverloadedException overloaded;
 
   _TAccountService_authenticate_user_presult__isset __isset;
 
@@ -289,10 +301,11 @@ class TAccountService_create_account_pargs {
 };
 
 typedef struct _TAccountService_create_account_result__isset {
-  _TAccountService_create_account_result__isset() : success(false), e1(false), e2(false) {}
+  _TAccountService_create_account_result__isset() : success(false), e1(false), e2(false), overloaded(false) {}
   bool success :1;
   bool e1 :1;
   bool e2 :1;
+  bool overloaded :1;
 } _TAccountService_create_account_result__isset;
 
 class TAccountService_create_account_result {
@@ -307,6 +320,7 @@ class TAccountService_create_account_result {
   TAccount success;
   TAccountInvalidAttributesException e1;
   TAccountUsernameAlreadyExistsException e2;
+  TServerOverloadedException overloaded;
 
   _TAccountService_create_account_result__isset __isset;
 
@@ -316,6 +330,8 @@ class TAccountService_create_account_result {
 
   void __set_e2(const TAccountUsernameAlreadyExistsException& val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TAccountService_create_account_result & rhs) const
   {
     if (!(success == rhs.success))
@@ -324,6 +340,8 @@ class TAccountService_create_account_result {
       return false;
     if (!(e2 == rhs.e2))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TAccountService_create_account_result &rhs) const {
@@ -338,10 +356,11 @@ class TAccountService_create_account_result {
 };
 
 typedef struct _TAccountService_create_account_presult__isset {
-  _TAccountService_create_account_presult__isset() : success(false), e1(false), e2(false) {}
+  _TAccountService_create_account_presult__isset() : success(false), e1(false), e2(false), overloaded(false) {}
   bool success :1;
   bool e1 :1;
   bool e2 :1;
+  bool overloaded :1;
 } _TAccountService_create_account_presult__isset;
 
 class TAccountService_create_account_presult {
@@ -352,6 +371,7 @@ class TAccountService_create_account_presult {
   TAccount* success;
   TAccountInvalidAttributesException e1;
   TAccountUsernameAlreadyExistsException e2;
+  TServerOverloadedException overloaded;
 
   _TAccountService_create_account_presult__isset __isset;
 
@@ -416,9 +436,10 @@ class TAccountService_retrieve_standard_account_pargs {
 };
 
 typedef struct _TAccountService_retrieve_standard_account_result__isset {
-  _TAccountService_retrieve_standard_account_result__isset() : success(false), e(false) {}
+  _TAccountService_retrieve_standard_account_result__isset() : success(false), e(false), overloaded(false) {}
   bool success :1;
   bool e :1;
+  bool overloaded :1;
 } _TAccountService_retrieve_standard_account_result__isset;
 
 class TAccountService_retrieve_standard_account_result {
@@ -432,6 +453,7 @@ class TAccountService_retrieve_standard_account_result {
   virtual ~TAccountService_retrieve_standard_account_result() noexcept;
   TAccount success;
   TAccountNotFoundException e;
+  TServerOverloadedException overloaded;
 
   _TAccountService_retrieve_standard_account_result__isset __isset;
 
@@ -439,12 +461,16 @@ class TAccountService_retrieve_standard_account_result {
 
   void __set_e(const TAccountNotFoundException& val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TAccountService_retrieve_standard_account_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
     if (!(e == rhs.e))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TAccountService_retrieve_standard_account_result &rhs) const {
@@ -459,9 +485,10 @@ class TAccountService_retrieve_standard_account_result {
 };
 
 typedef struct _TAccountService_retrieve_standard_account_presult__isset {
-  _TAccountService_retrieve_standard_account_presult__isset() : success(false), e(false) {}
+  _TAccountService_retrieve_standard_account_presult__isset() : success(false), e(false), overloaded(false) {}
   bool success :1;
   bool e :1;
+  bool overloaded :1;
 } _TAccountService_retrieve_standard_account_presult__isset;
 
 class TAccountService_retrieve_standard_account_presult {
@@ -471,6 +498,7 @@ class TAccountService_retrieve_standard_account_presult {
   virtual ~TAccountService_retrieve_standard_account_presult() noexcept;
   TAccount* success;
   TAccountNotFoundException e;
+  TServerOverloadedException overloaded;
 
   _TAccountService_retrieve_standard_account_presult__isset __isset;
 
@@ -478,6 +506,125 @@ class TAccountService_retrieve_standard_account_presult {
 
 };
 
+typedef struct _TAccountService_retrieve_standard_accounts_args__isset {
+  _TAccountService_retrieve_standard_accounts_args__isset() : request_metadata(false), account_ids(false) {}
+  bool request_metadata :1;
+  bool account_ids :1;
+} _TAccountService_retrieve_standard_accounts_args__isset;
+
+class TAccountService_retrieve_standard_accounts_args {
+ public:
+
+  TAccountService_retrieve_standard_accounts_args(const TAccountService_retrieve_standard_accounts_args&);
+  TAccountService_retrieve_standard_accounts_args& operator=(const TAccountService_retrieve_standard_accounts_args&);
+  TAccountService_retrieve_standard_accounts_args() {
+  }
+
+  virtual ~TAccountService_retrieve_standard_accounts_args() noexcept;
+  TRequestMetadata request_metadata;
+  std::vector<int32_t>  account_ids;
+
+  _TAccountService_retrieve_standard_accounts_args__isset __isset;
+
+  void __set_request_metadata(const TRequestMetadata& val);
+
+  void __set_account_ids(const std::vector<int32_t> & val);
+
+  bool operator == (const TAccountService_retrieve_standard_accounts_args & rhs) const
+  {
+    if (!(request_metadata == rhs.request_metadata))
+      return false;
+    if (!(account_ids == rhs.account_ids))
+      return false;
+    return true;
+  }
+  bool operator != (const TAccountService_retrieve_standard_accounts_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const TAccountService_retrieve_standard_accounts_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class TAccountService_retrieve_standard_accounts_pargs {
+ public:
+
+
+  virtual ~TAccountService_retrieve_standard_accounts_pargs() noexcept;
+  const TRequestMetadata* request_metadata;
+  const std::vector<int32_t> * account_ids;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _TAccountService_retrieve_standard_accounts_result__isset {
+  _TAccountService_retrieve_standard_accounts_result__isset() : success(false), overloaded(false) {}
+  bool success :1;
+  bool overloaded :1;
+} _TAccountService_retrieve_standard_accounts_result__isset;
+
+class TAccountService_retrieve_standard_accounts_result {
+ public:
+
+  TAccountService_retrieve_standard_accounts_result(const TAccountService_retrieve_standard_accounts_result&);
+  TAccountService_retrieve_standard_accounts_result& operator=(const TAccountService_retrieve_standard_accounts_result&);
+  TAccountService_retrieve_standard_accounts_result() {
+  }
+
+  virtual ~TAccountService_retrieve_standard_accounts_result() noexcept;
+  std::map<int32_t, TAccount>  success;
+  TServerOverloadedException overloaded;
+
+  _TAccountService_retrieve_standard_accounts_result__isset __isset;
+
+  void __set_success(const std::map<int32_t, TAccount> & val);
+
+  void __set_overloaded(const TServerOverloadedException& val);
+
+  bool operator == (const TAccountService_retrieve_standard_accounts_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
+    return true;
+  }
+  bool operator != (const TAccountService_retrieve_standard_accounts_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const TAccountService_retrieve_standard_accounts_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _TAccountService_retrieve_standard_accounts_presult__isset {
+  _TAccountService_retrieve_standard_accounts_presult__isset() : success(false), overloaded(false) {}
+  bool success :1;
+  bool overloaded :1;
+} _TAccountService_retrieve_standard_accounts_presult__isset;
+
+class TAccountService_retrieve_standard_accounts_presult {
+ public:
+
+
+  virtual ~TAccountService_retrieve_standard_accounts_presult() noexcept;
+  std::map<int32_t, TAccount> * success;
+  TServerOverloadedException overloaded;
+
+  _TAccountService_retrieve_standard_accounts_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
 typedef struct _TAccountService_retrieve_expanded_account_args__isset {
   _TAccountService_retrieve_expanded_account_args__isset() : request_metadata(false), account_id(false) {}
   bool request_metadata :1;
@@ -535,9 +682,10 @@ class TAccountService_retrieve_expanded_account_pargs {
 };
 
 typedef struct _TAccountService_retrieve_expanded_account_result__isset {
-  _TAccountService_retrieve_expanded_account_result__isset() : success(false), e(false) {}
+  _TAccountService_retrieve_expanded_account_result__isset() : success(false), e(false), overloaded(false) {}
   bool success :1;
   bool e :1;
+  bool overloaded :1;
 } _TAccountService_retrieve_expanded_account_result__isset;
 
 class TAccountService_retrieve_expanded_account_result {
@@ -551,6 +699,7 @@ class TAccountService_retrieve_expanded_account_result {
   virtual ~TAccountService_retrieve_expanded_account_result() noexcept;
   TAccount success;
   TAccountNotFoundException e;
+  TServerOverloadedException overloaded;
 
   _TAccountService_retrieve_expanded_account_result__isset __isset;
 
@@ -558,12 +707,16 @@ class TAccountService_retrieve_expanded_account_result {
 
   void __set_e(const TAccountNotFoundException& val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TAccountService_retrieve_expanded_account_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
     if (!(e == rhs.e))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TAccountService_retrieve_expanded_account_result &rhs) const {
@@ -578,9 +731,10 @@ class TAccountService_retrieve_expanded_account_result {
 };
 
 typedef struct _TAccountService_retrieve_expanded_account_presult__isset {
-  _TAccountService_retrieve_expanded_account_presult__isset() : success(false), e(false) {}
+  _TAccountService_retrieve_expanded_account_presult__isset() : success(false), e(false), overloaded(false) {}
   bool success :1;
   bool e :1;
+  bool overloaded :1;
 } _TAccountService_retrieve_expanded_account_presult__isset;
 
 class TAccountService_retrieve_expanded_account_presult {
@@ -590,6 +744,7 @@ class TAccountService_retrieve_expanded_account_presult {
   virtual ~TAccountService_retrieve_expanded_account_presult() noexcept;
   TAccount* success;
   TAccountNotFoundException e;
+  TServerOverloadedException overloaded;
 
   _TAccountService_retrieve_expanded_account_presult__isset __isset;
 
@@ -675,11 +830,12 @@ class TAccountService_update_account_pargs {
 };
 
 typedef struct _TAccountService_update_account_result__isset {
-  _TAccountService_update_account_result__isset() : success(false), e1(false), e2(false), e3(false) {}
+  _TAccountService_update_account_result__isset() : success(false), e1(false), e2(false), e3(false), overloaded(false) {}
   bool success :1;
   bool e1 :1;
   bool e2 :1;
   bool e3 :1;
+  bool overloaded :1;
 } _TAccountService_update_account_result__isset;
 
 class TAccountService_update_account_result {
@@ -695,6 +851,7 @@ class TAccountService_update_account_result {
   TAccountNotAuthorizedException e1;
   TAccountInvalidAttributesException e2;
   TAccountNotFoundException e3;
+  TServerOverloadedException overloaded;
 
   _TAccountService_update_account_result__isset __isset;
 
@@ -706,6 +863,8 @@ class TAccountService_update_account_result {
 
   void __set_e3(const TAccountNotFoundException& val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TAccountService_update_account_result & rhs) const
   {
     if (!(success == rhs.success))
@@ -716,6 +875,8 @@ class TAccountService_update_account_result {
       return false;
     if (!(e3 == rhs.e3))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TAccountService_update_account_result &rhs) const {
@@ -730,11 +891,12 @@ class TAccountService_update_account_result {
 };
 
 typedef struct _TAccountService_update_account_presult__isset {
-  _TAccountService_update_account_presult__isset() : success(false), e1(false), e2(false), e3(false) {}
+  _TAccountService_update_account_presult__isset() : success(false), e1(false), e2(false), e3(false), overloaded(false) {}
   bool success :1;
   bool e1 :1;
   bool e2 :1;
   bool e3 :1;
+  bool overloaded :1;
 } _TAccountService_update_account_presult__isset;
 
 class TAccountService_update_account_presult {
@@ -746,6 +908,7 @@ class TAccountService_update_account_presult {
   TAccountNotAuthorizedException e1;
   TAccountInvalidAttributesException e2;
   TAccountNotFoundException e3;
+  TServerOverloadedException overloaded;
 
   _TAccountService_update_account_presult__isset __isset;
 
@@ -810,9 +973,10 @@ class TAccountService_delete_account_pargs {
 };
 
 typedef struct _TAccountService_delete_account_result__isset {
-  _TAccountService_delete_account_result__isset() : e1(false), e2(false) {}
+  _TAccountService_delete_account_result__isset() : e1(false), e2(false), overloaded(false) {}
   bool e1 :1;
   bool e2 :1;
+  bool overloaded :1;
 } _TAccountService_delete_account_result__isset;
 
 class TAccountService_delete_account_result {
@@ -826,6 +990,7 @@ class TAccountService_delete_account_result {
   virtual ~TAccountService_delete_account_result() noexcept;
   TAccountNotAuthorizedException e1;
   TAccountNotFoundException e2;
+  TServerOverloadedException overloaded;
 
   _TAccountService_delete_account_result__isset __isset;
 
@@ -833,12 +998,16 @@ class TAccountService_delete_account_result {
 
   void __set_e2(const TAccountNotFoundException& val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TAccountService_delete_account_result & rhs) const
   {
     if (!(e1 == rhs.e1))
       return false;
     if (!(e2 == rhs.e2))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TAccountService_delete_account_result &rhs) const {
@@ -853,9 +1022,10 @@ class TAccountService_delete_account_result {
 };
 
 typedef struct _TAccountService_delete_account_presult__isset {
-  _TAccountService_delete_account_presult__isset() : e1(false), e2(false) {}
+  _TAccountService_delete_account_presult__isset() : e1(false), e2(false), overloaded(false) {}
   bool e1 :1;
   bool e2 :1;
+  bool overloaded :1;
 } _TAccountService_delete_account_presult__isset;
 
 class TAccountService_delete_account_presult {
@@ -865,6 +1035,7 @@ class TAccountService_delete_account_presult {
   virtual ~TAccountService_delete_account_presult() noexcept;
   TAccountNotAuthorizedException e1;
   TAccountNotFoundException e2;
+  TServerOverloadedException overloaded;
 
   _TAccountService_delete_account_presult__isset __isset;
 
@@ -906,6 +1077,9 @@ class TAccountServiceClient : virtual public TAccountServiceIf {
   void retrieve_standard_account(TAccount& _return, const TRequestMetadata& request_metadata, const int32_t account_id);
   void send_retrieve_standard_account(const TRequestMetadata& request_metadata, const int32_t account_id);
   void recv_retrieve_standard_account(TAccount& _return);
+  void retrieve_standard_accounts(std::map<int32_t, TAccount> & _return, const TRequestMetadata& request_metadata, const std::vector<int32_t> & account_ids);
+  void send_retrieve_standard_accounts(const TRequestMetadata& request_metadata, const std::vector<int32_t> & account_ids);
+  void recv_retrieve_standard_accounts(std::map<int32_t, TAccount> & _return);
   void retrieve_expanded_account(TAccount& _return, const TRequestMetadata& request_metadata, const int32_t account_id);
   void send_retrieve_expanded_account(const TRequestMetadata& request_metadata, const int32_t account_id);
   void recv_retrieve_expanded_account(TAccount& _return);
@@ -933,6 +1107,7 @@ class TAccountServiceProcessor : public ::apache::thrift::TDispatchProcessor {
   void process_authenticate_user(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_create_account(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_retrieve_standard_account(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_retrieve_standard_accounts(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_retrieve_expanded_account(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_update_account(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_delete_account(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
@@ -942,6 +1117,7 @@ class TAccountServiceProcessor : public ::apache::thrift::TDispatchProcessor {
     processMap_["authenticate_user"] = &TAccountServiceProcessor::process_authenticate_user;
     processMap_["create_account"] = &TAccountServiceProcessor::process_create_account;
     processMap_["retrieve_standard_account"] = &TAccountServiceProcessor::process_retrieve_standard_account;
+    processMap_["retrieve_standard_accounts"] = &TAccountServiceProcessor::process_retrieve_standard_accounts;
     processMap_["retrieve_expanded_account"] = &TAccountServiceProcessor::process_retrieve_expanded_account;
     processMap_["update_account"] = &TAccountServiceProcessor::process_update_account;
     processMap_["delete_account"] = &TAccountServiceProcessor::process_delete_account;
@@ -1003,6 +1179,16 @@ class TAccountServiceMultiface : virtual public TAccountServiceIf {
     return;
   }
 
+  void retrieve_standard_accounts(std::map<int32_t, TAccount> & _return, const TRequestMetadata& request_metadata, const std::vector<int32_t> & account_ids) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->retrieve_standard_accounts(_return, request_metadata, account_ids);
+    }
+    ifaces_[i]->retrieve_standard_accounts(_return, request_metadata, account_ids);
+    return;
+  }
+
   void retrieve_expanded_account(TAccount& _return, const TRequestMetadata& request_metadata, const int32_t account_id) {
     size_t sz = ifaces_.size();
     size_t i = 0;
@@ -1073,6 +1259,9 @@ class TAccountServiceConcurrentClient : virtual public TAccountServiceIf {
   void retrieve_standard_account(TAccount& _return, const TRequestMetadata& request_metadata, const int32_t account_id);
   int32_t send_retrieve_standard_account(const TRequestMetadata& request_metadata, const int32_t account_id);
   void recv_retrieve_standard_account(TAccount& _return, const int32_t seqid);
+  void retrieve_standard_accounts(std::map<int32_t, TAccount> & _return, const TRequestMetadata& request_metadata, const std::vector<int32_t> & account_ids);
+  int32_t send_retrieve_standard_accounts(const TRequestMetadata& request_metadata, const std::vector<int32_t> & account_ids);
+  void recv_retrieve_standard_accounts(std::map<int32_t, TAccount> & _return, const int32_t seqid);
   void retrieve_expanded_account(TAccount& _return, const TRequestMetadata& request_metadata, const int32_t account_id);
   int32_t send_retrieve_expanded_account(const TRequestMetadata& request_metadata, const int32_t account_id);
   void recv_retrieve_expanded_account(TAccount& _return, const int32_t seqid);
@@ -29,6 +29,7 @@ class TLikeServiceIf {
   virtual void list_likes(std::vector<TLike> & _return, const TRequestMetadata& request_metadata, const TLikeQuery& query, const int32_t limit, const int32_t offset) = 0;
   virtual int32_t count_likes_by_account(const TRequestMetadata& request_metadata, const int32_t account_id) = 0;
   virtual int32_t count_likes_of_post(const TRequestMetadata& request_metadata, const int32_t post_id) = 0;
+  virtual void count_likes_of_posts(std::map<int32_t, int32_t> & _return, const TRequestMetadata& request_metadata, const std::vector<int32_t> & post_ids) = 0;
 };
 
 class TLikeServiceIfFactory {
@@ -81,6 +82,9 @@ class TLikeServiceNull : virtual public TLikeServiceIf {
     int32_t _return = 0;
     return _return;
   }
+  void count_likes_of_posts(std::map<int32_t, int32_t> & /* _return */, const TRequestMetadata& /* request_metadata */, const std::vector<int32_t> & /* post_ids */) {
+    return;
+  }
 };
 
 typedef struct _TLikeService_like_post_args__isset {
@@ -140,9 +144,10 @@ class TLikeService_like_post_pargs {
 };
 
 typedef struct _TLikeService_like_post_result__isset {
-  _TLikeService_like_post_result__isset() : success(false), e(false) {}
+  _TLikeService_like_post_result__isset() : success(false), e(false), overloaded(false) {}
   bool success :1;
   bool e :1;
+  bool overloaded :1;
 } _TLikeService_like_post_result__isset;
 
 class TLikeService_like_post_result {
@@ -156,6 +161,7 @@ class TLikeService_like_post_result {
   virtual ~TLikeService_like_post_result() noexcept;
   TLike success;
   TLikeAlreadyExistsException e;
+  TServerOverloadedException overloaded;
 
   _TLikeService_like_post_result__isset __isset;
 
@@ -163,12 +169,16 @@ class TLikeService_like_post_result {
 
   void __set_e(const TLikeAlreadyExistsException& val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TLikeService_like_post_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
     if (!(e == rhs.e))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TLikeService_like_post_result &rhs) const {
@@ -183,9 +193,10 @@ class TLikeService_like_post_result {
 };
 
 typedef struct _TLikeService_like_post_presult__isset {
-  _TLikeService_like_post_presult__isset() : success(false), e(false) {}
+  _TLikeService_like_post_presult__isset() : success(false), e(false), overloaded(false) {}
   bool success :1;
   bool e :1;
+  bool overloaded :1;
 } _TLikeService_like_post_presult__isset;
 
 class TLikeService_like_post_presult {
@@ -195,6 +206,7 @@ class TLikeService_like_post_presult {
   virtual ~TLikeService_like_post_presult() noexcept;
   TLike* success;
   TLikeAlreadyExistsException e;
+  TServerOverloadedException overloaded;
 
   _TLikeService_like_post_presult__isset __isset;
 
@@ -259,9 +271,10 @@ class TLikeService_retrieve_standard_like_pargs {
 };
 
 typedef struct _TLikeService_retrieve_standard_like_result__isset {
-  _TLikeService_retrieve_standard_like_result__isset() : success(false), e(false) {}
+  _TLikeService_retrieve_standard_like_result__isset() : success(false), e(false), overloaded(false) {}
   bool success :1;
   bool e :1;
+  bool overloaded :1;
 } _TLikeService_retrieve_standard_like_result__isset;
 
 class TLikeService_retrieve_standard_like_result {
@@ -275,6 +288,7 @@ class TLikeService_retrieve_standard_like_result {
   virtual ~TLikeService_retrieve_standard_like_result() noexcept;
   TLike success;
   TLikeNotFoundException e;
+  TServerOverloadedException overloaded;
 
   _TLikeService_retrieve_standard_like_result__isset __isset;
 
@@ -282,12 +296,16 @@ class TLikeService_retrieve_standard_like_result {
 
   void __set_e(const TLikeNotFoundException& val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TLikeService_retrieve_standard_like_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
     if (!(e == rhs.e))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TLikeService_retrieve_standard_like_result &rhs) const {
@@ -302,9 +320,10 @@ class TLikeService_retrieve_standard_like_result {
 };
 
 typedef struct _TLikeService_retrieve_standard_like_presult__isset {
-  _TLikeService_retrieve_standard_like_presult__isset() : success(false), e(false) {}
+  _TLikeService_retrieve_standard_like_presult__isset() : success(false), e(false), overloaded(false) {}
   bool success :1;
   bool e :1;
+  bool overloaded :1;
 } _TLikeService_retrieve_standard_like_presult__isset;
 
 class TLikeService_retrieve_standard_like_presult {
@@ -314,6 +333,7 @@ class TLikeService_retrieve_standard_like_presult {
   virtual ~TLikeService_retrieve_standard_like_presult() noexcept;
   TLike* success;
   TLikeNotFoundException e;
+  TServerOverloadedException overloaded;
 
   _TLikeService_retrieve_standard_like_presult__isset __isset;
 
@@ -378,11 +398,12 @@ class TLikeService_retrieve_expanded_like_pargs {
 };
 
 typedef struct _TLikeService_retrieve_expanded_like_result__isset {
-  _TLikeService_retrieve_expanded_like_result__isset() : success(false), e1(false), e2(false), e3(false) {}
+  _TLikeService_retrieve_expanded_like_result__isset() : success(false), e1(false), e2(false), e3(false), overloaded(false) {}
   bool success :1;
   bool e1 :1;
   bool e2 :1;
   bool e3 :1;
+  bool overloaded :1;
 } _TLikeService_retrieve_expanded_like_result__isset;
 
 class TLikeService_retrieve_expanded_like_result {
@@ -398,6 +419,7 @@ class TLikeService_retrieve_expanded_like_result {
   TLikeNotFoundException e1;
   TAccountNotFoundException e2;
   TPostNotFoundException e3;
+  TServerOverloadedException overloaded;
 
   _TLikeService_retrieve_expanded_like_result__isset __isset;
 
@@ -409,6 +431,8 @@ class TLikeService_retrieve_expanded_like_result {
 
   void __set_e3(const TPostNotFoundException& val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TLikeService_retrieve_expanded_like_result & rhs) const
   {
     if (!(success == rhs.success))
@@ -419,6 +443,8 @@ class TLikeService_retrieve_expanded_like_result {
       return false;
     if (!(e3 == rhs.e3))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TLikeService_retrieve_expanded_like_result &rhs) const {
@@ -433,11 +459,12 @@ class TLikeService_retrieve_expanded_like_result {
 };
 
 typedef struct _TLikeService_retrieve_expanded_like_presult__isset {
-  _TLikeService_retrieve_expanded_like_presult__isset() : success(false), e1(false), e2(false), e3(false) {}
+  _TLikeService_retrieve_expanded_like_presult__isset() : success(false), e1(false), e2(false), e3(false), overloaded(false) {}
   bool success :1;
   bool e1 :1;
   bool e2 :1;
   bool e3 :1;
+  bool overloaded :1;
 } _TLikeService_retrieve_expanded_like_presult__isset;
 
 class TLikeService_retrieve_expanded_like_presult {
@@ -449,6 +476,7 @@ class TLikeService_retrieve_expanded_like_presult {
   TLikeNotFoundException e1;
   TAccountNotFoundException e2;
   TPostNotFoundException e3;
+  TServerOverloadedException overloaded;
 
   _TLikeService_retrieve_expanded_like_presult__isset __isset;
 
@@ -513,9 +541,10 @@ class TLikeService_delete_like_pargs {
 };
 
 typedef struct _TLikeService_delete_like_result__isset {
-  _TLikeService_delete_like_result__isset() : e1(false), e2(false) {}
+  _TLikeService_delete_like_result__isset() : e1(false), e2(false), overloaded(false) {}
   bool e1 :1;
   bool e2 :1;
+  bool overloaded :1;
 } _TLikeService_delete_like_result__isset;
 
 class TLikeService_delete_like_result {
@@ -529,6 +558,7 @@ class TLikeService_delete_like_result {
   virtual ~TLikeService_delete_like_result() noexcept;
   TLikeNotFoundException e1;
   TLikeNotAuthorizedException e2;
+  TServerOverloadedException overloaded;
 
   _TLikeService_delete_like_result__isset __isset;
 
@@ -536,12 +566,16 @@ class TLikeService_delete_like_result {
 
   void __set_e2(const TLikeNotAuthorizedException& val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TLikeService_delete_like_result & rhs) const
   {
     if (!(e1 == rhs.e1))
       return false;
     if (!(e2 == rhs.e2))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TLikeService_delete_like_result &rhs) const {
@@ -556,9 +590,10 @@ class TLikeService_delete_like_result {
 };
 
 typedef struct _TLikeService_delete_like_presult__isset {
-  _TLikeService_delete_like_presult__isset() : e1(false), e2(false) {}
+  _TLikeService_delete_like_presult__isset() : e1(false), e2(false), overloaded(false) {}
   bool e1 :1;
   bool e2 :1;
+  bool overloaded :1;
 } _TLikeService_delete_like_presult__isset;
 
 class TLikeService_delete_like_presult {
@@ -568,6 +603,7 @@ class TLikeService_delete_like_presult {
   virtual ~TLikeService_delete_like_presult() noexcept;
   TLikeNotFoundException e1;
   TLikeNotAuthorizedException e2;
+  TServerOverloadedException overloaded;
 
   _TLikeService_delete_like_presult__isset __isset;
 
@@ -646,10 +682,11 @@ class TLikeService_list_likes_pargs {
 };
 
 typedef struct _TLikeService_list_likes_result__isset {
-  _TLikeService_list_likes_result__isset() : success(false), e1(false), e2(false) {}
+  _TLikeService_list_likes_result__isset() : success(false), e1(false), e2(false), overloaded(false) {}
   bool success :1;
   bool e1 :1;
   bool e2 :1;
+  bool overloaded :1;
 } _TLikeService_list_likes_result__isset;
 
 class TLikeService_list_likes_result {
@@ -664,6 +701,7 @@ class TLikeService_list_likes_result {
   std::vector<TLike>  success;
   TAccountNotFoundException e1;
   TPostNotFoundException e2;
+  TServerOverloadedException overloaded;
 
   _TLikeService_list_likes_result__isset __isset;
 
@@ -673,6 +711,8 @@ class TLikeService_list_likes_result {
 
   void __set_e2(const TPostNotFoundException& val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TLikeService_list_likes_result & rhs) const
   {
     if (!(success == rhs.success))
@@ -681,6 +721,8 @@ class TLikeService_list_likes_result {
       return false;
     if (!(e2 == rhs.e2))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TLikeService_list_likes_result &rhs) const {
@@ -695,10 +737,11 @@ class TLikeService_list_likes_result {
 };
 
 typedef struct _TLikeService_list_likes_presult__isset {
-  _TLikeService_list_likes_presult__isset() : success(false), e1(false), e2(false) {}
+  _TLikeService_list_likes_presult__isset() : success(false), e1(false), e2(false), overloaded(false) {}
   bool success :1;
   bool e1 :1;
   bool e2 :1;
+  bool overloaded :1;
 } _TLikeService_list_likes_presult__isset;
 
 class TLikeService_list_likes_presult {
@@ -709,6 +752,7 @@ class TLikeService_list_likes_presult {
   std::vector<TLike> * success;
   TAccountNotFoundException e1;
   TPostNotFoundException e2;
+  TServerOverloadedException overloaded;
 
   _TLikeService_list_likes_presult__isset __isset;
 
@@ -773,8 +817,9 @@ class TLikeService_count_likes_by_account_pargs {
 };
 
 typedef struct _TLikeService_count_likes_by_account_result__isset {
-  _TLikeService_count_likes_by_account_result__isset() : success(false) {}
+  _TLikeService_count_likes_by_account_result__isset() : success(false), overloaded(false) {}
   bool success :1;
+  bool overloaded :1;
 } _TLikeService_count_likes_by_account_result__isset;
 
 class TLikeService_count_likes_by_account_result {
@@ -787,15 +832,20 @@ class TLikeService_count_likes_by_account_result {
 
   virtual ~TLikeService_count_likes_by_account_result() noexcept;
   int32_t success;
+  TServerOverloadedException overloaded;
 
   _TLikeService_count_likes_by_account_result__isset __isset;
 
   void __set_success(const int32_t val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TLikeService_count_likes_by_account_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TLikeService_count_likes_by_account_result &rhs) const {
@@ -810,8 +860,9 @@ class TLikeService_count_likes_by_account_result {
 };
 
 typedef struct _TLikeService_count_likes_by_account_presult__isset {
-  _TLikeService_count_likes_by_account_presult__isset() : success(false) {}
+  _TLikeService_count_likes_by_account_presult__isset() : success(false), overloaded(false) {}
   bool success :1;
+  bool overloaded :1;
 } _TLikeService_count_likes_by_account_presult__isset;
 
 class TLikeService_count_likes_by_account_presult {
@@ -820,6 +871,7 @@ class TLikeService_count_likes_by_account_presult {
 
   virtual ~TLikeService_count_likes_by_account_presult() noexcept;
   int32_t* success;
+  TServerOverloadedException overloaded;
 
   _TLikeService_count_likes_by_account_presult__isset __isset;
 
@@ -884,8 +936,9 @@ class TLikeService_count_likes_of_post_pargs {
 };
 
 typedef struct _TLikeService_count_likes_of_post_result__isset {
-  _TLikeService_count_likes_of_post_result__isset() : success(false) {}
+  _TLikeService_count_likes_of_post_result__isset() : success(false), overloaded(false) {}
   bool success :1;
+  bool overloaded :1;
 } _TLikeService_count_likes_of_post_result__isset;
 
 class TLikeService_count_likes_of_post_result {
@@ -898,15 +951,20 @@ class TLikeService_count_likes_of_post_result {
 
   virtual ~TLikeService_count_likes_of_post_result() noexcept;
   int32_t success;
+  TServerOverloadedException overloaded;
 
   _TLikeService_count_likes_of_post_result__isset __isset;
 
   void __set_success(const int32_t val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TLikeService_count_likes_of_post_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TLikeService_count_likes_of_post_result &rhs) const {
@@ -921,8 +979,9 @@ class TLikeService_count_likes_of_post_result {
 };
 
 typedef struct _TLikeService_count_likes_of_post_presult__isset {
-  _TLikeService_count_likes_of_post_presult__isset() : success(false) {}
+  _TLikeService_count_likes_of_post_presult__isset() : success(false), overloaded(false) {}
   bool success :1;
+  bool overloaded :1;
 } _TLikeService_count_likes_of_post_presult__isset;
 
 class TLikeService_count_likes_of_post_presult {
@@ -931,6 +990,7 @@ class TLikeService_count_likes_of_post_presult {
 
   virtual ~TLikeService_count_likes_of_post_presult() noexcept;
   int32_t* success;
+  TServerOverloadedException overloaded;
 
   _TLikeService_count_likes_of_post_presult__isset __isset;
 
@@ -938,6 +998,125 @@ class TLikeService_count_likes_of_post_presult {
 
 };
 
+typedef struct _TLikeService_count_likes_of_posts_args__isset {
+  _TLikeService_count_likes_of_posts_args__isset() : request_metadata(false), post_ids(false) {}
+  bool request_metadata :1;
+  bool post_ids :1;
+} _TLikeService_count_likes_of_posts_args__isset;
+
+class TLikeService_count_likes_of_posts_args {
+ public:
+
+  TLikeService_count_likes_of_posts_args(const TLikeService_count_likes_of_posts_args&);
+  TLikeService_count_likes_of_posts_args& operator=(const TLikeService_count_likes_of_posts_args&);
+  TLikeService_count_likes_of_posts_args() {
+  }
+
+  virtual ~TLikeService_count_likes_of_posts_args() noexcept;
+  TRequestMetadata request_metadata;
+  std::vector<int32_t>  post_ids;
+
+  _TLikeService_count_likes_of_posts_args__isset __isset;
+
+  void __set_request_metadata(const TRequestMetadata& val);
+
+  void __set_post_ids(const std::vector<int32_t> & val);
+
+  bool operator == (const TLikeService_count_likes_of_posts_args & rhs) const
+  {
+    if (!(request_metadata == rhs.request_metadata))
+      return false;
+    if (!(post_ids == rhs.post_ids))
+      return false;
+    return true;
+  }
+  bool operator != (const TLikeService_count_likes_of_posts_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const TLikeService_count_likes_of_posts_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class TLikeService_count_likes_of_posts_pargs {
+ public:
+
+
+  virtual ~TLikeService_count_likes_of_posts_pargs() noexcept;
+  const TRequestMetadata* request_metadata;
+  const std::vector<int32_t> * post_ids;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _TLikeService_count_likes_of_posts_result__isset {
+  _TLikeService_count_likes_of_posts_result__isset() : success(false), overloaded(false) {}
+  bool success :1;
+  bool overloaded :1;
+} _TLikeService_count_likes_of_posts_result__isset;
+
+class TLikeService_count_likes_of_posts_result {
+ public:
+
+  TLikeService_count_likes_of_posts_result(const TLikeService_count_likes_of_posts_result&);
+  TLikeService_count_likes_of_posts_result& operator=(const TLikeService_count_likes_of_posts_result&);
+  TLikeService_count_likes_of_posts_result() {
+  }
+
+  virtual ~TLikeService_count_likes_of_posts_result() noexcept;
+  std::map<int32_t, int32_t>  success;
+  TServerOverloadedException overloaded;
+
+  _TLikeService_count_likes_of_posts_result__isset __isset;
+
+  void __set_success(const std::map<int32_t, int32_t> & val);
+
+  void __set_overloaded(const TServerOverloadedException& val);
+
+  bool operator == (const TLikeService_count_likes_of_posts_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
+    return true;
+  }
+  bool operator != (const TLikeService_count_likes_of_posts_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const TLikeService_count_likes_of_posts_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _TLikeService_count_likes_of_posts_presult__isset {
+  _TLikeService_count_likes_of_posts_presult__isset() : success(false), overloaded(false) {}
+  bool success :1;
+  bool overloaded :1;
+} _TLikeService_count_likes_of_posts_presult__isset;
+
+class TLikeService_count_likes_of_posts_presult {
+ public:
+
+
+  virtual ~TLikeService_count_likes_of_posts_presult() noexcept;
+  std::map<int32_t, int32_t> * success;
+  TServerOverloadedException overloaded;
+
+  _TLikeService_count_likes_of_posts_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
 class TLikeServiceClient : virtual public TLikeServiceIf {
  public:
   TLikeServiceClient(std::shared_ptr< ::apache::thrift::protocol::TProtocol> prot) {
@@ -984,6 +1163,9 @@ class TLikeServiceClient : virtual public TLikeServiceIf {
   int32_t count_likes_of_post(const TRequestMetadata& request_metadata, const int32_t post_id);
   void send_count_likes_of_post(const TRequestMetadata& request_metadata, const int32_t post_id);
   int32_t recv_count_likes_of_post();
+  void count_likes_of_posts(std::map<int32_t, int32_t> & _return, const TRequestMetadata& request_metadata, const std::vector<int32_t> & post_ids);
+  void send_count_likes_of_posts(const TRequestMetadata& request_metadata, const std::vector<int32_t> & post_ids);
+  void recv_count_likes_of_posts(std::map<int32_t, int32_t> & _return);
  protected:
   std::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
   std::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
@@ -1006,6 +1188,7 @@ class TLikeServiceProcessor : public ::apache::thrift::TDispatchProcessor {
   void process_list_likes(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_count_likes_by_account(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_count_likes_of_post(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_count_likes_of_posts(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
  public:
   TLikeServiceProcessor(::std::shared_ptr<TLikeServiceIf> iface) :
     iface_(iface) {
@@ -1016,6 +1199,7 @@ class TLikeServiceProcessor : public ::apache::thrift::TDispatchProcessor {
     processMap_["list_likes"] = &TLikeServiceProcessor::process_list_likes;
     processMap_["count_likes_by_account"] = &TLikeServiceProcessor::process_count_likes_by_account;
     processMap_["count_likes_of_post"] = &TLikeServiceProcessor::process_count_likes_of_post;
+    processMap_["count_likes_of_posts"] = &TLikeServiceProcessor::process_count_likes_of_posts;
   }
 
   virtual ~TLikeServiceProcessor() {}
@@ -1111,6 +1295,16 @@ class TLikeServiceMultiface : virtual public TLikeServiceIf {
     return ifaces_[i]->count_likes_of_post(request_metadata, post_id);
   }
 
+  void count_likes_of_posts(std::map<int32_t, int32_t> & _return, const TRequestMetadata& request_metadata, const std::vector<int32_t> & post_ids) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->count_likes_of_posts(_return, request_metadata, post_ids);
+    }
+    ifaces_[i]->count_likes_of_posts(_return, request_metadata, post_ids);
+    return;
+  }
+
 };
 
 // The 'concurrent' client is a thread safe client that correctly handles
@@ -1164,6 +1358,9 @@ class TLikeServiceConcurrentClient : virtual public TLikeServiceIf {
   int32_t count_likes_of_post(const TRequestMetadata& request_metadata, const int32_t post_id);
   int32_t send_count_likes_of_post(const TRequestMetadata& request_metadata, const int32_t post_id);
   int32_t recv_count_likes_of_post(const int32_t seqid);
+  void count_likes_of_posts(std::map<int32_t, int32_t> & _return, const TRequestMetadata& request_metadata, const std::vector<int32_t> & post_ids);
+  int32_t send_count_likes_of_posts(const TRequestMetadata& request_metadata, const std::vector<int32_t> & post_ids);
+  void recv_count_likes_of_posts(std::map<int32_t, int32_t> & _return, const int32_t seqid);
  protected:
   std::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
   std::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
@@ -25,6 +25,7 @@ class TPostServiceIf {
   virtual void create_post(TPost& _return, const TRequestMetadata& request_metadata, const std::string& text) = 0;
   virtual void retrieve_standard_post(TPost& _return, const TRequestMetadata& request_metadata, const int32_t post_id) = 0;
   virtual void retrieve_expanded_post(TPost& _return, const TRequestMetadata& request_metadata, const int32_t post_id) = 0;
+  virtual void retrieve_expanded_posts(std::map<int32_t, TPost> & _return, const TRequestMetadata& request_metadata, const std::vector<int32_t> & post_ids) = 0;
   virtual void delete_post(const TRequestMetadata& request_metadata, const int32_t post_id) = 0;
   virtual void list_posts(std::vector<TPost> & _return, const TRequestMetadata& request_metadata, const TPostQuery& query, const int32_t limit, const int32_t offset) = 0;
   virtual int32_t count_posts_by_author(const TRequestMetadata& request_metadata, const int32_t author_id) = 0;
@@ -66,6 +67,9 @@ class TPostServiceNull : virtual public TPostServiceIf {
   void retrieve_expanded_post(TPost& /* _return */, const TRequestMetadata& /* request_metadata */, const int32_t /* post_id */) {
     return;
   }
+  void retrieve_expanded_posts(std::map<int32_t, TPost> & /* _return */, const TRequestMetadata& /* request_metadata */, const std::vector<int32_t> & /* post_ids */) {
+    return;
+  }
   void delete_post(const TRequestMetadata& /* request_metadata */, const int32_t /* post_id */) {
     return;
   }
@@ -135,9 +139,10 @@ class TPostService_create_post_pargs {
 };
 
 typedef struct _TPostService_create_post_result__isset {
-  _TPostService_create_post_result__isset() : success(false), e(false) {}
+  _TPostService_create_post_result__isset() : success(false), e(false), overloaded(false) {}
   bool success :1;
   bool e :1;
+  bool overloaded :1;
 } _TPostService_create_post_result__isset;
 
 class TPostService_create_post_result {
@@ -151,6 +156,7 @@ class TPostService_create_post_result {
   virtual ~TPostService_create_post_result() noexcept;
   TPost success;
   TPostInvalidAttributesException e;
+  TServerOverloadedException overloaded;
 
   _TPostService_create_post_result__isset __isset;
 
@@ -158,12 +164,16 @@ class TPostService_create_post_result {
 
   void __set_e(const TPostInvalidAttributesException& val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TPostService_create_post_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
     if (!(e == rhs.e))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TPostService_create_post_result &rhs) const {
@@ -178,9 +188,10 @@ class TPostService_create_post_result {
 };
 
 typedef struct _TPostService_create_post_presult__isset {
-  _TPostService_create_post_presult__isset() : success(false), e(false) {}
+  _TPostService_create_post_presult__isset() : success(false), e(false), overloaded(false) {}
   bool success :1;
   bool e :1;
+  bool overloaded :1;
 } _TPostService_create_post_presult__isset;
 
 class TPostService_create_post_presult {
@@ -190,6 +201,7 @@ class TPostService_create_post_presult {
   virtual ~TPostService_create_post_presult() noexcept;
   TPost* success;
   TPostInvalidAttributesException e;
+  TServerOverloadedException overloaded;
 
   _TPostService_create_post_presult__isset __isset;
 
@@ -254,9 +266,10 @@ class TPostService_retrieve_standard_post_pargs {
 };
 
 typedef struct _TPostService_retrieve_standard_post_result__isset {
-  _TPostService_retrieve_standard_post_result__isset() : success(false), e(false) {}
+  _TPostService_retrieve_standard_post_result__isset() : success(false), e(false), overloaded(false) {}
   bool success :1;
   bool e :1;
+  bool overloaded :1;
 } _TPostService_retrieve_standard_post_result__isset;
 
 class TPostService_retrieve_standard_post_result {
@@ -270,6 +283,7 @@ class TPostService_retrieve_standard_post_result {
   virtual ~TPostService_retrieve_standard_post_result() noexcept;
   TPost success;
   TPostNotFoundException e;
+  TServerOverloadedException overloaded;
 
   _TPostService_retrieve_standard_post_result__isset __isset;
 
@@ -277,12 +291,16 @@ class TPostService_retrieve_standard_post_result {
 
   void __set_e(const TPostNotFoundException& val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TPostService_retrieve_standard_post_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
     if (!(e == rhs.e))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TPostService_retrieve_standard_post_result &rhs) const {
@@ -297,9 +315,10 @@ class TPostService_retrieve_standard_post_result {
 };
 
 typedef struct _TPostService_retrieve_standard_post_presult__isset {
-  _TPostService_retrieve_standard_post_presult__isset() : success(false), e(false) {}
+  _TPostService_retrieve_standard_post_presult__isset() : success(false), e(false), overloaded(false) {}
   bool success :1;
   bool e :1;
+  bool overloaded :1;
 } _TPostService_retrieve_standard_post_presult__isset;
 
 class TPostService_retrieve_standard_post_presult {
@@ -309,6 +328,7 @@ class TPostService_retrieve_standard_post_presult {
   virtual ~TPostService_retrieve_standard_post_presult() noexcept;
   TPost* success;
   TPostNotFoundException e;
+  TServerOverloadedException overloaded;
 
   _TPostService_retrieve_standard_post_presult__isset __isset;
 
@@ -373,10 +393,11 @@ class TPostService_retrieve_expanded_post_pargs {
 };
 
 typedef struct _TPostService_retrieve_expanded_post_result__isset {
-  _TPostService_retrieve_expanded_post_result__isset() : success(false), e1(false), e2(false) {}
+  _TPostService_retrieve_expanded_post_result__isset() : success(false), e1(false), e2(false), overloaded(false) {}
   bool success :1;
   bool e1 :1;
   bool e2 :1;
+  bool overloaded :1;
 } _TPostService_retrieve_expanded_post_result__isset;
 
 class TPostService_retrieve_expanded_post_result {
@@ -391,6 +412,7 @@ class TPostService_retrieve_expanded_post_result {
   TPost success;
   TPostNotFoundException e1;
   TAccountNotFoundException e2;
+  TServerOverloadedException overloaded;
 
   _TPostService_retrieve_expanded_post_result__isset __isset;
 
@@ -400,6 +422,8 @@ class TPostService_retrieve_expanded_post_result {
 
   void __set_e2(const TAccountNotFoundException& val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TPostService_retrieve_expanded_post_result & rhs) const
   {
     if (!(success == rhs.success))
@@ -408,6 +432,8 @@ class TPostService_retrieve_expanded_post_result {
       return false;
     if (!(e2 == rhs.e2))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TPostService_retrieve_expanded_post_result &rhs) const {
@@ -422,10 +448,11 @@ class TPostService_retrieve_expanded_post_result {
 };
 
 typedef struct _TPostService_retrieve_expanded_post_presult__isset {
-  _TPostService_retrieve_expanded_post_presult__isset() : success(false), e1(false), e2(false) {}
+  _TPostService_retrieve_expanded_post_presult__isset() : success(false), e1(false), e2(false), overloaded(false) {}
   bool success :1;
   bool e1 :1;
   bool e2 :1;
+  bool overloaded :1;
 } _TPostService_retrieve_expanded_post_presult__isset;
 
 class TPostService_retrieve_expanded_post_presult {
@@ -436,6 +463,7 @@ class TPostService_retrieve_expanded_post_presult {
   TPost* success;
   TPostNotFoundException e1;
   TAccountNotFoundException e2;
+  TServerOverloadedException overloaded;
 
   _TPostService_retrieve_expanded_post_presult__isset __isset;
 
@@ -443,6 +471,133 @@ class TPostService_retrieve_expanded_post_presult {
 
 };
 
+typedef struct _TPostService_retrieve_expanded_posts_args__isset {
+  _TPostService_retrieve_expanded_posts_args__isset() : request_metadata(false), post_ids(false) {}
+  bool request_metadata :1;
+  bool post_ids :1;
+} _TPostService_retrieve_expanded_posts_args__isset;
+
+class TPostService_retrieve_expanded_posts_args {
+ public:
+
+  TPostService_retrieve_expanded_posts_args(const TPostService_retrieve_expanded_posts_args&);
+  TPostService_retrieve_expanded_posts_args& operator=(const TPostService_retrieve_expanded_posts_args&);
+  TPostService_retrieve_expanded_posts_args() {
+  }
+
+  virtual ~TPostService_retrieve_expanded_posts_args() noexcept;
+  TRequestMetadata request_metadata;
+  std::vector<int32_t>  post_ids;
+
+  _TPostService_retrieve_expanded_posts_args__isset __isset;
+
+  void __set_request_metadata(const TRequestMetadata& val);
+
+  void __set_post_ids(const std::vector<int32_t> & val);
+
+  bool operator == (const TPostService_retrieve_expanded_posts_args & rhs) const
+  {
+    if (!(request_metadata == rhs.request_metadata))
+      return false;
+    if (!(post_ids == rhs.post_ids))
+      return false;
+    return true;
+  }
+  bool operator != (const TPostService_retrieve_expanded_posts_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const TPostService_retrieve_expanded_posts_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class TPostService_retrieve_expanded_posts_pargs {
+ public:
+
+
+  virtual ~TPostService_retrieve_expanded_posts_pargs() noexcept;
+  const TRequestMetadata* request_metadata;
+  const std::vector<int32_t> * post_ids;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _TPostService_retrieve_expanded_posts_result__isset {
+  _TPostService_retrieve_expanded_posts_result__isset() : success(false), e(false), overloaded(false) {}
+  bool success :1;
+  bool e :1;
+  bool overloaded :1;
+} _TPostService_retrieve_expanded_posts_result__isset;
+
+class TPostService_retrieve_expanded_posts_result {
+ public:
+
+  TPostService_retrieve_expanded_posts_result(const TPostService_retrieve_expanded_posts_result&);
+  TPostService_retrieve_expanded_posts_result& operator=(const TPostService_retrieve_expanded_posts_result&);
+  TPostService_retrieve_expanded_posts_result() {
+  }
+
+  virtual ~TPostService_retrieve_expanded_posts_result() noexcept;
+  std::map<int32_t, TPost>  success;
+  TAccountNotFoundException e;
+  TServerOverloadedException overloaded;
+
+  _TPostService_retrieve_expanded_posts_result__isset __isset;
+
+  void __set_success(const std::map<int32_t, TPost> & val);
+
+  void __set_e(const TAccountNotFoundException& val);
+
+  void __set_overloaded(const TServerOverloadedException& val);
+
+  bool operator == (const TPostService_retrieve_expanded_posts_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(e == rhs.e))
+      return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
+    return true;
+  }
+  bool operator != (const TPostService_retrieve_expanded_posts_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const TPostService_retrieve_expanded_posts_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _TPostService_retrieve_expanded_posts_presult__isset {
+  _TPostService_retrieve_expanded_posts_presult__isset() : success(false), e(false), overloaded(false) {}
+  bool success :1;
+  bool e :1;
+  bool overloaded :1;
+} _TPostService_retrieve_expanded_posts_presult__isset;
+
+class TPostService_retrieve_expanded_posts_presult {
+ public:
+
+
+  virtual ~TPostService_retrieve_expanded_posts_presult() noexcept;
+  std::map<int32_t, TPost> * success;
+  TAccountNotFoundException e;
+  TServerOverloadedException overloaded;
+
+  _TPostService_retrieve_expanded_posts_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
 typedef struct _TPostService_delete_post_args__isset {
   _TPostService_delete_post_args__isset() : request_metadata(false), post_id(false) {}
   bool request_metadata :1;
@@ -500,9 +655,10 @@ class TPostService_delete_post_pargs {
 };
 
 typedef struct _TPostService_delete_post_result__isset {
-  _TPostService_delete_post_result__isset() : e1(false), e2(false) {}
+  _TPostService_delete_post_result__isset() : e1(false), e2(false), overloaded(false) {}
   bool e1 :1;
   bool e2 :1;
+  bool overloaded :1;
 } _TPostService_delete_post_result__isset;
 
 class TPostService_delete_post_result {
@@ -516,6 +672,7 @@ class TPostService_delete_post_result {
   virtual ~TPostService_delete_post_result() noexcept;
   TPostNotFoundException e1;
   TPostNotAuthorizedException e2;
+  TServerOverloadedException overloaded;
 
   _TPostService_delete_post_result__isset __isset;
 
@@ -523,12 +680,16 @@ class TPostService_delete_post_result {
 
   void __set_e2(const TPostNotAuthorizedException& val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TPostService_delete_post_result & rhs) const
   {
     if (!(e1 == rhs.e1))
       return false;
     if (!(e2 == rhs.e2))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TPostService_delete_post_result &rhs) const {
@@ -543,9 +704,10 @@ class TPostService_delete_post_result {
 };
 
 typedef struct _TPostService_delete_post_presult__isset {
-  _TPostService_delete_post_presult__isset() : e1(false), e2(false) {}
+  _TPostService_delete_post_presult__isset() : e1(false), e2(false), overloaded(false) {}
   bool e1 :1;
   bool e2 :1;
+  bool overloaded :1;
 } _TPostService_delete_post_presult__isset;
 
 class TPostService_delete_post_presult {
@@ -555,6 +717,7 @@ class TPostService_delete_post_presult {
   virtual ~TPostService_delete_post_presult() noexcept;
   TPostNotFoundException e1;
   TPostNotAuthorizedException e2;
+  TServerOverloadedException overloaded;
 
   _TPostService_delete_post_presult__isset __isset;
 
@@ -633,9 +796,10 @@ class TPostService_list_posts_pargs {
 };
 
 typedef struct _TPostService_list_posts_result__isset {
-  _TPostService_list_posts_result__isset() : success(false), e(false) {}
+  _TPostService_list_posts_result__isset() : success(false), e(false), overloaded(false) {}
   bool success :1;
   bool e :1;
+  bool overloaded :1;
 } _TPostService_list_posts_result__isset;
 
 class TPostService_list_posts_result {
@@ -649,6 +813,7 @@ class TPostService_list_posts_result {
   virtual ~TPostService_list_posts_result() noexcept;
   std::vector<TPost>  success;
   TAccountNotFoundException e;
+  TServerOverloadedException overloaded;
 
   _TPostService_list_posts_result__isset __isset;
 
@@ -656,12 +821,16 @@ class TPostService_list_posts_result {
 
   void __set_e(const TAccountNotFoundException& val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TPostService_list_posts_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
     if (!(e == rhs.e))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TPostService_list_posts_result &rhs) const {
@@ -676,9 +845,10 @@ class TPostService_list_posts_result {
 };
 
 typedef struct _TPostService_list_posts_presult__isset {
-  _TPostService_list_posts_presult__isset() : success(false), e(false) {}
+  _TPostService_list_posts_presult__isset() : success(false), e(false), overloaded(false) {}
   bool success :1;
   bool e :1;
+  bool overloaded :1;
 } _TPostService_list_posts_presult__isset;
 
 class TPostService_list_posts_presult {
@@ -688,6 +858,7 @@ class TPostService_list_posts_presult {
   virtual ~TPostService_list_posts_presult() noexcept;
   std::vector<TPost> * success;
   TAccountNotFoundException e;
+  TServerOverloadedException overloaded;
 
   _TPostService_list_posts_presult__isset __isset;
 
@@ -752,8 +923,9 @@ class TPostService_count_posts_by_author_pargs {
 };
 
 typedef struct _TPostService_count_posts_by_author_result__isset {
-  _TPostService_count_posts_by_author_result__isset() : success(false) {}
+  _TPostService_count_posts_by_author_result__isset() : success(false), overloaded(false) {}
   bool success :1;
+  bool overloaded :1;
 } _TPostService_count_posts_by_author_result__isset;
 
 class TPostService_count_posts_by_author_result {
@@ -766,15 +938,20 @@ class TPostService_count_posts_by_author_result {
 
   virtual ~TPostService_count_posts_by_author_result() noexcept;
   int32_t success;
+  TServerOverloadedException overloaded;
 
   _TPostService_count_posts_by_author_result__isset __isset;
 
   void __set_success(const int32_t val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TPostService_count_posts_by_author_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TPostService_count_posts_by_author_result &rhs) const {
@@ -789,8 +966,9 @@ class TPostService_count_posts_by_author_result {
 };
 
 typedef struct _TPostService_count_posts_by_author_presult__isset {
-  _TPostService_count_posts_by_author_presult__isset() : success(false) {}
+  _TPostService_count_posts_by_author_presult__isset() : success(false), overloaded(false) {}
   bool success :1;
+  bool overloaded :1;
 } _TPostService_count_posts_by_author_presult__isset;
 
 class TPostService_count_posts_by_author_presult {
@@ -799,6 +977,7 @@ class TPostService_count_posts_by_author_presult {
 
   virtual ~TPostService_count_posts_by_author_presult() noexcept;
   int32_t* success;
+  TServerOverloadedException overloaded;
 
   _TPostService_count_posts_by_author_presult__isset __isset;
 
@@ -840,6 +1019,9 @@ class TPostServiceClient : virtual public TPostServiceIf {
   void retrieve_expanded_post(TPost& _return, const TRequestMetadata& request_metadata, const int32_t post_id);
   void send_retrieve_expanded_post(const TRequestMetadata& request_metadata, const int32_t post_id);
   void recv_retrieve_expanded_post(TPost& _return);
+  void retrieve_expanded_posts(std::map<int32_t, TPost> & _return, const TRequestMetadata& request_metadata, const std::vector<int32_t> & post_ids);
+  void send_retrieve_expanded_posts(const TRequestMetadata& request_metadata, const std::vector<int32_t> & post_ids);
+  void recv_retrieve_expanded_posts(std::map<int32_t, TPost> & _return);
   void delete_post(const TRequestMetadata& request_metadata, const int32_t post_id);
   void send_delete_post(const TRequestMetadata& request_metadata, const int32_t post_id);
   void recv_delete_post();
@@ -867,6 +1049,7 @@ class TPostServiceProcessor : public ::apache::thrift::TDispatchProcessor {
   void process_create_post(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_retrieve_standard_post(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_retrieve_expanded_post(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_retrieve_expanded_posts(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_delete_post(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_list_posts(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_count_posts_by_author(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
@@ -876,6 +1059,7 @@ class TPostServiceProcessor : public ::apache::thrift::TDispatchProcessor {
     processMap_["create_post"] = &TPostServiceProcessor::process_create_post;
     processMap_["retrieve_standard_post"] = &TPostServiceProcessor::process_retrieve_standard_post;
     processMap_["retrieve_expanded_post"] = &TPostServiceProcessor::process_retrieve_expanded_post;
+    processMap_["retrieve_expanded_posts"] = &TPostServiceProcessor::process_retrieve_expanded_posts;
     processMap_["delete_post"] = &TPostServiceProcessor::process_delete_post;
     processMap_["list_posts"] = &TPostServiceProcessor::process_list_posts;
     processMap_["count_posts_by_author"] = &TPostServiceProcessor::process_count_posts_by_author;
@@ -937,6 +1121,16 @@ class TPostServiceMultiface : virtual public TPostServiceIf {
     return;
   }
 
+  void retrieve_expanded_posts(std::map<int32_t, TPost> & _return, const TRequestMetadata& request_metadata, const std::vector<int32_t> & post_ids) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->retrieve_expanded_posts(_return, request_metadata, post_ids);
+    }
+    ifaces_[i]->retrieve_expanded_posts(_return, request_metadata, post_ids);
+    return;
+  }
+
   void delete_post(const TRequestMetadata& request_metadata, const int32_t post_id) {
     size_t sz = ifaces_.size();
     size_t i = 0;
@@ -1006,6 +1200,9 @@ class TPostServiceConcurrentClient : virtual public TPostServiceIf {
   void retrieve_expanded_post(TPost& _return, const TRequestMetadata& request_metadata, const int32_t post_id);
   int32_t send_retrieve_expanded_post(const TRequestMetadata& request_metadata, const int32_t post_id);
   void recv_retrieve_expanded_post(TPost& _return, const int32_t seqid);
+  void retrieve_expanded_posts(std::map<int32_t, TPost> & _return, const TRequestMetadata& request_metadata, const std::vector<int32_t> & post_ids);
+  int32_t send_retrieve_expanded_posts(const TRequestMetadata& request_metadata, const std::vector<int32_t> & post_ids);
+  void recv_retrieve_expanded_posts(std::map<int32_t, TPost> & _return, const int32_t seqid);
   void delete_post(const TRequestMetadata& request_metadata, const int32_t post_id);
   int32_t send_delete_post(const TRequestMetadata& request_metadata, const int32_t post_id);
   void recv_delete_post(const int32_t seqid);
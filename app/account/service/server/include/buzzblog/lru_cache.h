@@ -0,0 +1,154 @@
+// Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
+// Systems
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+
+// A bounded, thread-safe LRU cache whose entries expire `ttl_ms` after being
+// inserted. Keys are spread over independently locked shards, so that threads
+// looking up different keys rarely contend for the same lock.
+//
+// Lookups that miss return a ticket, which must be passed to `put` when the
+// value is inserted. Values loaded before an `erase` of their shard are then
+// discarded, so a lookup racing with an invalidation cannot reinsert a stale
+// value.
+template <typename K, typename V>
+class LRUCache {
+public:
+  // Cache usage since its creation.
+  struct Stats {
+    int size;                   // number of entries cached.
+    int64_t n_hits;             // number of lookups that found a fresh entry.
+    int64_t n_misses;           // number of lookups that did not.
+    int64_t n_evictions;        // number of entries dropped to make room.
+    int64_t n_expirations;      // number of entries dropped after their TTL.
+    int64_t n_invalidations;    // number of entries dropped by `erase`.
+  };
+
+  LRUCache(int capacity, int ttl_ms, int n_shards = 16)
+  : _ttl(ttl_ms),
+    _shards(std::max(n_shards, 1)) {
+    // Split capacity over shards, rounding up.
+    int shard_capacity = (capacity + int(_shards.size()) - 1) /
+        int(_shards.size());
+    for (auto& shard : _shards)
+      shard.capacity = shard_capacity;
+  }
+
+  LRUCache(const LRUCache&) = delete;
+  LRUCache& operator=(const LRUCache&) = delete;
+
+  // Look up `key`, copying its value into `value` on a hit. On a miss,
+  // `ticket` is set for a later `put` of the key.
+  bool get(const K& key, V* value, uint64_t* ticket) {
+    auto& shard = shard_of(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.index.find(key);
+    if (it != shard.index.end()) {
+      if (std::chrono::steady_clock::now() < it->second->expires_at) {
+        // Move entry to the front of the LRU list.
+        shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+        *value = it->second->value;
+        shard.n_hits++;
+        return true;
+      }
+      shard.entries.erase(it->second);
+      shard.index.erase(it);
+      shard.n_expirations++;
+    }
+    *ticket = shard.generation;
+    shard.n_misses++;
+    return false;
+  }
+
+  // Insert `value`, unless the key's shard was invalidated since the lookup
+  // that returned `ticket`.
+  void put(const K& key, const V& value, uint64_t ticket) {
+    auto& shard = shard_of(key);
+    if (shard.capacity <= 0)
+      return;
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (ticket != shard.generation)
+      return;
+    auto expires_at = std::chrono::steady_clock::now() + _ttl;
+    auto it = shard.index.find(key);
+    if (it != shard.index.end()) {
+      it->second->value = value;
+      it->second->expires_at = expires_at;
+      shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+      return;
+    }
+    if (int(shard.entries.size()) >= shard.capacity) {
+      // Evict the least recently used entry.
+      shard.index.erase(shard.entries.back().key);
+      shard.entries.pop_back();
+      shard.n_evictions++;
+    }
+    shard.entries.push_front(Entry{key, value, expires_at});
+    shard.index[key] = shard.entries.begin();
+  }
+
+  // Drop `key`. Call it after the change that made the value stale has been
+  // committed.
+  void erase(const K& key) {
+    auto& shard = shard_of(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.generation++;
+    auto it = shard.index.find(key);
+    if (it != shard.index.end()) {
+      shard.entries.erase(it->second);
+      shard.index.erase(it);
+      shard.n_invalidations++;
+    }
+  }
+
+  Stats stats() {
+    Stats stats{0, 0, 0, 0, 0, 0};
+    for (auto& shard : _shards) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      stats.size += int(shard.entries.size());
+      stats.n_hits += shard.n_hits;
+      stats.n_misses += shard.n_misses;
+      stats.n_evictions += shard.n_evictions;
+      stats.n_expirations += shard.n_expirations;
+      stats.n_invalidations += shard.n_invalidations;
+    }
+    return stats;
+  }
+
+private:
+  struct Entry {
+    K key;
+    V value;
+    std::chrono::steady_clock::time_point expires_at;
+  };
+
+  struct Shard {
+    std::mutex mutex;
+    int capacity = 0;
+    uint64_t generation = 0;
+    std::list<Entry> entries;   // most recently used first.
+    std::unordered_map<K, typename std::list<Entry>::iterator> index;
+    int64_t n_hits = 0;
+    int64_t n_misses = 0;
+    int64_t n_evictions = 0;
+    int64_t n_expirations = 0;
+    int64_t n_invalidations = 0;
+  };
+
+  Shard& shard_of(const K& key) {
+    return _shards[std::hash<K>()(key) % _shards.size()];
+  }
+
+  const std::chrono::milliseconds _ttl;
+  std::vector<Shard> _shards;
+};
@@ -0,0 +1,77 @@
+// Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
+// Systems
+
+#pragma once
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+#include <buzzblog/metrics.h>
+
+
+// Serve `metrics()` over HTTP on `port` (GET /metrics), from a background
+// thread. Scrapes are rare, so connections are served one at a time.
+inline void start_metrics_server(int port) {
+  int server_fd = socket(AF_INET, SOCK_STREAM, 0);
+  if (server_fd < 0)
+    throw std::runtime_error("Could not create metrics socket");
+  int reuse = 1;
+  setsockopt(server_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+  sockaddr_in address;
+  std::memset(&address, 0, sizeof(address));
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_ANY);
+  address.sin_port = htons(port);
+  if (bind(server_fd, reinterpret_cast<sockaddr*>(&address),
+          sizeof(address)) < 0 ||
+      listen(server_fd, 16) < 0) {
+    close(server_fd);
+    throw std::runtime_error("Could not listen for metrics on port " +
+        std::to_string(port));
+  }
+
+  std::thread([server_fd] {
+    while (true) {
+      int fd = accept(server_fd, nullptr, nullptr);
+      if (fd < 0)
+        continue;
+      // Do not let a slow client hold up the next scrapes.
+      timeval timeout{1, 0};
+      setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+      setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+      // Read the request headers.
+      std::string request;
+      char buf[1024];
+      ssize_t n;
+      while (request.find("\r\n\r\n") == std::string::npos &&
+          request.size() < 8192 && (n = recv(fd, buf, sizeof(buf), 0)) > 0)
+        request.append(buf, n);
+      std::string status, body;
+      if (request.compare(0, 13, "GET /metrics ") == 0) {
+        status = "200 OK";
+        body = metrics().scrape();
+      }
+      else {
+        status = "404 Not Found";
+      }
+      std::string response = "HTTP/1.1 " + status + "\r\n"
+          "Content-Type: text/plain; version=0.0.4\r\n"
+          "Content-Length: " + std::to_string(body.size()) + "\r\n"
+          "Connection: close\r\n\r\n" + body;
+      for (size_t sent = 0; sent < response.size(); sent += n) {
+        n = send(fd, response.data() + sent, response.size() - sent,
+            MSG_NOSIGNAL);
+        if (n <= 0)
+          break;
+      }
+      close(fd);
+    }
+  }).detach();
+}
@@ -1,18 +1,29 @@
 // Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
 // Systems
 
+#include <chrono>
+#include <future>
+#include <map>
+#include <memory>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 #include <cxxopts.hpp>
 #include <pqxx/pqxx>
-#include <spdlog/sinks/basic_file_sink.h>
-#include <thrift/protocol/TBinaryProtocol.h>
-#include <thrift/server/TThreadedServer.h>
-#include <thrift/transport/TBufferTransports.h>
-#include <thrift/transport/TServerSocket.h>
 
 #include <buzzblog/gen/TAccountService.h>
+#include <buzzblog/admission_controller.h>
 #include <buzzblog/base_server.h>
+#include <buzzblog/call_logger.h>
+#include <buzzblog/call_tracer.h>
+#include <buzzblog/deadline.h>
+#include <buzzblog/lru_cache.h>
+#include <buzzblog/metrics.h>
+#include <buzzblog/metrics_server.h>
+#include <buzzblog/server_event_handler.h>
+#include <buzzblog/span_collector.h>
+#include <buzzblog/thrift_server.h>
 
 
 using namespace apache::thrift;
@@ -34,31 +45,77 @@ private:
         last_name.size() > 0 && last_name.size() <= 32);
   }
 
+  std::chrono::milliseconds fanout_timeout;
+  // Accounts (standard mode) recently retrieved, by id. Entries expire after a
+  // TTL, which bounds how stale they get when another server updates them.
+  std::unique_ptr<LRUCache<int32_t, TAccount>> account_cache;
+
 public:
   TAccountServiceHandler(const std::string& backend_filepath,
       const std::string& postgres_user, const std::string& postgres_password,
-      const std::string& postgres_dbname)
+      const std::string& postgres_dbname, int fanout_timeout_ms,
+      int account_cache_size, int account_cache_ttl_ms)
   : BaseServer(backend_filepath, postgres_user, postgres_password,
-      postgres_dbname) {
+      postgres_dbname),
+    fanout_timeout(fanout_timeout_ms),
+    account_cache(std::make_unique<LRUCache<int32_t, TAccount>>(
+        account_cache_size, account_cache_ttl_ms)) {
+    // Prepare statements.
+    account_db_pool->prepare("authenticate_user",
+        "SELECT id, created_at, active, password, first_name, last_name "
+        "FROM Accounts "
+        "WHERE username = $1");
+    account_db_pool->prepare("create_account",
+        "INSERT INTO Accounts (created_at, username, password, first_name, "
+            "last_name) "
+        "VALUES (extract(epoch from now()), $1, $2, $3, $4) "
+        "RETURNING id, created_at");
+    account_db_pool->prepare("retrieve_standard_account",
+        "SELECT created_at, active, username, first_name, last_name "
+        "FROM Accounts "
+        "WHERE id = $1");
+    account_db_pool->prepare("retrieve_standard_accounts",
+        "SELECT id, created_at, active, username, first_name, last_name "
+        "FROM Accounts "
+        "WHERE id = ANY($1::integer[])");
+    account_db_pool->prepare("update_account",
+        "UPDATE Accounts "
+        "SET password = $1, first_name = $2, last_name = $3 "
+        "WHERE id = $4 "
+        "RETURNING created_at, active, username");
+    account_db_pool->prepare("delete_account",
+        "UPDATE Accounts "
+        "SET active = FALSE "
+        "WHERE id = $1 "
+        "RETURNING id");
+
+    // Export cache usage as metrics.
+    auto cache = account_cache.get();
+    auto labels = "cache=\"account\"";
+    auto& m = metrics();
+    m.add_callback("gauge", "buzzblog_cache_size", labels,
+        [cache] { return cache->stats().size; });
+    m.add_callback("counter", "buzzblog_cache_hits_total", labels,
+        [cache] { return cache->stats().n_hits; });
+    m.add_callback("counter", "buzzblog_cache_misses_total", labels,
+        [cache] { return cache->stats().n_misses; });
+    m.add_callback("counter", "buzzblog_cache_evictions_total", labels,
+        [cache] { return cache->stats().n_evictions; });
+    m.add_callback("counter", "buzzblog_cache_expirations_total", labels,
+        [cache] { return cache->stats().n_expirations; });
+    m.add_callback("counter", "buzzblog_cache_invalidations_total", labels,
+        [cache] { return cache->stats().n_invalidations; });
   }
 
   void authenticate_user(TAccount& _return,
       const TRequestMetadata& request_metadata, const std::string& username,
       const std::string& password) {
-    // Build query string.
-    char query_str[1024];
-    const char *query_fmt = \
-        "SELECT id, created_at, active, password, first_name, last_name "
-        "FROM Accounts "
-        "WHERE username = '%s'";
-    sprintf(query_str, query_fmt, username.c_str());
-
+    ServerEventHandler::set_request_metadata(request_metadata);
     // Execute query.
-    pqxx::connection conn(account_db_conn_str);
-    pqxx::work txn(conn);
-    pqxx::result db_res(txn.exec(query_str));
+    auto conn = account_db_pool->acquire();
+    pqxx::work txn(*conn);
+    pqxx::result db_res(exec_prepared(txn, "authenticate_user", username));
     txn.commit();
-    conn.disconnect();
 
     // Check if account exists.
     if (db_res.begin() == db_res.end())
@@ -85,32 +142,23 @@ public:
       const TRequestMetadata& request_metadata, const std::string& username,
       const std::string& password, const std::string& first_name,
       const std::string& last_name) {
+    ServerEventHandler::set_request_metadata(request_metadata);
     // Validate attributes.
     if (!validate_attributes(username, password, first_name, last_name))
       throw TAccountInvalidAttributesException();
 
-    // Build query string.
-    char query_str[1024];
-    const char *query_fmt = \
-        "INSERT INTO Accounts (created_at, username, password, first_name, "
-            "last_name) "
-        "VALUES (extract(epoch from now()), '%s', '%s', '%s', '%s') "
-        "RETURNING id, created_at";
-    sprintf(query_str, query_fmt, username.c_str(), password.c_str(),
-        first_name.c_str(), last_name.c_str());
-
     // Execute query.
-    pqxx::connection conn(account_db_conn_str);
-    pqxx::work txn(conn);
+    auto conn = account_db_pool->acquire();
+    pqxx::work txn(*conn);
     pqxx::result db_res;
     try {
-      db_res = txn.exec(query_str);
+      db_res = exec_prepared(txn, "create_account", username, password,
+          first_name, last_name);
     }
     catch (pqxx::sql_error& e) {
       throw TAccountUsernameAlreadyExistsException();
     }
     txn.commit();
-    conn.disconnect();
 
     // Build account (standard mode).
     _return.id = db_res[0][0].as<int>();
@@ -123,20 +171,18 @@ public:
 
   void retrieve_standard_account(TAccount& _return,
       const TRequestMetadata& request_metadata, int32_t account_id) {
-    // Build query string.
-    char query_str[1024];
-    const char *query_fmt = \
-        "SELECT created_at, active, username, first_name, last_name "
-        "FROM Accounts "
-        "WHERE id = %d";
-    sprintf(query_str, query_fmt, account_id);
+    ServerEventHandler::set_request_metadata(request_metadata);
+    // Look up cache.
+    uint64_t ticket;
+    if (account_cache->get(account_id, &_return, &ticket))
+      return;
 
     // Execute query.
-    pqxx::connection conn(account_db_conn_str);
-    pqxx::work txn(conn);
-    pqxx::result db_res(txn.exec(query_str));
+    auto conn = account_db_pool->acquire();
+    pqxx::work txn(*conn);
+    pqxx::result db_res(exec_prepared(txn, "retrieve_standard_account",
+        account_id));
     txn.commit();
-    conn.disconnect();
 
     // Check if account exists.
     if (db_res.begin() == db_res.end())
@@ -149,50 +195,109 @@ public:
     _return.username = db_res[0][2].as<std::string>();
     _return.first_name = db_res[0][3].as<std::string>();
     _return.last_name = db_res[0][4].as<std::string>();
+    account_cache->put(account_id, _return, ticket);
+  }
+
+  void retrieve_standard_accounts(std::map<int32_t, TAccount>& _return,
+      const TRequestMetadata& request_metadata,
+      const std::vector<int32_t>& account_ids) {
+    ServerEventHandler::set_request_metadata(request_metadata);
+    // Look up cache. Only the accounts not found there are queried.
+    std::map<int32_t, uint64_t> missing_ids;
+    for (auto account_id : account_ids) {
+      TAccount account;
+      uint64_t ticket;
+      if (_return.count(account_id) || missing_ids.count(account_id))
+        continue;
+      if (account_cache->get(account_id, &account, &ticket))
+        _return[account_id] = account;
+      else
+        missing_ids[account_id] = ticket;
+    }
+    if (missing_ids.empty())
+      return;
+    std::vector<int32_t> query_ids;
+    for (auto it : missing_ids)
+      query_ids.push_back(it.first);
+
+    // Execute query.
+    auto conn = account_db_pool->acquire();
+    pqxx::work txn(*conn);
+    pqxx::result db_res(exec_prepared(txn, "retrieve_standard_accounts",
+        to_pg_array(query_ids)));
+    txn.commit();
+
+    // Build accounts (standard mode).
+    for (auto row : db_res) {
+      TAccount account;
+      account.id = row["id"].as<int>();
+      account.created_at = row["created_at"].as<int>();
+      account.active = row["active"].as<bool>();
+      account.username = row["username"].as<std::string>();
+      account.first_name = row["first_name"].as<std::string>();
+      account.last_name = row["last_name"].as<std::string>();
+      _return[account.id] = account;
+      account_cache->put(account.id, account, missing_ids[account.id]);
+    }
   }
 
   void retrieve_expanded_account(TAccount& _return,
       const TRequestMetadata& request_metadata, int32_t account_id) {
-    // Retrieve standard account.
+    ServerEventHandler::set_request_metadata(request_metadata);
+    // Retrieve follow, post, and like activity concurrently. Their calls carry
+    // a deadline at most the fan-out timeout away, which bounds how long they
+    // are waited for: calls past it fail like any other downstream call.
+    // Tasks capture their arguments by value because they may outlive this
+    // call if it fails.
+    auto fanout_metadata = request_metadata;
+    auto fanout_deadline_ms = unix_time_ms() + fanout_timeout.count();
+    if (!request_metadata.__isset.deadline_ms ||
+        request_metadata.deadline_ms > fanout_deadline_ms)
+      fanout_metadata.__set_deadline_ms(fanout_deadline_ms);
+    auto follows_you = async_follow_call("follow:check_follow",
+        [=](follow_service::Client& client) {
+          return client.check_follow(fanout_metadata, account_id,
+              request_metadata.requester_id);
+        });
+    auto followed_by_you = async_follow_call("follow:check_follow",
+        [=](follow_service::Client& client) {
+          return client.check_follow(fanout_metadata,
+              request_metadata.requester_id, account_id);
+        });
+    auto n_followers = async_follow_call("follow:count_followers",
+        [=](follow_service::Client& client) {
+          return client.count_followers(fanout_metadata, account_id);
+        });
+    auto n_following = async_follow_call("follow:count_followees",
+        [=](follow_service::Client& client) {
+          return client.count_followees(fanout_metadata, account_id);
+        });
+    auto n_posts = async_post_call("post:count_posts_by_author",
+        [=](post_service::Client& client) {
+          return client.count_posts_by_author(fanout_metadata, account_id);
+        });
+    auto n_likes = async_like_call("like:count_likes_by_account",
+        [=](like_service::Client& client) {
+          return client.count_likes_by_account(fanout_metadata, account_id);
+        });
+
+    // Retrieve standard account meanwhile.
     retrieve_standard_account(_return, request_metadata, account_id);
 
-    // Retrieve follow activity.
-    auto follow_client = get_follow_client();
-    auto follows_you = follow_client->check_follow(request_metadata, account_id,
-        request_metadata.requester_id);
-    auto followed_by_you = follow_client->check_follow(request_metadata,
-        request_metadata.requester_id, account_id);
-    auto n_followers = follow_client->count_followers(request_metadata,
-        account_id);
-    auto n_following = follow_client->count_followees(request_metadata,
-        account_id);
-    follow_client->close();
-
-    // Retrieve post activity.
-    auto post_client = get_post_client();
-    auto n_posts = post_client->count_posts_by_author(request_metadata,
-        account_id);
-    post_client->close();
-
-    // Retrieve like activity.
-    auto like_client = get_like_client();
-    auto n_likes = like_client->count_likes_by_account(request_metadata,
-        account_id);
-    like_client->close();
-
     // Build account (expanded mode).
-    _return.__set_follows_you(follows_you);
-    _return.__set_followed_by_you(followed_by_you);
-    _return.__set_n_followers(n_followers);
-    _return.__set_n_following(n_following);
-    _return.__set_n_posts(n_posts);
-    _return.__set_n_likes(n_likes);
+    _return.__set_follows_you(follows_you.get());
+    _return.__set_followed_by_you(followed_by_you.get());
+    _return.__set_n_followers(n_followers.get());
+    _return.__set_n_following(n_following.get());
+    _return.__set_n_posts(n_posts.get());
+    _return.__set_n_likes(n_likes.get());
   }
 
   void update_account(TAccount& _return,
       const TRequestMetadata& request_metadata, const int32_t account_id,
       const std::string& password, const std::string& first_name,
       const std::string& last_name) {
+    ServerEventHandler::set_request_metadata(request_metadata);
     // Check if requester is authorized.
     if (request_metadata.requester_id != account_id)
       throw TAccountNotAuthorizedException();
@@ -203,22 +308,13 @@ public:
     if (!validate_attributes("john.doe", password, first_name, last_name))
       throw TAccountInvalidAttributesException();
 
-    // Build query string.
-    char query_str[1024];
-    const char *query_fmt = \
-        "UPDATE Accounts "
-        "SET password = '%s', first_name = '%s', last_name = '%s' "
-        "WHERE id = %d "
-        "RETURNING created_at, active, username";
-    sprintf(query_str, query_fmt, password.c_str(), first_name.c_str(),
-        last_name.c_str(), account_id);
-
     // Execute query.
-    pqxx::connection conn(account_db_conn_str);
-    pqxx::work txn(conn);
-    pqxx::result db_res(txn.exec(query_str));
+    auto conn = account_db_pool->acquire();
+    pqxx::work txn(*conn);
+    pqxx::result db_res(exec_prepared(txn, "update_account", password,
+        first_name, last_name, account_id));
     txn.commit();
-    conn.disconnect();
+    account_cache->erase(account_id);
 
     // Check if account exists.
     if (db_res.begin() == db_res.end())
@@ -235,25 +331,17 @@ public:
 
   void delete_account(const TRequestMetadata& request_metadata,
       const int32_t account_id) {
+    ServerEventHandler::set_request_metadata(request_metadata);
     // Check if requester is authorized.
     if (request_metadata.requester_id != account_id)
       throw TAccountNotAuthorizedException();
 
-    // Build query string.
-    char query_str[1024];
-    const char *query_fmt = \
-        "UPDATE Accounts "
-        "SET active = FALSE "
-        "WHERE id = %d "
-        "RETURNING id";
-    sprintf(query_str, query_fmt, account_id);
-
     // Execute query.
-    pqxx::connection conn(account_db_conn_str);
-    pqxx::work txn(conn);
-    pqxx::result db_res(txn.exec(query_str));
+    auto conn = account_db_pool->acquire();
+    pqxx::work txn(*conn);
+    pqxx::result db_res(exec_prepared(txn, "delete_account", account_id));
     txn.commit();
-    conn.disconnect();
+    account_cache->erase(account_id);
 
     // Check if account exists.
     if (db_res.begin() == db_res.end())
@@ -269,6 +357,25 @@ int main(int argc, char** argv) {
       ("host", "", cxxopts::value<std::string>()->default_value("0.0.0.0"))
       ("port", "", cxxopts::value<int>())
       ("threads", "", cxxopts::value<int>())
+      ("server_mode", "", cxxopts::value<std::string>()->default_value(
+          "nonblocking"))
+      ("io_threads", "", cxxopts::value<int>()->default_value("2"))
+      ("client_threads", "", cxxopts::value<int>()->default_value("32"))
+      ("log_queue_size", "", cxxopts::value<int>()->default_value("8192"))
+      ("log_blocking", "", cxxopts::value<bool>()->default_value("false"))
+      ("handler_log", "", cxxopts::value<bool>()->default_value("false"))
+      ("trace_format", "", cxxopts::value<std::string>()->default_value(
+          "text"))
+      ("trace_file_size_mb", "", cxxopts::value<int>()->default_value("64"))
+      ("trace_max_files", "", cxxopts::value<int>()->default_value("8"))
+      ("metrics_port", "", cxxopts::value<int>()->default_value("0"))
+      ("span_sample_rate", "", cxxopts::value<double>()->default_value("0"))
+      ("admission_limit", "", cxxopts::value<int>()->default_value("0"))
+      ("admission_max_limit", "", cxxopts::value<int>()->default_value("1000"))
+      ("fanout_timeout_ms", "", cxxopts::value<int>()->default_value("10000"))
+      ("account_cache_size", "", cxxopts::value<int>()->default_value("10000"))
+      ("account_cache_ttl_ms", "", cxxopts::value<int>()->default_value(
+          "5000"))
       ("backend_filepath", "", cxxopts::value<std::string>()->default_value(
           "/etc/opt/BuzzBlogApp/backend.yml"))
       ("postgres_user", "", cxxopts::value<std::string>()->default_value(
@@ -283,27 +390,66 @@ int main(int argc, char** argv) {
   std::string host = result["host"].as<std::string>();
   int port = result["port"].as<int>();
   int threads = result["threads"].as<int>();
+  std::string server_mode = result["server_mode"].as<std::string>();
+  int io_threads = result["io_threads"].as<int>();
+  int client_threads = result["client_threads"].as<int>();
+  int log_queue_size = result["log_queue_size"].as<int>();
+  bool log_blocking = result["log_blocking"].as<bool>();
+  bool handler_log = result["handler_log"].as<bool>();
+  std::string trace_format = result["trace_format"].as<std::string>();
+  int trace_file_size_mb = result["trace_file_size_mb"].as<int>();
+  int trace_max_files = result["trace_max_files"].as<int>();
+  int metrics_port = result["metrics_port"].as<int>();
+  double span_sample_rate = result["span_sample_rate"].as<double>();
+  int admission_limit = result["admission_limit"].as<int>();
+  int admission_max_limit = result["admission_max_limit"].as<int>();
+  int fanout_timeout_ms = result["fanout_timeout_ms"].as<int>();
+  int account_cache_size = result["account_cache_size"].as<int>();
+  int account_cache_ttl_ms = result["account_cache_ttl_ms"].as<int>();
   std::string backend_filepath = result["backend_filepath"].as<std::string>();
   std::string postgres_user = result["postgres_user"].as<std::string>();
   std::string postgres_password = result["postgres_password"].as<std::string>();
   std::string postgres_dbname = result["postgres_dbname"].as<std::string>();
 
-  // Initialize logger.
-  auto logger = spdlog::basic_logger_mt("logger", "/tmp/calls.log");
-  logger->set_pattern("[%H:%M:%S.%F] pid=%P tid=%t %v");
+  // Initialize loggers. The phases of handled calls are only logged on
+  // request.
+  if (trace_format == "text")
+    init_call_logger("/tmp/calls.log", log_queue_size, log_blocking);
+  else if (trace_format == "binary")
+    init_call_tracer("/tmp/calls.bin", size_t(trace_file_size_mb) << 20,
+        trace_max_files);
+  else
+    throw std::invalid_argument("Invalid trace format: " + trace_format);
+  if (handler_log)
+    init_handler_logger("/tmp/handlers.log", log_blocking);
+
+  // Initialize span collector.
+  if (span_sample_rate > 0)
+    init_span_collector("/tmp/spans.json", "account", span_sample_rate);
+
+  // Initialize admission controller.
+  if (admission_limit > 0)
+    init_admission_controller(admission_limit, admission_max_limit);
+
+  // Initialize executor of asynchronous RPCs.
+  if (client_threads > 0)
+    init_client_executor(client_threads);
+
+  // Serve metrics.
+  if (metrics_port)
+    start_metrics_server(metrics_port);
 
   // Create server.
-  TThreadedServer server(
-      std::make_shared<TAccountServiceProcessor>(
-          std::make_shared<TAccountServiceHandler>(backend_filepath,
-              postgres_user, postgres_password, postgres_dbname)),
-      std::make_shared<TServerSocket>(host, port),
-      std::make_shared<TBufferedTransportFactory>(),
-      std::make_shared<TBinaryProtocolFactory>());
-  server.setConcurrentClientLimit(threads);
+  auto processor = std::make_shared<TAccountServiceProcessor>(
+      std::make_shared<TAccountServiceHandler>(backend_filepath,
+          postgres_user, postgres_password, postgres_dbname,
+          fanout_timeout_ms, account_cache_size, account_cache_ttl_ms));
+  processor->setEventHandler(std::make_shared<ServerEventHandler>());
+  auto server = make_server(server_mode, processor, host, port, threads,
+      io_threads);
 
   // Serve requests.
-  server.serve();
+  server->serve();
 
   return 0;
 }
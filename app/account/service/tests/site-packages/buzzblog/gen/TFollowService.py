@@ -136,6 +136,8 @@ class Client(Iface):
             return result.success
         if result.e is not None:
             raise result.e
+        if result.overloaded is not None:
+            raise result.overloaded
         raise TApplicationException(TApplicationException.MISSING_RESULT, "follow_account failed: unknown result")
 
     def retrieve_standard_follow(self, request_metadata, follow_id):
@@ -172,6 +174,8 @@ class Client(Iface):
             return result.success
         if result.e is not None:
             raise result.e
+        if result.overloaded is not None:
+            raise result.overloaded
         raise TApplicationException(TApplicationException.MISSING_RESULT, "retrieve_standard_follow failed: unknown result")
 
     def retrieve_expanded_follow(self, request_metadata, follow_id):
@@ -210,6 +214,8 @@ class Client(Iface):
             raise result.e1
         if result.e2 is not None:
             raise result.e2
+        if result.overloaded is not None:
+            raise result.overloaded
         raise TApplicationException(TApplicationException.MISSING_RESULT, "retrieve_expanded_follow failed: unknown result")
 
     def delete_follow(self, request_metadata, follow_id):
@@ -246,6 +252,8 @@ class Client(Iface):
             raise result.e1
         if result.e2 is not None:
             raise result.e2
+        if result.overloaded is not None:
+            raise result.overloaded
         return
 
     def list_follows(self, request_metadata, query, limit, offset):
@@ -286,6 +294,8 @@ class Client(Iface):
             return result.success
         if result.e is not None:
             raise result.e
+        if result.overloaded is not None:
+            raise result.overloaded
         raise TApplicationException(TApplicationException.MISSING_RESULT, "list_follows failed: unknown result")
 
     def check_follow(self, request_metadata, follower_id, followee_id):
@@ -322,6 +332,8 @@ class Client(Iface):
         iprot.readMessageEnd()
         if result.success is not None:
             return result.success
+        if result.overloaded is not None:
+            raise result.overloaded
         raise TApplicationException(TApplicationException.MISSING_RESULT, "check_follow failed: unknown result")
 
     def count_followers(self, request_metadata, account_id):
@@ -356,6 +368,8 @@ class Client(Iface):
         iprot.readMessageEnd()
         if result.success is not None:
             return result.success
+        if result.overloaded is not None:
+            raise result.overloaded
         raise TApplicationException(TApplicationException.MISSING_RESULT, "count_followers failed: unknown result")
 
     def count_followees(self, request_metadata, account_id):
@@ -390,6 +404,8 @@ class Client(Iface):
         iprot.readMessageEnd()
         if result.success is not None:
             return result.success
+        if result.overloaded is not None:
+            raise result.overloaded
         raise TApplicationException(TApplicationException.MISSING_RESULT, "count_followees failed: unknown result")
 
 
@@ -440,6 +456,9 @@ class Processor(Iface, TProcessor):
         except TFollowAlreadyExistsException as e:
             msg_type = TMessageType.REPLY
             result.e = e
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -466,6 +485,9 @@ class Processor(Iface, TProcessor):
         except TFollowNotFoundException as e:
             msg_type = TMessageType.REPLY
             result.e = e
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -495,6 +517,9 @@ class Processor(Iface, TProcessor):
         except TAccountNotFoundException as e2:
             msg_type = TMessageType.REPLY
             result.e2 = e2
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -524,6 +549,9 @@ class Processor(Iface, TProcessor):
         except TFollowNotAuthorizedException as e2:
             msg_type = TMessageType.REPLY
             result.e2 = e2
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -550,6 +578,9 @@ class Processor(Iface, TProcessor):
         except TAccountNotFoundException as e:
             msg_type = TMessageType.REPLY
             result.e = e
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -573,6 +604,9 @@ class Processor(Iface, TProcessor):
             msg_type = TMessageType.REPLY
         except TTransport.TTransportException:
             raise
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -596,6 +630,9 @@ class Processor(Iface, TProcessor):
             msg_type = TMessageType.REPLY
         except TTransport.TTransportException:
             raise
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -619,6 +656,9 @@ class Processor(Iface, TProcessor):
             msg_type = TMessageType.REPLY
         except TTransport.TTransportException:
             raise
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -715,13 +755,15 @@ class follow_account_result(object):
     Attributes:
      - success
      - e
+     - overloaded
 
     """
 
 
-    def __init__(self, success=None, e=None,):
+    def __init__(self, success=None, e=None, overloaded=None,):
         self.success = success
         self.e = e
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -744,6 +786,12 @@ class follow_account_result(object):
                     self.e.read(iprot)
                 else:
                     iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -762,6 +810,10 @@ class follow_account_result(object):
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
             self.e.write(oprot)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 2)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -782,6 +834,7 @@ all_structs.append(follow_account_result)
 follow_account_result.thrift_spec = (
     (0, TType.STRUCT, 'success', [TFollow, None], None, ),  # 0
     (1, TType.STRUCT, 'e', [TFollowAlreadyExistsException, None], None, ),  # 1
+    (2, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 2
 )
 
 
@@ -865,13 +918,15 @@ class retrieve_standard_follow_result(object):
     Attributes:
      - success
      - e
+     - overloaded
 
     """
 
 
-    def __init__(self, success=None, e=None,):
+    def __init__(self, success=None, e=None, overloaded=None,):
         self.success = success
         self.e = e
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -894,6 +949,12 @@ class retrieve_standard_follow_result(object):
                     self.e.read(iprot)
                 else:
                     iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -912,6 +973,10 @@ class retrieve_standard_follow_result(object):
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
             self.e.write(oprot)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 2)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -932,6 +997,7 @@ all_structs.append(retrieve_standard_follow_result)
 retrieve_standard_follow_result.thrift_spec = (
     (0, TType.STRUCT, 'success', [TFollow, None], None, ),  # 0
     (1, TType.STRUCT, 'e', [TFollowNotFoundException, None], None, ),  # 1
+    (2, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 2
 )
 
 
@@ -1016,14 +1082,16 @@ class retrieve_expanded_follow_result(object):
      - success
      - e1
      - e2
+     - overloaded
 
     """
 
 
-    def __init__(self, success=None, e1=None, e2=None,):
+    def __init__(self, success=None, e1=None, e2=None, overloaded=None,):
         self.success = success
         self.e1 = e1
         self.e2 = e2
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -1052,6 +1120,12 @@ class retrieve_expanded_follow_result(object):
                     self.e2.read(iprot)
                 else:
                     iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -1074,6 +1148,10 @@ class retrieve_expanded_follow_result(object):
             oprot.writeFieldBegin('e2', TType.STRUCT, 2)
             self.e2.write(oprot)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 3)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -1095,6 +1173,7 @@ retrieve_expanded_follow_result.thrift_spec = (
     (0, TType.STRUCT, 'success', [TFollow, None], None, ),  # 0
     (1, TType.STRUCT, 'e1', [TFollowNotFoundException, None], None, ),  # 1
     (2, TType.STRUCT, 'e2', [TAccountNotFoundException, None], None, ),  # 2
+    (3, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 3
 )
 
 
@@ -1178,13 +1257,15 @@ class delete_follow_result(object):
     Attributes:
      - e1
      - e2
+     - overloaded
 
     """
 
 
-    def __init__(self, e1=None, e2=None,):
+    def __init__(self, e1=None, e2=None, overloaded=None,):
         self.e1 = e1
         self.e2 = e2
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -1207,6 +1288,12 @@ class delete_follow_result(object):
                     self.e2.read(iprot)
                 else:
                     iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -1225,6 +1312,10 @@ class delete_follow_result(object):
             oprot.writeFieldBegin('e2', TType.STRUCT, 2)
             self.e2.write(oprot)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 3)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -1246,6 +1337,7 @@ delete_follow_result.thrift_spec = (
     None,  # 0
     (1, TType.STRUCT, 'e1', [TFollowNotFoundException, None], None, ),  # 1
     (2, TType.STRUCT, 'e2', [TFollowNotAuthorizedException, None], None, ),  # 2
+    (3, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 3
 )
 
 
@@ -1354,13 +1446,15 @@ class list_follows_result(object):
     Attributes:
      - success
      - e
+     - overloaded
 
     """
 
 
-    def __init__(self, success=None, e=None,):
+    def __init__(self, success=None, e=None, overloaded=None,):
         self.success = success
         self.e = e
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -1374,11 +1468,11 @@ class list_follows_result(object):
             if fid == 0:
                 if ftype == TType.LIST:
                     self.success = []
-                    (_etype3, _size0) = iprot.readListBegin()
-                    for _i4 in range(_size0):
-                        _elem5 = TFollow()
-                        _elem5.read(iprot)
-                        self.success.append(_elem5)
+                    (_etype19, _size16) = iprot.readListBegin()
+                    for _i20 in range(_size16):
+                        _elem21 = TFollow()
+                        _elem21.read(iprot)
+                        self.success.append(_elem21)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -1388,6 +1482,12 @@ class list_follows_result(object):
                     self.e.read(iprot)
                 else:
                     iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -1401,14 +1501,18 @@ class list_follows_result(object):
         if self.success is not None:
             oprot.writeFieldBegin('success', TType.LIST, 0)
             oprot.writeListBegin(TType.STRUCT, len(self.success))
-            for iter6 in self.success:
-                iter6.write(oprot)
+            for iter22 in self.success:
+                iter22.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.e is not None:
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
             self.e.write(oprot)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 2)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -1429,6 +1533,7 @@ all_structs.append(list_follows_result)
 list_follows_result.thrift_spec = (
     (0, TType.LIST, 'success', (TType.STRUCT, [TFollow, None], False), None, ),  # 0
     (1, TType.STRUCT, 'e', [TAccountNotFoundException, None], None, ),  # 1
+    (2, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 2
 )
 
 
@@ -1523,12 +1628,14 @@ class check_follow_result(object):
     """
     Attributes:
      - success
+     - overloaded
 
     """
 
 
-    def __init__(self, success=None,):
+    def __init__(self, success=None, overloaded=None,):
         self.success = success
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -1544,6 +1651,12 @@ class check_follow_result(object):
                     self.success = iprot.readBool()
                 else:
                     iprot.skip(ftype)
+            elif fid == 1:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -1558,6 +1671,10 @@ class check_follow_result(object):
             oprot.writeFieldBegin('success', TType.BOOL, 0)
             oprot.writeBool(self.success)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 1)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -1577,6 +1694,7 @@ class check_follow_result(object):
 all_structs.append(check_follow_result)
 check_follow_result.thrift_spec = (
     (0, TType.BOOL, 'success', None, None, ),  # 0
+    (1, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 1
 )
 
 
@@ -1659,12 +1777,14 @@ class count_followers_result(object):
     """
     Attributes:
      - success
+     - overloaded
 
     """
 
 
-    def __init__(self, success=None,):
+    def __init__(self, success=None, overloaded=None,):
         self.success = success
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -1680,6 +1800,12 @@ class count_followers_result(object):
                     self.success = iprot.readI32()
                 else:
                     iprot.skip(ftype)
+            elif fid == 1:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -1694,6 +1820,10 @@ class count_followers_result(object):
             oprot.writeFieldBegin('success', TType.I32, 0)
             oprot.writeI32(self.success)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 1)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -1713,6 +1843,7 @@ class count_followers_result(object):
 all_structs.append(count_followers_result)
 count_followers_result.thrift_spec = (
     (0, TType.I32, 'success', None, None, ),  # 0
+    (1, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 1
 )
 
 
@@ -1795,12 +1926,14 @@ class count_followees_result(object):
     """
     Attributes:
      - success
+     - overloaded
 
     """
 
 
-    def __init__(self, success=None,):
+    def __init__(self, success=None, overloaded=None,):
         self.success = success
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -1816,6 +1949,12 @@ class count_followees_result(object):
                     self.success = iprot.readI32()
                 else:
                     iprot.skip(ftype)
+            elif fid == 1:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -1830,6 +1969,10 @@ class count_followees_result(object):
             oprot.writeFieldBegin('success', TType.I32, 0)
             oprot.writeI32(self.success)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 1)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -1849,6 +1992,7 @@ class count_followees_result(object):
 all_structs.append(count_followees_result)
 count_followees_result.thrift_spec = (
     (0, TType.I32, 'success', None, None, ),  # 0
+    (1, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 1
 )
 fix_spec(all_structs)
 del all_structs
@@ -33,6 +33,25 @@ class TestService(unittest.TestCase):
       self.assertEqual(account.first_name, retrieved_account.first_name)
       self.assertEqual(account.last_name, retrieved_account.last_name)
 
+  def test_retrieve_standard_accounts(self):
+    with AccountClient(IP_ADDRESS, PORT) as client:
+      # Create two accounts.
+      accounts = [client.create_account(TRequestMetadata(id="1"),
+          "jane_doe_%s" % i, "strongpasswd", "Jane", "Doe") for i in range(2)]
+      # Retrieve them in one call, with a duplicate and an unknown id.
+      retrieved_accounts = client.retrieve_standard_accounts(
+          TRequestMetadata(id="2", requester_id=accounts[0].id),
+          [accounts[0].id, accounts[1].id, accounts[0].id, -1])
+      self.assertEqual(2, len(retrieved_accounts))
+      for account in accounts:
+        retrieved_account = retrieved_accounts[account.id]
+        self.assertEqual(account.id, retrieved_account.id)
+        self.assertEqual(account.created_at, retrieved_account.created_at)
+        self.assertEqual(account.username, retrieved_account.username)
+      # Retrieve no accounts.
+      self.assertEqual({}, client.retrieve_standard_accounts(
+          TRequestMetadata(id="3"), []))
+
   def test_authenticate_user(self):
     # TODO
     pass
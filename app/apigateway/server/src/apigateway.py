@@ -1,6 +1,7 @@
 # Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
 # Systems
 
+import base64
 import random
 
 import flask
@@ -15,6 +16,21 @@ from buzzblog.post_client import Client as PostClient
 from buzzblog.gen.ttypes import *
 
 
+def wire_format(service):
+  # Wire format of calls to a service, as in 'wire_format.h': servers not in
+  # the "threaded" mode use framed transport unless configured otherwise.
+  server_mode = service.get("server_mode", "nonblocking")
+  protocol = service.get("protocol", "binary")
+  transport = service.get("transport",
+      "buffered" if server_mode == "threaded" else "framed")
+  if protocol not in ["binary", "compact"]:
+    raise ValueError("Invalid protocol: %s" % protocol)
+  if transport not in ["buffered", "framed"]:
+    raise ValueError("Invalid transport: %s" % transport)
+  return {"framed": transport == "framed", "compact": protocol == "compact",
+      "zlib": bool(service.get("zlib", False))}
+
+
 class ThriftClientFactory:
   def __init__(self):
     backend_filename = "/etc/opt/BuzzBlogApp/backend.yml"
@@ -24,22 +40,28 @@ class ThriftClientFactory:
       self._follow_servers = backend["follow"]["service"]
       self._like_servers = backend["like"]["service"]
       self._post_servers = backend["post"]["service"]
+      self._wire_format = {service: wire_format(backend[service])
+          for service in ["account", "follow", "like", "post"]}
 
   def get_account_client(self):
     server = random.choice(self._account_servers)
-    return AccountClient(server.split(':')[0], int(server.split(':')[1]))
+    return AccountClient(server.split(':')[0], int(server.split(':')[1]),
+        **self._wire_format["account"])
 
   def get_follow_client(self):
     server = random.choice(self._follow_servers)
-    return FollowClient(server.split(':')[0], int(server.split(':')[1]))
+    return FollowClient(server.split(':')[0], int(server.split(':')[1]),
+        **self._wire_format["follow"])
 
   def get_like_client(self):
     server = random.choice(self._like_servers)
-    return LikeClient(server.split(':')[0], int(server.split(':')[1]))
+    return LikeClient(server.split(':')[0], int(server.split(':')[1]),
+        **self._wire_format["like"])
 
   def get_post_client(self):
     server = random.choice(self._post_servers)
-    return PostClient(server.split(':')[0], int(server.split(':')[1]))
+    return PostClient(server.split(':')[0], int(server.split(':')[1]),
+        **self._wire_format["post"])
 
 
 def setup_app():
@@ -52,12 +74,37 @@ def setup_logger():
   logger.set_pattern("[%H:%M:%S.%F] pid=%P tid=%t %v")
 
 
+def parse_page(params):
+  # A page starts either at an offset or after a cursor returned with the
+  # previous page. Raises KeyError or ValueError if parameters are invalid.
+  limit = int(params["limit"])
+  if "cursor" in params:
+    created_at, id = base64.urlsafe_b64decode(
+        params["cursor"].encode()).decode().split(":")
+    return (limit, 0, TCursor(created_at=int(created_at), id=int(id)))
+  return (limit, int(params["offset"]), None)
+
+def page_headers(objects, limit):
+  # Full pages carry the cursor of the next page, built from their last object.
+  if not objects or len(objects) < limit:
+    return {}
+  cursor = "{}:{}".format(objects[-1].created_at, objects[-1].id)
+  return {"X-Next-Cursor": base64.urlsafe_b64encode(cursor.encode()).decode()}
+
+
 app = setup_app()
 auth = flask_httpauth.HTTPBasicAuth()
 thrift_client_factory = ThriftClientFactory()
 logger = setup_logger()
 
 
+# Backend servers shed calls they are too overloaded to process. The request
+# was not processed, so clients may retry it later.
+@app.errorhandler(TServerOverloadedException)
+def server_overloaded(e):
+  return ({}, 503, {"Retry-After": "1"})
+
+
 @auth.verify_password
 def verify_password(username, password):
   request_metadata = TRequestMetadata(id=flask.request.args["request_id"])
@@ -66,6 +113,8 @@ def verify_password(username, password):
       account = account_client.authenticate_user(
           request_metadata=request_metadata, username=username,
           password=password)
+    except TServerOverloadedException:
+      raise
     except:
       account = None
   return account
@@ -273,22 +322,22 @@ def list_follows():
       requester_id=auth.current_user().id)
   params = flask.request.get_json()
   try:
-    limit = params["limit"]
-    offset = params["offset"]
-  except KeyError:
+    limit, offset, cursor = parse_page(params)
+  except (KeyError, ValueError):
     return ({}, 400)
   follower_id = int(flask.request.args["follower_id"]) \
       if "follower_id" in flask.request.args else None
   followee_id = int(flask.request.args["followee_id"]) \
       if "followee_id" in flask.request.args else None
-  query = TFollowQuery(follower_id=follower_id, followee_id=followee_id)
+  query = TFollowQuery(follower_id=follower_id, followee_id=followee_id,
+      cursor=cursor)
   with thrift_client_factory.get_follow_client() as follow_client:
     try:
       follows = follow_client.list_follows(request_metadata=request_metadata,
           query=query, limit=limit, offset=offset)
     except TAccountNotFoundException:
       return ({}, 400)
-  return flask.jsonify([{
+  return (flask.jsonify([{
     "object": "follow",
     "mode": "expanded",
     "id": follow.id,
@@ -315,7 +364,7 @@ def list_follows():
       "first_name": follow.followee.first_name,
       "last_name": follow.followee.last_name
     }
-  } for follow in follows])
+  } for follow in follows]), 200, page_headers(follows, limit))
 
 
 @app.route("/post", methods=["POST"])
@@ -401,20 +450,19 @@ def list_posts():
       requester_id=auth.current_user().id)
   params = flask.request.get_json()
   try:
-    limit = params["limit"]
-    offset = params["offset"]
-  except KeyError:
+    limit, offset, cursor = parse_page(params)
+  except (KeyError, ValueError):
     return ({}, 400)
   author_id = int(flask.request.args["author_id"]) \
       if "author_id" in flask.request.args else None
-  query = TPostQuery(author_id=author_id)
+  query = TPostQuery(author_id=author_id, cursor=cursor)
   with thrift_client_factory.get_post_client() as post_client:
     try:
       posts = post_client.list_posts(request_metadata=request_metadata,
           query=query, limit=limit, offset=offset)
     except TAccountNotFoundException:
       return ({}, 400)
-  return flask.jsonify([{
+  return (flask.jsonify([{
     "object": "post",
     "mode": "expanded",
     "id": post.id,
@@ -433,7 +481,7 @@ def list_posts():
       "last_name": post.author.last_name
     },
     "n_likes": post.n_likes
-  } for post in posts])
+  } for post in posts]), 200, page_headers(posts, limit))
 
 
 @app.route("/like", methods=["POST"])
@@ -536,15 +584,14 @@ def list_likes():
       requester_id=auth.current_user().id)
   params = flask.request.get_json()
   try:
-    limit = params["limit"]
-    offset = params["offset"]
-  except KeyError:
+    limit, offset, cursor = parse_page(params)
+  except (KeyError, ValueError):
     return ({}, 400)
   account_id = int(flask.request.args["account_id"]) \
       if "account_id" in flask.request.args else None
   post_id = int(flask.request.args["post_id"]) \
       if "post_id" in flask.request.args else None
-  query = TLikeQuery(account_id=account_id, post_id=post_id)
+  query = TLikeQuery(account_id=account_id, post_id=post_id, cursor=cursor)
   with thrift_client_factory.get_like_client() as like_client:
     try:
       likes = like_client.list_likes(request_metadata=request_metadata,
@@ -553,7 +600,7 @@ def list_likes():
       return ({}, 400)
     except TPostNotFoundException:
       return ({}, 400)
-  return flask.jsonify([{
+  return (flask.jsonify([{
     "object": "like",
     "mode": "expanded",
     "id": like.id,
@@ -590,4 +637,4 @@ def list_likes():
       },
       "n_likes": like.post.n_likes
     }
-  } for like in likes])
+  } for like in likes]), 200, page_headers(likes, limit))
@@ -0,0 +1,307 @@
+// Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
+// Systems
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+
+// Binary trace of RPC calls, a compact alternative to the text log of
+// 'call_logger.h'. Records are copied into memory-mapped files of fixed size;
+// when one is full, the next file is started and the oldest ones are deleted.
+// 'utils/decode_trace.py' converts traces to the text format.
+//
+// Each thread writes into its own block of the current file, so that recording
+// a call takes no lock: only taking a new block does, once every few thousand
+// records. A background thread creates the next file before it is needed, and
+// deletes and unmaps old ones.
+//
+// File layout (little-endian): a 16-byte header followed by blocks. A block
+// starts with its header and holds entries, each starting with its type. The
+// zeroed tail of a block ends it, and the zeroed tail of a file ends it.
+//   header:   char magic[8] = "BBTRACE", uint32 version, uint32 pid
+//   block:    uint8 type = 3, uint8 reserved[3], uint32 size (in bytes,
+//             including this header), then entries.
+//   string:   uint8 type = 2, uint8 kind (1: function, 2: server), uint16 id,
+//             uint16 length, uint16 reserved, then `length` bytes padded to a
+//             multiple of 8. Defines the id of a string used by later calls.
+//   call:     struct TraceCallRecord below.
+// Ids are assigned per block, so every block can be decoded on its own. Blocks
+// of different threads are interleaved, so calls are only ordered by time
+// within a block.
+struct TraceCallRecord {
+  uint8_t type;                 // 1.
+  uint8_t reserved0;
+  uint16_t function_id;
+  uint16_t server_id;
+  uint16_t reserved1;
+  uint32_t tid;
+  uint32_t reserved2;
+  uint64_t timestamp_ns;        // completion time, since the Unix epoch.
+  uint64_t request_id_hash;     // 64-bit FNV-1a hash of the request id.
+  uint64_t latency_ns;
+};
+static_assert(sizeof(TraceCallRecord) == 40,
+    "TraceCallRecord must not be padded");
+
+class CallTracer {
+public:
+  static constexpr uint32_t VERSION = 2;
+  static constexpr size_t BLOCK_SIZE = 64 << 10;
+
+  // Write traces to `filepath`.0, `filepath`.1, ... of `file_size` bytes each,
+  // keeping only the last `max_files` files.
+  CallTracer(const std::string& filepath, size_t file_size, int max_files)
+  : _filepath(filepath),
+    _file_size(file_size),
+    _block_size(std::min(size_t(BLOCK_SIZE), (file_size - 16) & ~size_t(7))),
+    _max_files(max_files),
+    _file_index(-1),
+    _stop(false) {
+    if (file_size < 16 + 8 + sizeof(TraceCallRecord) ||
+        !(_file = create_file()))
+      throw std::runtime_error("Could not create trace file: " + filepath);
+    _rotation_thread = std::thread(&CallTracer::rotate, this);
+  }
+
+  CallTracer(const CallTracer&) = delete;
+  CallTracer& operator=(const CallTracer&) = delete;
+
+  ~CallTracer() {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stop = true;
+    }
+    _rotation_cv.notify_one();
+    _rotation_thread.join();
+  }
+
+  // Record a call to `function` of `server` ("ip:port"). `function` must be a
+  // string literal, as it is interned by address.
+  void record(const std::string& request_id, const char* function,
+      const std::string& server, std::chrono::nanoseconds latency) {
+    TraceCallRecord record;
+    std::memset(&record, 0, sizeof(record));
+    record.type = 1;
+    record.tid = thread_id();
+    record.timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    record.request_id_hash = fnv1a(request_id);
+    record.latency_ns = latency.count();
+    // Take a new block if the record and the definitions it may need do not
+    // fit, so that they end up in the same block.
+    auto& block = thread_block();
+    size_t size = sizeof(record) + string_size(function) +
+        string_size(server.c_str());
+    if (block.owner != this || block.position + size > block.end) {
+      if (size + 8 > _block_size || !next_block(&block))
+        return;
+    }
+    record.function_id = intern(&block, &block.functions, function, 1,
+        function);
+    record.server_id = intern(&block, &block.servers, server, 2,
+        server.c_str());
+    std::memcpy(reserve(&block, sizeof(record)), &record, sizeof(record));
+  }
+
+  static uint64_t fnv1a(const std::string& s) {
+    uint64_t hash = 14695981039346656037ULL;
+    for (unsigned char c : s) {
+      hash ^= c;
+      hash *= 1099511628211ULL;
+    }
+    return hash;
+  }
+
+private:
+  // A memory-mapped trace file, unmapped when the last block in it is done.
+  struct File {
+    File(char* map, size_t size) : map(map), size(size), offset(16) {}
+    ~File() { munmap(map, size); }
+    char* const map;
+    const size_t size;
+    size_t offset;              // of the next free block, under `_mutex`.
+  };
+
+  // The block of the current thread, with the ids of the strings defined in
+  // it.
+  struct Block {
+    const CallTracer* owner = nullptr;
+    std::shared_ptr<File> file;
+    char* position = nullptr;
+    char* end = nullptr;
+    std::unordered_map<const char*, uint16_t> functions;
+    std::unordered_map<std::string, uint16_t> servers;
+  };
+
+  static Block& thread_block() {
+    static thread_local Block block;
+    return block;
+  }
+
+  // Same thread ids as those of the text log.
+  static uint32_t thread_id() {
+    static thread_local uint32_t tid = syscall(SYS_gettid);
+    return tid;
+  }
+
+  // Size of the definition of `str`.
+  static size_t string_size(const char* str) {
+    return 8 + ((std::min(strlen(str), size_t(UINT16_MAX)) + 7) & ~size_t(7));
+  }
+
+  // Return the id of `key` in `block`, writing its definition first if it has
+  // none yet.
+  template <typename K>
+  static uint16_t intern(Block* block, std::unordered_map<K, uint16_t>* ids,
+      const K& key, uint8_t kind, const char* str) {
+    auto it = ids->find(key);
+    if (it != ids->end())
+      return it->second;
+    uint16_t id = ids->size();
+    uint16_t length = std::min(strlen(str), size_t(UINT16_MAX));
+    uint8_t header[8] = {2, kind, uint8_t(id), uint8_t(id >> 8),
+        uint8_t(length), uint8_t(length >> 8), 0, 0};
+    char* dst = reserve(block, string_size(str));
+    std::memcpy(dst, header, sizeof(header));
+    std::memcpy(dst + sizeof(header), str, length);
+    ids->emplace(key, id);
+    return id;
+  }
+
+  // Reserve `size` bytes of `block`, which must have room for them.
+  static char* reserve(Block* block, size_t size) {
+    char* dst = block->position;
+    block->position += size;
+    return dst;
+  }
+
+  // Give `block` a new block of the current file, switching to the next file
+  // if it is full. If the next file is not ready yet, records are dropped until
+  // it is.
+  bool next_block(Block* block) {
+    std::shared_ptr<File> previous_file = std::move(block->file);
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (previous_file)
+      _retired_files.push_back(std::move(previous_file));
+    if (_file->offset + _block_size > _file->size) {
+      if (!_next_file) {
+        block->owner = nullptr;
+        return false;
+      }
+      _retired_files.push_back(std::move(_file));
+      _file = std::move(_next_file);
+      _rotation_cv.notify_one();
+    }
+    char* start = _file->map + _file->offset;
+    _file->offset += _block_size;
+    block->owner = this;
+    block->file = _file;
+    lock.unlock();
+    uint32_t header[2] = {3, uint32_t(_block_size)};
+    std::memcpy(start, header, sizeof(header));
+    block->position = start + sizeof(header);
+    block->end = start + _block_size;
+    block->functions.clear();
+    block->servers.clear();
+    return true;
+  }
+
+  // Body of the rotation thread: keep the next file ready, and unmap files
+  // whose blocks are all done. Files that cannot be created are retried every
+  // second.
+  void rotate() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (!_stop) {
+      std::vector<std::shared_ptr<File>> retired_files;
+      retired_files.swap(_retired_files);
+      bool create = !_next_file;
+      lock.unlock();
+      retired_files.clear();
+      std::shared_ptr<File> file;
+      if (create)
+        file = create_file();
+      lock.lock();
+      if (file)
+        _next_file = std::move(file);
+      if (_stop)
+        break;
+      if (create && !_next_file)
+        _rotation_cv.wait_for(lock, std::chrono::seconds(1));
+      else
+        _rotation_cv.wait(lock);
+    }
+  }
+
+  // Create the next file, deleting the oldest one. Only called by the
+  // constructor and then by the rotation thread.
+  std::shared_ptr<File> create_file() {
+    _file_index++;
+    if (_file_index >= _max_files)
+      unlink(file_path(_file_index - _max_files).c_str());
+    std::string path = file_path(_file_index);
+    int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+      return nullptr;
+    void* map = MAP_FAILED;
+    if (ftruncate(fd, _file_size) == 0)
+      map = mmap(nullptr, _file_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd,
+          0);
+    close(fd);
+    if (map == MAP_FAILED)
+      return nullptr;
+    auto file = std::make_shared<File>(static_cast<char*>(map), _file_size);
+    // Write header.
+    uint32_t header[2] = {VERSION, uint32_t(getpid())};
+    std::memcpy(file->map, "BBTRACE", 8);
+    std::memcpy(file->map + 8, header, sizeof(header));
+    return file;
+  }
+
+  std::string file_path(int index) const {
+    return _filepath + "." + std::to_string(index);
+  }
+
+  const std::string _filepath;
+  const size_t _file_size;
+  const size_t _block_size;
+  const int _max_files;
+  int _file_index;
+  std::mutex _mutex;
+  std::condition_variable _rotation_cv;
+  bool _stop;
+  std::shared_ptr<File> _file;
+  std::shared_ptr<File> _next_file;
+  std::vector<std::shared_ptr<File>> _retired_files;
+  std::thread _rotation_thread;
+};
+
+// The tracer of RPC calls, or null if calls are logged as text.
+inline CallTracer*& call_tracer() {
+  static CallTracer* tracer = nullptr;
+  return tracer;
+}
+
+// Create the tracer of RPC calls. From then on, clients write binary records
+// instead of text log messages. The tracer lives until the process exits.
+inline CallTracer* init_call_tracer(const std::string& filepath,
+    size_t file_size, int max_files) {
+  call_tracer() = new CallTracer(filepath, file_size, max_files);
+  return call_tracer();
+}
@@ -0,0 +1,77 @@
+// Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
+// Systems
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+// A fixed number of threads running submitted tasks in FIFO order. Handlers use
+// it to issue independent downstream RPCs concurrently.
+class Executor {
+public:
+  explicit Executor(int n_threads)
+  : _stop(false) {
+    for (int i = 0; i < n_threads; i++)
+      _threads.emplace_back([this] { run(); });
+  }
+
+  Executor(const Executor&) = delete;
+  Executor& operator=(const Executor&) = delete;
+
+  ~Executor() {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stop = true;
+    }
+    _cv.notify_all();
+    for (auto& thread : _threads)
+      thread.join();
+  }
+
+  // Schedule `task` and return a future holding its result or the exception
+  // it threw.
+  template <typename F>
+  auto submit(F&& task) -> std::future<decltype(task())> {
+    using R = decltype(task());
+    auto packaged_task = std::make_shared<std::packaged_task<R()>>(
+        std::forward<F>(task));
+    auto future = packaged_task->get_future();
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _tasks.push_back([packaged_task] { (*packaged_task)(); });
+    }
+    _cv.notify_one();
+    return future;
+  }
+
+private:
+  void run() {
+    while (true) {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv.wait(lock, [this] { return _stop || !_tasks.empty(); });
+        if (_tasks.empty())
+          return;
+        task = std::move(_tasks.front());
+        _tasks.pop_front();
+      }
+      task();
+    }
+  }
+
+  bool _stop;
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  std::deque<std::function<void()>> _tasks;
+  std::vector<std::thread> _threads;
+};
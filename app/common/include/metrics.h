@@ -0,0 +1,230 @@
+// Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
+// Systems
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+
+// Metrics are recorded into a fixed number of shards. Each thread always
+// writes to the same shard, so threads rarely share cache lines, and shards are
+// merged when metrics are scraped. Shards are not allocated per thread because
+// threaded servers start a thread per connection.
+namespace metrics_detail {
+
+const int N_SHARDS = 16;
+
+inline int shard_index() {
+  static std::atomic<int> next_index(0);
+  static thread_local int index = next_index++ % N_SHARDS;
+  return index;
+}
+
+// Format a number as Prometheus expects it.
+inline std::string format(double value) {
+  char buf[32];
+  snprintf(buf, sizeof(buf), "%.9g", value);
+  return buf;
+}
+
+}  // namespace metrics_detail
+
+// A monotonically increasing count. Increments are lock-free.
+class Counter {
+public:
+  Counter() {
+    for (auto& shard : _shards)
+      shard.value = 0;
+  }
+
+  void increment(uint64_t n = 1) {
+    _shards[metrics_detail::shard_index()].value.fetch_add(n,
+        std::memory_order_relaxed);
+  }
+
+  uint64_t value() const {
+    uint64_t value = 0;
+    for (const auto& shard : _shards)
+      value += shard.value.load(std::memory_order_relaxed);
+    return value;
+  }
+
+private:
+  struct alignas(64) Shard {
+    std::atomic<uint64_t> value;
+  };
+
+  std::array<Shard, metrics_detail::N_SHARDS> _shards;
+};
+
+// A histogram of latencies with log-linear buckets, as in HDR histograms: every
+// power of two between 1.024us and 137s is split into 4 buckets, so values are
+// bucketed with a relative error below 25%. Recording is lock-free.
+class Histogram {
+public:
+  static const int SUB_BUCKET_BITS = 2;
+  static const int MIN_EXPONENT = 10;
+  static const int MAX_EXPONENT = 37;
+  // A bucket below 2^MIN_EXPONENT ns, the log-linear buckets, and one above
+  // 2^MAX_EXPONENT ns.
+  static const int N_BUCKETS =
+      ((MAX_EXPONENT - MIN_EXPONENT) << SUB_BUCKET_BITS) + 2;
+
+  Histogram() {
+    for (auto& shard : _shards) {
+      for (auto& count : shard.counts)
+        count = 0;
+      shard.sum_ns = 0;
+    }
+  }
+
+  void record(std::chrono::nanoseconds latency) {
+    uint64_t value = latency.count() > 0 ? latency.count() : 0;
+    auto& shard = _shards[metrics_detail::shard_index()];
+    shard.counts[bucket(value)].fetch_add(1, std::memory_order_relaxed);
+    shard.sum_ns.fetch_add(value, std::memory_order_relaxed);
+  }
+
+  // Upper bound of bucket `i`, in ns. The last bucket is unbounded.
+  static uint64_t upper_bound(int i) {
+    if (i == 0)
+      return uint64_t(1) << MIN_EXPONENT;
+    int exponent = MIN_EXPONENT + ((i - 1) >> SUB_BUCKET_BITS);
+    int sub_bucket = (i - 1) & ((1 << SUB_BUCKET_BITS) - 1);
+    return (uint64_t(1) << exponent) +
+        (uint64_t(sub_bucket + 1) << (exponent - SUB_BUCKET_BITS));
+  }
+
+  // Write the buckets, sum, and count in the Prometheus text format.
+  void write(std::ostream& out, const std::string& name,
+      const std::string& labels) const {
+    std::array<uint64_t, N_BUCKETS> counts{};
+    uint64_t sum_ns = 0;
+    for (const auto& shard : _shards) {
+      for (int i = 0; i < N_BUCKETS; i++)
+        counts[i] += shard.counts[i].load(std::memory_order_relaxed);
+      sum_ns += shard.sum_ns.load(std::memory_order_relaxed);
+    }
+    std::string prefix = labels.empty() ? "" : labels + ",";
+    uint64_t count = 0;
+    for (int i = 0; i < N_BUCKETS; i++) {
+      count += counts[i];
+      out << name << "_bucket{" << prefix << "le=\"" <<
+          (i == N_BUCKETS - 1 ? "+Inf" :
+              metrics_detail::format(upper_bound(i) / 1e9)) <<
+          "\"} " << count << "\n";
+    }
+    out << name << "_sum{" << labels << "} " <<
+        metrics_detail::format(sum_ns / 1e9) << "\n";
+    out << name << "_count{" << labels << "} " << count << "\n";
+  }
+
+private:
+  static int bucket(uint64_t value) {
+    if (value < (uint64_t(1) << MIN_EXPONENT))
+      return 0;
+    int exponent = 63 - __builtin_clzll(value);
+    if (exponent >= MAX_EXPONENT)
+      return N_BUCKETS - 1;
+    int sub_bucket = (value >> (exponent - SUB_BUCKET_BITS)) &
+        ((1 << SUB_BUCKET_BITS) - 1);
+    return 1 + ((exponent - MIN_EXPONENT) << SUB_BUCKET_BITS) + sub_bucket;
+  }
+
+  struct alignas(64) Shard {
+    std::array<std::atomic<uint64_t>, N_BUCKETS> counts;
+    std::atomic<uint64_t> sum_ns;
+  };
+
+  std::array<Shard, metrics_detail::N_SHARDS> _shards;
+};
+
+// The metrics of a process, identified by a name and a set of labels (e.g.,
+// `method="create_post"`). Metrics live until the process exits, so callers
+// may keep the pointers they get.
+class Metrics {
+public:
+  Histogram* histogram(const std::string& name, const std::string& labels) {
+    return get(&_histograms, "histogram", name, labels);
+  }
+
+  Counter* counter(const std::string& name, const std::string& labels) {
+    return get(&_counters, "counter", name, labels);
+  }
+
+  // Export the value returned by `value` at scrape time, as a metric of the
+  // given `type` ("gauge" or "counter").
+  void add_callback(const std::string& type, const std::string& name,
+      const std::string& labels, std::function<double()> value) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _types.emplace(name, type);
+    _callbacks[name][labels] = std::move(value);
+  }
+
+  // All metrics in the Prometheus text format.
+  std::string scrape() {
+    std::ostringstream out;
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (const auto& type : _types) {
+      const auto& name = type.first;
+      out << "# TYPE " << name << " " << type.second << "\n";
+      for (const auto& histogram : _histograms[name])
+        histogram.second->write(out, name, histogram.first);
+      for (const auto& counter : _counters[name])
+        out << name << "{" << counter.first << "} " <<
+            counter.second->value() << "\n";
+      for (const auto& callback : _callbacks[name])
+        out << name << "{" << callback.first << "} " <<
+            metrics_detail::format(callback.second()) << "\n";
+    }
+    return out.str();
+  }
+
+private:
+  template <typename T>
+  using Family = std::map<std::string, std::unique_ptr<T>>;
+
+  // Look up a metric, creating it on first use. Lookups go through a
+  // per-thread cache, so the registry is only locked the first time a thread
+  // uses a metric.
+  template <typename T>
+  T* get(std::map<std::string, Family<T>>* families, const std::string& type,
+      const std::string& name, const std::string& labels) {
+    static thread_local std::unordered_map<std::string, T*> cache;
+    std::string key = name + "{" + labels + "}";
+    auto it = cache.find(key);
+    if (it != cache.end())
+      return it->second;
+    std::lock_guard<std::mutex> lock(_mutex);
+    _types.emplace(name, type);
+    auto& metric = (*families)[name][labels];
+    if (!metric)
+      metric = std::make_unique<T>();
+    cache[key] = metric.get();
+    return metric.get();
+  }
+
+  std::mutex _mutex;
+  std::map<std::string, std::string> _types;
+  std::map<std::string, Family<Histogram>> _histograms;
+  std::map<std::string, Family<Counter>> _counters;
+  std::map<std::string, std::map<std::string, std::function<double()>>>
+      _callbacks;
+};
+
+// The metrics of this process.
+inline Metrics& metrics() {
+  static Metrics metrics;
+  return metrics;
+}
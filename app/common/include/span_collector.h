@@ -0,0 +1,266 @@
+// Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
+// Systems
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <buzzblog/gen/buzzblog_types.h>
+#include <buzzblog/call_tracer.h>
+#include <buzzblog/metrics.h>
+
+
+// Distributed tracing. Every RPC is a client span, made by the caller, and a
+// server span, made by the callee. Spans are linked through the
+// TRequestMetadata passed along with the call:
+// - `span_id`: the client span of the call;
+// - `parent_span_id`: the span of the caller, i.e., the server span of the
+//   call it is handling;
+// - `sampled`: whether spans of the request are collected.
+// The id of a server span is derived from the id of its client span, so the
+// spans of the calls a handler makes are children of its server span even
+// though handlers pass on the metadata they received unchanged. Requests whose
+// metadata carries no span id (e.g., from callers that do not trace) are
+// traced from the server span of their first hop, derived from the request id.
+//
+// The trace id is the 64-bit FNV-1a hash of the request id, so every span of a
+// request is found under the same trace, whether or not its callers trace.
+namespace span_detail {
+
+// Mix the bits of `x` (the finalizer of SplitMix64). A span id of 0 means no
+// span, so it is never returned.
+inline uint64_t mix(uint64_t x) {
+  x ^= x >> 30;
+  x *= 0xbf58476d1ce4e5b9ULL;
+  x ^= x >> 27;
+  x *= 0x94d049bb133111ebULL;
+  x ^= x >> 31;
+  return x ? x : 1;
+}
+
+inline std::string hex(uint64_t value, int width = 16) {
+  static const char digits[] = "0123456789abcdef";
+  std::string s(width, '0');
+  for (int i = width - 1; i >= 0 && value; i--, value >>= 4)
+    s[i] = digits[value & 0xf];
+  return s;
+}
+
+inline void append_json_string(std::string* out, const std::string& s) {
+  out->push_back('"');
+  for (unsigned char c : s) {
+    if (c == '"' || c == '\\') {
+      out->push_back('\\');
+      out->push_back(c);
+    }
+    else if (c < 0x20) {
+      char buf[8];
+      snprintf(buf, sizeof(buf), "\\u%04x", c);
+      out->append(buf);
+    }
+    else
+      out->push_back(c);
+  }
+  out->push_back('"');
+}
+
+}  // namespace span_detail
+
+// A new random span id.
+inline uint64_t new_span_id() {
+  static thread_local std::mt19937_64 generator(std::random_device{}());
+  uint64_t id;
+  do
+    id = generator();
+  while (id == 0);
+  return id;
+}
+
+// The server span of the call that carried `request_metadata`.
+inline uint64_t server_span_id(const TRequestMetadata& request_metadata) {
+  return span_detail::mix(request_metadata.__isset.span_id ?
+      uint64_t(request_metadata.span_id) :
+      CallTracer::fnv1a(request_metadata.id));
+}
+
+// A finished span.
+struct Span {
+  enum Kind { SERVER = 2, CLIENT = 3 };   // OTLP span kinds.
+
+  std::string request_id;
+  uint64_t span_id;
+  uint64_t parent_span_id;                // 0 if the span is a root.
+  Kind kind;
+  std::string name;
+  std::string peer;                       // "ip:port" of the callee.
+  std::chrono::system_clock::time_point start;
+  std::chrono::system_clock::time_point end;
+  std::string error;                      // empty if the call succeeded.
+};
+
+// Collects finished spans and exports them in the OTLP JSON format (one
+// `ExportTraceServiceRequest` per line), which the OpenTelemetry Collector
+// reads with its `otlpjsonfile` receiver. Spans are queued and written by a
+// background thread, in batches of up to `batch_size` spans or every second.
+// At most `max_queue_size` spans are queued; further spans are dropped.
+class SpanCollector {
+public:
+  SpanCollector(const std::string& filepath, const std::string& service_name,
+      double sample_rate, int batch_size = 512, int max_queue_size = 65536)
+  : _service_name(service_name),
+    _sample_threshold(sample_rate >= 1.0 ? UINT64_MAX :
+        uint64_t(sample_rate * 18446744073709551616.0)),
+    _batch_size(batch_size),
+    _max_queue_size(max_queue_size),
+    _stop(false),
+    _n_dropped(metrics().counter("buzzblog_spans_dropped_total", "")) {
+    _file = fopen(filepath.c_str(), "a");
+    if (!_file)
+      throw std::runtime_error("Could not open span file: " + filepath);
+    _thread = std::thread([this] { run(); });
+  }
+
+  SpanCollector(const SpanCollector&) = delete;
+  SpanCollector& operator=(const SpanCollector&) = delete;
+
+  ~SpanCollector() {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _stop = true;
+    }
+    _cv.notify_one();
+    _thread.join();
+    fclose(_file);
+  }
+
+  // Whether spans of the request are collected. Callers may have decided it
+  // already; otherwise, the decision is made from the request id, so that
+  // every hop of a request makes the same one.
+  bool sampled(const TRequestMetadata& request_metadata) const {
+    if (request_metadata.__isset.sampled)
+      return request_metadata.sampled;
+    return span_detail::mix(CallTracer::fnv1a(request_metadata.id)) <
+        _sample_threshold;
+  }
+
+  void record(Span&& span) {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (int(_queue.size()) >= _max_queue_size) {
+        _n_dropped->increment();
+        return;
+      }
+      _queue.push_back(std::move(span));
+      if (int(_queue.size()) < _batch_size)
+        return;
+    }
+    _cv.notify_one();
+  }
+
+private:
+  void run() {
+    std::vector<Span> batch;
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cv.wait_for(lock, std::chrono::seconds(1), [this] {
+          return _stop || int(_queue.size()) >= _batch_size;
+        });
+        batch.swap(_queue);
+      }
+      if (!batch.empty()) {
+        auto line = to_json(batch);
+        fwrite(line.data(), 1, line.size(), _file);
+        fflush(_file);
+        batch.clear();
+      }
+      std::lock_guard<std::mutex> lock(_mutex);
+      if (_stop && _queue.empty())
+        return;
+    }
+  }
+
+  std::string to_json(const std::vector<Span>& spans) const {
+    using span_detail::append_json_string;
+    using span_detail::hex;
+    std::string out = "{\"resourceSpans\":[{\"resource\":{\"attributes\":["
+        "{\"key\":\"service.name\",\"value\":{\"stringValue\":";
+    append_json_string(&out, _service_name);
+    out += "}}]},\"scopeSpans\":[{\"scope\":{\"name\":\"buzzblog\"},"
+        "\"spans\":[";
+    for (size_t i = 0; i < spans.size(); i++) {
+      const auto& span = spans[i];
+      out += i ? ",{" : "{";
+      out += "\"traceId\":\"" + hex(0) +
+          hex(CallTracer::fnv1a(span.request_id)) + "\"";
+      out += ",\"spanId\":\"" + hex(span.span_id) + "\"";
+      if (span.parent_span_id)
+        out += ",\"parentSpanId\":\"" + hex(span.parent_span_id) + "\"";
+      out += ",\"name\":";
+      append_json_string(&out, span.name);
+      out += ",\"kind\":" + std::to_string(span.kind);
+      out += ",\"startTimeUnixNano\":\"" + unix_nanos(span.start) + "\"";
+      out += ",\"endTimeUnixNano\":\"" + unix_nanos(span.end) + "\"";
+      out += ",\"attributes\":[{\"key\":\"buzzblog.request_id\","
+          "\"value\":{\"stringValue\":";
+      append_json_string(&out, span.request_id);
+      out += "}}";
+      if (!span.peer.empty()) {
+        out += ",{\"key\":\"server.address\",\"value\":{\"stringValue\":";
+        append_json_string(&out, span.peer);
+        out += "}}";
+      }
+      out += "]";
+      if (!span.error.empty()) {
+        out += ",\"status\":{\"code\":2,\"message\":";
+        append_json_string(&out, span.error);
+        out += "}";
+      }
+      out += "}";
+    }
+    out += "]}]}]}\n";
+    return out;
+  }
+
+  static std::string unix_nanos(std::chrono::system_clock::time_point time) {
+    return std::to_string(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        time.time_since_epoch()).count());
+  }
+
+  const std::string _service_name;
+  const uint64_t _sample_threshold;
+  const int _batch_size;
+  const int _max_queue_size;
+  FILE* _file;
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  bool _stop;
+  std::vector<Span> _queue;
+  Counter* _n_dropped;
+  std::thread _thread;
+};
+
+// The collector of spans, or null if this process does not trace.
+inline SpanCollector*& span_collector() {
+  static SpanCollector* collector = nullptr;
+  return collector;
+}
+
+// Create the collector of spans of the service `service_name`, sampling a
+// `sample_rate` fraction of the requests whose callers did not decide it. The
+// collector lives until the process exits.
+inline SpanCollector* init_span_collector(const std::string& filepath,
+    const std::string& service_name, double sample_rate) {
+  span_collector() = new SpanCollector(filepath, service_name, sample_rate);
+  return span_collector();
+}
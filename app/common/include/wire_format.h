@@ -0,0 +1,374 @@
+// Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
+// Systems
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <thrift/TProcessor.h>
+#include <thrift/protocol/TBinaryProtocol.h>
+#include <thrift/protocol/TCompactProtocol.h>
+#include <thrift/protocol/TVirtualProtocol.h>
+#include <thrift/transport/TBufferTransports.h>
+#include <thrift/transport/TTransportException.h>
+#include <thrift/transport/TVirtualTransport.h>
+#include <thrift/transport/TZlibTransport.h>
+
+#include <buzzblog/metrics.h>
+
+
+// Wire format of the RPCs to a service, chosen by its clients:
+// - `compact`: compact protocol, which encodes integers and field headers in
+//   fewer bytes, instead of binary protocol.
+// - `framed`: framed transport, required by servers in the "nonblocking" mode,
+//   instead of buffered transport.
+// - `zlib`: zlib compression of the stream, which pays off for large lists of
+//   expanded objects over slow links. Servers in the "nonblocking" mode do not
+//   support it.
+// Servers detect the format of each connection (see `NegotiatingTransport`),
+// so that clients can switch formats one at a time.
+struct WireFormat {
+  bool compact = false;
+  bool framed = false;
+  bool zlib = false;
+
+  std::string name() const {
+    return std::string(compact ? "compact" : "binary") +
+        (framed ? "/framed" : "/buffered") + (zlib ? "/zlib" : "");
+  }
+};
+
+// Build the wire format of RPCs to servers in `server_mode` from a service's
+// configuration: `protocol` is "binary" or "compact", and `transport` is
+// "buffered", "framed", or empty to use framed transport with servers not in
+// the "threaded" mode.
+inline WireFormat parse_wire_format(const std::string& server_mode,
+    const std::string& protocol, const std::string& transport, bool zlib) {
+  WireFormat format;
+  if (protocol != "binary" && protocol != "compact")
+    throw std::invalid_argument("Invalid protocol: " + protocol);
+  format.compact = protocol == "compact";
+  if (!transport.empty() && transport != "buffered" && transport != "framed")
+    throw std::invalid_argument("Invalid transport: " + transport);
+  format.framed = transport.empty() ? server_mode != "threaded" :
+      transport == "framed";
+  format.zlib = zlib;
+  if (server_mode == "nonblocking" && (!format.framed || format.zlib))
+    throw std::invalid_argument("Servers in the \"nonblocking\" mode require "
+        "framed transport without zlib");
+  return format;
+}
+
+// Build the transport of a client connected by `socket`.
+inline std::shared_ptr<apache::thrift::transport::TTransport> make_transport(
+    const WireFormat& format,
+    std::shared_ptr<apache::thrift::transport::TTransport> socket) {
+  using namespace apache::thrift::transport;
+  std::shared_ptr<TTransport> stream = socket;
+  if (format.zlib)
+    stream = std::make_shared<TZlibTransport>(stream);
+  if (format.framed)
+    return std::make_shared<TFramedTransport>(stream);
+  return std::make_shared<TBufferedTransport>(stream);
+}
+
+template <typename TTransport_>
+std::shared_ptr<apache::thrift::protocol::TProtocol> make_protocol(
+    const WireFormat& format, std::shared_ptr<TTransport_> transport) {
+  using namespace apache::thrift::protocol;
+  if (format.compact)
+    return std::make_shared<TCompactProtocolT<TTransport_>>(transport);
+  return std::make_shared<TBinaryProtocolT<TTransport_>>(transport);
+}
+
+// Build the protocol of `format` over `transport`. Protocols are specialized
+// for the transports of clients and servers, so that they read and write them
+// without virtual calls.
+inline std::shared_ptr<apache::thrift::protocol::TProtocol> make_protocol(
+    const WireFormat& format,
+    std::shared_ptr<apache::thrift::transport::TTransport> transport) {
+  using namespace apache::thrift::transport;
+  if (auto framed = std::dynamic_pointer_cast<TFramedTransport>(transport))
+    return make_protocol(format, framed);
+  if (auto buffered = std::dynamic_pointer_cast<TBufferedTransport>(transport))
+    return make_protocol(format, buffered);
+  if (auto memory = std::dynamic_pointer_cast<TMemoryBuffer>(transport))
+    return make_protocol(format, memory);
+  return make_protocol<TTransport>(format, transport);
+}
+
+// First bytes of a stream in each format. Frames start with their size, whose
+// first byte is 0 for frames smaller than 16 MB, and messages with the id of
+// their protocol (0x80 for the strict binary protocol Thrift writes by
+// default).
+const uint8_t ZLIB_HEADER = 0x78;
+const uint8_t FRAME_HEADER = 0x00;
+const uint8_t COMPACT_PROTOCOL_ID = 0x82;
+
+// Reads from a transport, after returning the bytes that were peeked from it.
+class PeekableTransport :
+    public apache::thrift::transport::TVirtualTransport<PeekableTransport> {
+public:
+  explicit PeekableTransport(
+      std::shared_ptr<apache::thrift::transport::TTransport> transport)
+  : _transport(transport), _position(0) {
+  }
+
+  // Return byte `i` of the stream, reading it if needed.
+  uint8_t byte(size_t i) {
+    using apache::thrift::transport::TTransportException;
+    while (_peeked.size() <= i) {
+      uint8_t buf[8];
+      auto n = _transport->read(buf, sizeof(buf));
+      if (n == 0)
+        throw TTransportException(TTransportException::END_OF_FILE,
+            "No more data to read.");
+      _peeked.insert(_peeked.end(), buf, buf + n);
+    }
+    return _peeked[i];
+  }
+
+  uint32_t read(uint8_t* buf, uint32_t len) {
+    if (_position == _peeked.size())
+      return _transport->read(buf, len);
+    uint32_t n = std::min<size_t>(len, _peeked.size() - _position);
+    std::memcpy(buf, &_peeked[_position], n);
+    _position += n;
+    return n;
+  }
+
+  void write(const uint8_t* buf, uint32_t len) {
+    _transport->write(buf, len);
+  }
+
+  bool isOpen() override {
+    return _transport->isOpen();
+  }
+
+  bool peek() override {
+    return _position < _peeked.size() || _transport->peek();
+  }
+
+  void close() override {
+    _transport->close();
+  }
+
+  void flush() override {
+    _transport->flush();
+  }
+
+private:
+  std::shared_ptr<apache::thrift::transport::TTransport> _transport;
+  std::vector<uint8_t> _peeked;
+  size_t _position;
+};
+
+// Transport of a server connection that detects the wire format of the
+// client from the first bytes it sends: zlib compression, then framed or
+// buffered transport, then the protocol of the first message. Detection reads
+// from the connection, so it happens on the first read, in the thread that
+// serves the connection rather than in the one that accepts connections.
+class NegotiatingTransport :
+    public apache::thrift::transport::TVirtualTransport<NegotiatingTransport> {
+public:
+  explicit NegotiatingTransport(
+      std::shared_ptr<apache::thrift::transport::TTransport> socket)
+  : _socket(socket) {
+  }
+
+  const std::shared_ptr<apache::thrift::transport::TTransport>& socket() const {
+    return _socket;
+  }
+
+  // The format of the client, detected on the first call.
+  const WireFormat& format() {
+    negotiate();
+    return _format;
+  }
+
+  // The framed or buffered transport of the connection, for protocols to read
+  // and write without going through this one.
+  const std::shared_ptr<apache::thrift::transport::TTransport>& transport() {
+    negotiate();
+    return _transport;
+  }
+
+  uint32_t read(uint8_t* buf, uint32_t len) {
+    return transport()->read(buf, len);
+  }
+
+  void write(const uint8_t* buf, uint32_t len) {
+    transport()->write(buf, len);
+  }
+
+  const uint8_t* borrow(uint8_t* buf, uint32_t* len) {
+    return transport()->borrow(buf, len);
+  }
+
+  void consume(uint32_t len) {
+    transport()->consume(len);
+  }
+
+  bool isOpen() override {
+    return _socket->isOpen();
+  }
+
+  bool peek() override {
+    return _transport ? _transport->peek() : _socket->peek();
+  }
+
+  void close() override {
+    _socket->close();
+  }
+
+  void flush() override {
+    if (_transport)
+      _transport->flush();
+  }
+
+  uint32_t readEnd() override {
+    return _transport ? _transport->readEnd() : 0;
+  }
+
+  uint32_t writeEnd() override {
+    return _transport ? _transport->writeEnd() : 0;
+  }
+
+  const std::string getOrigin() override {
+    return _socket->getOrigin();
+  }
+
+private:
+  void negotiate() {
+    using namespace apache::thrift::transport;
+    if (_transport)
+      return;
+    auto stream = std::make_shared<PeekableTransport>(_socket);
+    if (stream->byte(0) == ZLIB_HEADER) {
+      _format.zlib = true;
+      stream = std::make_shared<PeekableTransport>(
+          std::make_shared<TZlibTransport>(stream));
+    }
+    _format.framed = stream->byte(0) == FRAME_HEADER;
+    _format.compact = stream->byte(_format.framed ? 4 : 0) ==
+        COMPACT_PROTOCOL_ID;
+    if (_format.framed)
+      _transport = std::make_shared<TFramedTransport>(stream);
+    else
+      _transport = std::make_shared<TBufferedTransport>(stream);
+    metrics().counter("buzzblog_server_connections_total",
+        "wire_format=\"" + _format.name() + "\"")->increment();
+  }
+
+  std::shared_ptr<apache::thrift::transport::TTransport> _socket;
+  std::shared_ptr<apache::thrift::transport::TTransport> _transport;
+  WireFormat _format;
+};
+
+// Servers ask the transport factory twice for each connection, once for input
+// and once for output. Both get the same transport, so that responses are
+// written in the format of requests.
+class NegotiatingTransportFactory :
+    public apache::thrift::transport::TTransportFactory {
+public:
+  std::shared_ptr<apache::thrift::transport::TTransport> getTransport(
+      std::shared_ptr<apache::thrift::transport::TTransport> socket)
+      override {
+    // Connections are accepted by a single thread.
+    auto transport = _last.lock();
+    if (!transport || transport->socket() != socket) {
+      transport = std::make_shared<NegotiatingTransport>(socket);
+      _last = transport;
+    }
+    return transport;
+  }
+
+private:
+  std::weak_ptr<NegotiatingTransport> _last;
+};
+
+// Protocol given to servers for each connection, before its wire format is
+// known. It is never read or written: on the first call of the connection,
+// `NegotiatingProcessor` replaces it with a binary or compact protocol over the
+// transport of the connection, which processors then use directly.
+class NegotiatingProtocol :
+    public apache::thrift::protocol::TVirtualProtocol<NegotiatingProtocol> {
+public:
+  explicit NegotiatingProtocol(
+      std::shared_ptr<apache::thrift::transport::TTransport> transport)
+  : TVirtualProtocol<NegotiatingProtocol>(transport) {
+  }
+
+  // The protocol that replaces this one, once the connection negotiated.
+  std::shared_ptr<apache::thrift::protocol::TProtocol> negotiated;
+};
+
+class NegotiatingProtocolFactory :
+    public apache::thrift::protocol::TProtocolFactory {
+public:
+  std::shared_ptr<apache::thrift::protocol::TProtocol> getProtocol(
+      std::shared_ptr<apache::thrift::transport::TTransport> transport)
+      override {
+    return std::make_shared<NegotiatingProtocol>(transport);
+  }
+};
+
+// Processor that detects the protocol of each connection on its first call, and
+// processes calls with binary or compact protocols built then. Negotiating
+// transports (those of threaded servers) detect the format of the connection
+// as they are first read, and protocols then read and write through their
+// framed or buffered transport. Other transports (those of nonblocking
+// servers) hold whole frames in memory, so the first byte of a message can be
+// peeked.
+class NegotiatingProcessor : public apache::thrift::TProcessor {
+public:
+  explicit NegotiatingProcessor(
+      std::shared_ptr<apache::thrift::TProcessor> processor)
+  : _processor(processor) {
+  }
+
+  bool process(std::shared_ptr<apache::thrift::protocol::TProtocol> in,
+      std::shared_ptr<apache::thrift::protocol::TProtocol> out,
+      void* connection_context) override {
+    auto input = static_cast<NegotiatingProtocol*>(in.get());
+    auto output = static_cast<NegotiatingProtocol*>(out.get());
+    if (!input->negotiated)
+      negotiate(input, output);
+    return _processor->process(input->negotiated, output->negotiated,
+        connection_context);
+  }
+
+private:
+  static void negotiate(NegotiatingProtocol* input,
+      NegotiatingProtocol* output) {
+    using namespace apache::thrift::transport;
+    auto input_transport = input->getTransport();
+    auto output_transport = output->getTransport();
+    WireFormat format;
+    if (auto negotiating =
+        std::dynamic_pointer_cast<NegotiatingTransport>(input_transport)) {
+      format = negotiating->format();
+      input_transport = negotiating->transport();
+    }
+    else {
+      uint32_t len = 1;
+      auto buf = input_transport->borrow(nullptr, &len);
+      format.framed = true;
+      format.compact = buf && buf[0] == COMPACT_PROTOCOL_ID;
+    }
+    if (auto negotiating =
+        std::dynamic_pointer_cast<NegotiatingTransport>(output_transport))
+      output_transport = negotiating->transport();
+    input->negotiated = make_protocol(format, input_transport);
+    output->negotiated = input == output ? input->negotiated :
+        make_protocol(format, output_transport);
+  }
+
+  std::shared_ptr<apache::thrift::TProcessor> _processor;
+};
@@ -15,6 +15,20 @@ namespace py gen
 struct TRequestMetadata {
   1: required string id;          // unique request id.
   2: optional i32 requester_id;   // id of the account making the request.
+  3: optional i64 span_id;        // id of the client span of this call.
+  4: optional i64 parent_span_id; // id of the span of the caller.
+  5: optional bool sampled;       // whether spans of the request are kept.
+  6: optional i64 deadline_ms;    // time after which the caller gives up, in
+                                  // ms since the Unix epoch.
+}
+
+// Position after which a list of results in reverse chronological order
+// resumes, taken from the last result of the previous page. When a query
+// carries a cursor, the `offset` of the call is ignored: results are fetched
+// right after the cursor.
+struct TCursor {
+  1: required i32 created_at;     // creation time of the last result fetched.
+  2: required i32 id;             // id of the last result fetched.
 }
 
 struct TAccount {
@@ -50,6 +64,7 @@ struct TFollow {
 struct TFollowQuery {
   1: optional i32 follower_id;
   2: optional i32 followee_id;
+  3: optional TCursor cursor;     // fetch results after this one.
 }
 
 struct TPost {
@@ -67,6 +82,7 @@ struct TPost {
 
 struct TPostQuery {
   1: optional i32 author_id;
+  2: optional TCursor cursor;     // fetch results after this one.
 }
 
 struct TLike {
@@ -84,6 +100,7 @@ struct TLike {
 struct TLikeQuery {
   1: optional i32 account_id;
   2: optional i32 post_id;
+  3: optional TCursor cursor;     // fetch results after this one.
 }
 
 struct TUniquepair {
@@ -98,6 +115,7 @@ struct TUniquepairQuery {
   1: required string domain;
   2: optional i32 first_elem;
   3: optional i32 second_elem;
+  4: optional TCursor cursor;     // fetch results after this one.
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -159,6 +177,12 @@ exception TUniquepairNotFoundException {
 exception TUniquepairAlreadyExistsException {
 }
 
+// Raised by servers that shed a call because they are overloaded (see
+// 'admission_controller.h'). The call was not processed, so it may be retried,
+// preferably on another server.
+exception TServerOverloadedException {
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
@@ -178,7 +202,8 @@ service TAccountService {
   TAccount authenticate_user (1:TRequestMetadata request_metadata,
       2:string username, 3:string password)
       throws (1:TAccountInvalidCredentialsException e1,
-              2:TAccountDeactivatedException e2);
+              2:TAccountDeactivatedException e2,
+              3:TServerOverloadedException overloaded);
 
   /* Params:
    *   1. request_metadata: request metadata.
@@ -193,7 +218,8 @@ service TAccountService {
       2:string username, 3:string password, 4:string first_name,
       5:string last_name)
       throws (1:TAccountInvalidAttributesException e1,
-              2:TAccountUsernameAlreadyExistsException e2);
+              2:TAccountUsernameAlreadyExistsException e2,
+              3:TServerOverloadedException overloaded);
 
   /* Params:
    *   1. request_metadata: request metadata.
@@ -203,7 +229,19 @@ service TAccountService {
    */
   TAccount retrieve_standard_account (1:TRequestMetadata request_metadata,
       2:i32 account_id)
-      throws (1:TAccountNotFoundException e);
+      throws (1:TAccountNotFoundException e,
+              2:TServerOverloadedException overloaded);
+
+  /* Params:
+   *   1. request_metadata: request metadata.
+   *   2. account_ids: ids of the accounts to be retrieved.
+   * Returns:
+   *   A map from id to account (standard mode) of the provided ids that match
+   *   an account. Ids that do not match an account are left out.
+   */
+  map<i32, TAccount> retrieve_standard_accounts (
+      1:TRequestMetadata request_metadata, 2:list<i32> account_ids)
+      throws (1:TServerOverloadedException overloaded);
 
   /* Params:
    *   1. request_metadata: request metadata.
@@ -213,7 +251,8 @@ service TAccountService {
    */
   TAccount retrieve_expanded_account (1:TRequestMetadata request_metadata,
       2:i32 account_id)
-      throws (1:TAccountNotFoundException e);
+      throws (1:TAccountNotFoundException e,
+              2:TServerOverloadedException overloaded);
 
   /* Params:
    *   1. request_metadata: request metadata.
@@ -229,7 +268,8 @@ service TAccountService {
       5:string last_name)
       throws (1:TAccountNotAuthorizedException e1,
               2:TAccountInvalidAttributesException e2,
-              3:TAccountNotFoundException e3);
+              3:TAccountNotFoundException e3,
+              4:TServerOverloadedException overloaded);
 
   /* Params:
    *   1. request_metadata: request metadata.
@@ -237,7 +277,8 @@ service TAccountService {
    */
   void delete_account (1:TRequestMetadata request_metadata, 2:i32 account_id)
       throws (1:TAccountNotAuthorizedException e1,
-              2:TAccountNotFoundException e2);
+              2:TAccountNotFoundException e2,
+              3:TServerOverloadedException overloaded);
 }
 
 service TFollowService {
@@ -248,7 +289,8 @@ service TFollowService {
    *   The newly created follow (standard mode).
    */
   TFollow follow_account (1:TRequestMetadata request_metadata, 2:i32 account_id)
-      throws (1:TFollowAlreadyExistsException e);
+      throws (1:TFollowAlreadyExistsException e,
+              2:TServerOverloadedException overloaded);
 
   /* Params:
    *   1. request_metadata: request metadata.
@@ -258,7 +300,8 @@ service TFollowService {
    */
   TFollow retrieve_standard_follow (1:TRequestMetadata request_metadata,
       2:i32 follow_id)
-      throws (1:TFollowNotFoundException e);
+      throws (1:TFollowNotFoundException e,
+              2:TServerOverloadedException overloaded);
 
   /* Params:
    *   1. request_metadata: request metadata.
@@ -269,7 +312,8 @@ service TFollowService {
   TFollow retrieve_expanded_follow (1:TRequestMetadata request_metadata,
       2:i32 follow_id)
       throws (1:TFollowNotFoundException e1,
-              2:TAccountNotFoundException e2);
+              2:TAccountNotFoundException e2,
+              3:TServerOverloadedException overloaded);
 
   /* Params:
    *   1. request_metadata: request metadata.
@@ -277,19 +321,23 @@ service TFollowService {
    */
   void delete_follow (1:TRequestMetadata request_metadata, 2:i32 follow_id)
       throws (1:TFollowNotFoundException e1,
-              2:TFollowNotAuthorizedException e2);
+              2:TFollowNotAuthorizedException e2,
+              3:TServerOverloadedException overloaded);
 
   /* Params:
    *   1. request_metadata: request metadata.
    *   2. query: query parameters to fetch results.
    *   3. limit: max number of results to be fetched.
-   *   4. offset: index to start fetching results.
+   *   4. offset: index to start fetching results, ignored if the query has a
+   *      cursor. Paging with a cursor is cheaper, since skipped results are
+   *      still scanned.
    * Returns:
    *   A list of follows (expanded mode) in reverse chronological order.
    */
   list<TFollow> list_follows (1:TRequestMetadata request_metadata,
       2:TFollowQuery query, 3:i32 limit, 4:i32 offset)
-      throws (1:TAccountNotFoundException e);
+      throws (1:TAccountNotFoundException e,
+              2:TServerOverloadedException overloaded);
 
   /* Params:
    *   1. request_metadata: request metadata.
@@ -299,7 +347,8 @@ service TFollowService {
    *   True if follower follows followee. False, otherwise.
    */
   bool check_follow (1:TRequestMetadata request_metadata, 2:i32 follower_id,
-      3:i32 followee_id);
+      3:i32 followee_id)
+      throws (1:TServerOverloadedException overloaded);
 
   /* Params:
    *   1. request_metadata: request metadata.
@@ -307,7 +356,8 @@ service TFollowService {
    * Returns:
    *   The number of followers of the provided account.
    */
-  i32 count_followers (1:TRequestMetadata request_metadata, 2:i32 account_id);
+  i32 count_followers (1:TRequestMetadata request_metadata, 2:i32 account_id)
+      throws (1:TServerOverloadedException overloaded);
 
   /* Params:
    *   1. request_metadata: request metadata.
@@ -315,7 +365,8 @@ service TFollowService {
    * Returns:
    *   The number of followees of the provided account.
    */
-  i32 count_followees (1:TRequestMetadata request_metadata, 2:i32 account_id);
+  i32 count_followees (1:TRequestMetadata request_metadata, 2:i32 account_id)
+      throws (1:TServerOverloadedException overloaded);
 }
 
 service TLikeService {
@@ -326,7 +377,8 @@ service TLikeService {
    *   The newly created like (standard mode).
    */
   TLike like_post (1:TRequestMetadata request_metadata, 2:i32 post_id)
-      throws (1:TLikeAlreadyExistsException e);
+      throws (1:TLikeAlreadyExistsException e,
+              2:TServerOverloadedException overloaded);
 
   /* Params:
    *   1. request_metadata: request metadata.
@@ -336,7 +388,8 @@ service TLikeService {
    */
   TLike retrieve_standard_like (1:TRequestMetadata request_metadata,
       2:i32 like_id)
-      throws (1:TLikeNotFoundException e);
+      throws (1:TLikeNotFoundException e,
+              2:TServerOverloadedException overloaded);
 
   /* Params:
    *   1. request_metadata: request metadata.
@@ -348,7 +401,8 @@ service TLikeService {
       2:i32 like_id)
       throws (1:TLikeNotFoundException e1,
               2:TAccountNotFoundException e2,
-              3:TPostNotFoundException e3);
+              3:TPostNotFoundException e3,
+              4:TServerOverloadedException overloaded);
 
   /* Params:
    *   1. request_metadata: request metadata.
@@ -356,20 +410,24 @@ service TLikeService {
    */
   void delete_like (1:TRequestMetadata request_metadata, 2:i32 like_id)
       throws (1:TLikeNotFoundException e1,
-              2:TLikeNotAuthorizedException e2);
+              2:TLikeNotAuthorizedException e2,
+              3:TServerOverloadedException overloaded);
 
   /* Params:
    *   1. request_metadata: request metadata.
    *   2. query: query parameters to fetch results.
    *   3. limit: max number of results to be fetched.
-   *   4. offset: index to start fetching results.
+   *   4. offset: index to start fetching results, ignored if the query has a
+   *      cursor. Paging with a cursor is cheaper, since skipped results are
+   *      still scanned.
    * Returns:
    *   A list of likes (expanded mode) in reverse chronological order.
    */
   list<TLike> list_likes (1:TRequestMetadata request_metadata,
       2:TLikeQuery query, 3:i32 limit, 4:i32 offset)
       throws (1:TAccountNotFoundException e1,
-              2:TPostNotFoundException e2);
+              2:TPostNotFoundException e2,
+              3:TServerOverloadedException overloaded);
 
   /* Params:
    *   1. request_metadata: request metadata.
@@ -378,7 +436,8 @@ service TLikeService {
    *   The number of likes by the provided account.
    */
   i32 count_likes_by_account (1:TRequestMetadata request_metadata,
-      2:i32 account_id);
+      2:i32 account_id)
+      throws (1:TServerOverloadedException overloaded);
 
   /* Params:
    *   1. request_metadata: request metadata.
@@ -386,7 +445,18 @@ service TLikeService {
    * Returns:
    *   The number of likes of the provided post.
    */
-  i32 count_likes_of_post (1:TRequestMetadata request_metadata, 2:i32 post_id);
+  i32 count_likes_of_post (1:TRequestMetadata request_metadata, 2:i32 post_id)
+      throws (1:TServerOverloadedException overloaded);
+
+  /* Params:
+   *   1. request_metadata: request metadata.
+   *   2. post_ids: ids of the posts whose likes are counted.
+   * Returns:
+   *   A map from id to number of likes of each of the provided posts.
+   */
+  map<i32, i32> count_likes_of_posts (1:TRequestMetadata request_metadata,
+      2:list<i32> post_ids)
+      throws (1:TServerOverloadedException overloaded);
 }
 
 service TPostService {
@@ -397,7 +467,8 @@ service TPostService {
    *   The newly created post (standard mode).
    */
   TPost create_post (1:TRequestMetadata request_metadata, 2:string text)
-      throws (1:TPostInvalidAttributesException e);
+      throws (1:TPostInvalidAttributesException e,
+              2:TServerOverloadedException overloaded);
 
   /* Params:
    *   1. request_metadata: request metadata.
@@ -407,7 +478,8 @@ service TPostService {
    */
   TPost retrieve_standard_post (1:TRequestMetadata request_metadata,
       2:i32 post_id)
-      throws (1:TPostNotFoundException e);
+      throws (1:TPostNotFoundException e,
+              2:TServerOverloadedException overloaded);
 
   /* Params:
    *   1. request_metadata: request metadata.
@@ -418,7 +490,20 @@ service TPostService {
   TPost retrieve_expanded_post (1:TRequestMetadata request_metadata,
       2:i32 post_id)
       throws (1:TPostNotFoundException e1,
-              2:TAccountNotFoundException e2);
+              2:TAccountNotFoundException e2,
+              3:TServerOverloadedException overloaded);
+
+  /* Params:
+   *   1. request_metadata: request metadata.
+   *   2. post_ids: ids of the posts to be retrieved.
+   * Returns:
+   *   A map from id to post (expanded mode) of the provided ids that match a
+   *   post. Ids that do not match a post are left out.
+   */
+  map<i32, TPost> retrieve_expanded_posts (1:TRequestMetadata request_metadata,
+      2:list<i32> post_ids)
+      throws (1:TAccountNotFoundException e,
+              2:TServerOverloadedException overloaded);
 
   /* Params:
    *   1. request_metadata: request metadata.
@@ -426,19 +511,23 @@ service TPostService {
    */
   void delete_post (1:TRequestMetadata request_metadata, 2:i32 post_id)
       throws (1:TPostNotFoundException e1,
-              2:TPostNotAuthorizedException e2);
+              2:TPostNotAuthorizedException e2,
+              3:TServerOverloadedException overloaded);
 
   /* Params:
    *   1. request_metadata: request metadata.
    *   2. query: query parameters to fetch results.
    *   3. limit: max number of results to be fetched.
-   *   4. offset: index to start fetching results.
+   *   4. offset: index to start fetching results, ignored if the query has a
+   *      cursor. Paging with a cursor is cheaper, since skipped results are
+   *      still scanned.
    * Returns:
    *   A list of posts (expanded mode) in reverse chronological order.
    */
   list<TPost> list_posts (1:TRequestMetadata request_metadata,
       2:TPostQuery query, 3:i32 limit, 4:i32 offset)
-      throws (1:TAccountNotFoundException e);
+      throws (1:TAccountNotFoundException e,
+              2:TServerOverloadedException overloaded);
 
   /* Params:
    *   1. request_metadata: request metadata.
@@ -447,7 +536,8 @@ service TPostService {
    *   The number of posts written by the provided author account.
    */
   i32 count_posts_by_author (1:TRequestMetadata request_metadata,
-      2:i32 author_id);
+      2:i32 author_id)
+      throws (1:TServerOverloadedException overloaded);
 }
 
 service TUniquepairService {
@@ -458,7 +548,8 @@ service TUniquepairService {
    *   The unique pair matching the provided id.
    */
   TUniquepair get (1:TRequestMetadata request_metadata, 2:i32 uniquepair_id)
-      throws (1:TUniquepairNotFoundException e);
+      throws (1:TUniquepairNotFoundException e,
+              2:TServerOverloadedException overloaded);
 
   /* Params:
    *   1. request_metadata: request metadata.
@@ -470,14 +561,16 @@ service TUniquepairService {
    */
   TUniquepair add (1:TRequestMetadata request_metadata, 2:string domain,
       3:i32 first_elem, 4:i32 second_elem)
-      throws (1:TUniquepairAlreadyExistsException e);
+      throws (1:TUniquepairAlreadyExistsException e,
+              2:TServerOverloadedException overloaded);
 
   /* Params:
    *   1. request_metadata: request metadata.
    *   2. uniquepair_id: id of the unique pair to be removed.
    */
   void remove (1:TRequestMetadata request_metadata, 2:i32 uniquepair_id)
-      throws (1:TUniquepairNotFoundException e);
+      throws (1:TUniquepairNotFoundException e,
+              2:TServerOverloadedException overloaded);
 
   /* Params:
    *   1. request_metadata: request metadata.
@@ -489,18 +582,22 @@ service TUniquepairService {
    */
   TUniquepair find (1:TRequestMetadata request_metadata, 2:string domain,
       3:i32 first_elem, 4:i32 second_elem)
-      throws (1:TUniquepairNotFoundException e);
+      throws (1:TUniquepairNotFoundException e,
+              2:TServerOverloadedException overloaded);
 
   /* Params:
    *   1. request_metadata: request metadata.
    *   2. query: query parameters to fetch results.
    *   3. limit: max number of results to be fetched.
-   *   4. offset: index to start fetching results.
+   *   4. offset: index to start fetching results, ignored if the query has a
+   *      cursor. Paging with a cursor is cheaper, since skipped results are
+   *      still scanned.
    * Returns:
    *   A list of unique pairs in reverse chronological order.
    */
   list<TUniquepair> fetch (1:TRequestMetadata request_metadata,
-      2:TUniquepairQuery query, 3:i32 limit, 4:i32 offset);
+      2:TUniquepairQuery query, 3:i32 limit, 4:i32 offset)
+      throws (1:TServerOverloadedException overloaded);
 
   /* Params:
    *   1. request_metadata: request metadata.
@@ -508,5 +605,18 @@ service TUniquepairService {
    * Returns:
    *   The number of unique pairs.
    */
-  i32 count (1:TRequestMetadata request_metadata, 2:TUniquepairQuery query);
+  i32 count (1:TRequestMetadata request_metadata, 2:TUniquepairQuery query)
+      throws (1:TServerOverloadedException overloaded);
+
+  /* Params:
+   *   1. request_metadata: request metadata.
+   *   2. domain: domain of the unique pairs to be counted.
+   *   3. second_elems: second elements of the unique pairs to be counted.
+   * Returns:
+   *   A map from second element to number of unique pairs with it, for each of
+   *   the provided second elements.
+   */
+  map<i32, i32> count_grouped (1:TRequestMetadata request_metadata,
+      2:string domain, 3:list<i32> second_elems)
+      throws (1:TServerOverloadedException overloaded);
 }
@@ -0,0 +1,145 @@
+// Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
+// Systems
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+
+// Ejects a server from load balancing while it fails. After `max_failures`
+// consecutive failed calls, the breaker opens and the server is ejected for
+// `base_ejection_ms`. Then, the breaker is half-open: one probe call is let
+// through, and the breaker closes if it succeeds or opens again if it fails.
+// Every consecutive ejection lasts twice as long as the previous one, up to
+// `max_ejection_ms`.
+//
+// Calls fail if they hit a transport or protocol error, or if they take longer
+// than `slow_call_ms` (unless 0), so that a server that became slow is ejected
+// too. Calls in flight when the breaker opens are not interrupted.
+class CircuitBreaker {
+public:
+  struct Options {
+    int max_failures = 5;             // 0 disables ejection.
+    int slow_call_ms = 0;
+    int base_ejection_ms = 1000;
+    int max_ejection_ms = 30000;
+  };
+
+  enum State { CLOSED = 0, OPEN = 1, HALF_OPEN = 2 };
+
+  explicit CircuitBreaker(const Options& options)
+  : _options(options),
+    _state(CLOSED),
+    _open_until_ns(0),
+    _probing(false),
+    _n_failures(0),
+    _n_consecutive_ejections(0),
+    _n_ejections(0) {
+  }
+
+  CircuitBreaker(const CircuitBreaker&) = delete;
+  CircuitBreaker& operator=(const CircuitBreaker&) = delete;
+
+  // Whether calls may be sent to the server.
+  bool available() const {
+    switch (_state.load(std::memory_order_relaxed)) {
+      case OPEN:
+        return now_ns() >= _open_until_ns.load(std::memory_order_relaxed);
+      case HALF_OPEN:
+        return !_probing.load(std::memory_order_relaxed);
+      default:
+        return true;
+    }
+  }
+
+  // Report the start of a call. Returns whether it is the probe of a
+  // half-open breaker, to be passed to `end_call`.
+  bool start_call() {
+    if (_state.load(std::memory_order_relaxed) == CLOSED)
+      return false;
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_state == OPEN && now_ns() >= _open_until_ns)
+      _state = HALF_OPEN;
+    if (_state != HALF_OPEN || _probing)
+      return false;
+    _probing = true;
+    return true;
+  }
+
+  void end_call(bool failed, std::chrono::nanoseconds latency, bool probe) {
+    if (_options.slow_call_ms > 0 &&
+        latency > std::chrono::milliseconds(_options.slow_call_ms))
+      failed = true;
+    if (!failed) {
+      _n_failures.store(0, std::memory_order_relaxed);
+      if (!probe)
+        return;
+      std::lock_guard<std::mutex> lock(_mutex);
+      _probing = false;
+      if (_state == HALF_OPEN) {
+        _state = CLOSED;
+        _n_consecutive_ejections = 0;
+      }
+      return;
+    }
+    int n_failures = _n_failures.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (!probe && (_options.max_failures == 0 ||
+        n_failures < _options.max_failures))
+      return;
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (probe)
+      _probing = false;
+    if ((probe && _state == HALF_OPEN) || (!probe && _state == CLOSED))
+      open();
+  }
+
+  // Report the end of a call whose outcome says nothing about the server, such
+  // as a call cut short by the deadline of its caller. A probe is given back,
+  // so that the next call probes the server.
+  void cancel_call(bool probe) {
+    if (!probe)
+      return;
+    std::lock_guard<std::mutex> lock(_mutex);
+    _probing = false;
+  }
+
+  State state() const {
+    return State(_state.load(std::memory_order_relaxed));
+  }
+
+  int64_t n_ejections() const {
+    return _n_ejections.load(std::memory_order_relaxed);
+  }
+
+private:
+  // Eject the server. Must be called with the lock held.
+  void open() {
+    int64_t ejection_ms = _options.base_ejection_ms;
+    for (int i = 0; i < _n_consecutive_ejections &&
+        ejection_ms < _options.max_ejection_ms; i++)
+      ejection_ms *= 2;
+    if (ejection_ms > _options.max_ejection_ms)
+      ejection_ms = _options.max_ejection_ms;
+    _open_until_ns = now_ns() + ejection_ms * 1000000;
+    _state = OPEN;
+    _n_consecutive_ejections++;
+    _n_ejections++;
+  }
+
+  static int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  const Options _options;
+  std::mutex _mutex;
+  std::atomic<int> _state;
+  std::atomic<int64_t> _open_until_ns;
+  std::atomic<bool> _probing;
+  std::atomic<int> _n_failures;
+  int _n_consecutive_ejections;
+  std::atomic<int64_t> _n_ejections;
+};
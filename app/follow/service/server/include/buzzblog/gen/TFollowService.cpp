@@ -145,6 +145,14 @@ uint32_t TFollowService_follow_account_result::read(::apache::thrift::protocol::
           xfer += iprot->skip(ftype);
         }
         break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -171,6 +179,10 @@ uint32_t TFollowService_follow_account_result::write(::apache::thrift::protocol:
     xfer += oprot->writeFieldBegin("e", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->e.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 2);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -219,6 +231,14 @@ uint32_t TFollowService_follow_account_presult::read(::apache::thrift::protocol:
           xfer += iprot->skip(ftype);
         }
         break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -368,6 +388,14 @@ uint32_t TFollowService_retrieve_standard_follow_result::read(::apache::thrift::
           xfer += iprot->skip(ftype);
         }
         break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -394,6 +422,10 @@ uint32_t TFollowService_retrieve_standard_follow_result::write(::apache::thrift:
     xfer += oprot->writeFieldBegin("e", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->e.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 2);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -442,6 +474,14 @@ uint32_t TFollowService_retrieve_standard_follow_presult::read(::apache::thrift:
           xfer += iprot->skip(ftype);
         }
         break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -599,6 +639,14 @@ uint32_t TFollowService_retrieve_expanded_follow_result::read(::apache::thrift::
           xfer += iprot->skip(ftype);
         }
         break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -629,6 +677,10 @@ uint32_t TFollowService_retrieve_expanded_follow_result::write(::apache::thrift:
     xfer += oprot->writeFieldBegin("e2", ::apache::thrift::protocol::T_STRUCT, 2);
     xfer += this->e2.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 3);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -685,6 +737,14 @@ uint32_t TFollowService_retrieve_expanded_follow_presult::read(::apache::thrift:
           xfer += iprot->skip(ftype);
         }
         break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -834,6 +894,14 @@ uint32_t TFollowService_delete_follow_result::read(::apache::thrift::protocol::T
           xfer += iprot->skip(ftype);
         }
         break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -860,6 +928,10 @@ uint32_t TFollowService_delete_follow_result::write(::apache::thrift::protocol::
     xfer += oprot->writeFieldBegin("e2", ::apache::thrift::protocol::T_STRUCT, 2);
     xfer += this->e2.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 3);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -908,6 +980,14 @@ uint32_t TFollowService_delete_follow_presult::read(::apache::thrift::protocol::
           xfer += iprot->skip(ftype);
         }
         break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1077,14 +1157,14 @@ uint32_t TFollowService_list_follows_result::read(::apache::thrift::protocol::TP
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size54;
-            ::apache::thrift::protocol::TType _etype57;
-            xfer += iprot->readListBegin(_etype57, _size54);
-            this->success.resize(_size54);
-            uint32_t _i58;
-            for (_i58 = 0; _i58 < _size54; ++_i58)
+            uint32_t _size80;
+            ::apache::thrift::protocol::TType _etype83;
+            xfer += iprot->readListBegin(_etype83, _size80);
+            this->success.resize(_size80);
+            uint32_t _i84;
+            for (_i84 = 0; _i84 < _size80; ++_i84)
             {
-              xfer += this->success[_i58].read(iprot);
+              xfer += this->success[_i84].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -1101,6 +1181,14 @@ uint32_t TFollowService_list_follows_result::read(::apache::thrift::protocol::TP
           xfer += iprot->skip(ftype);
         }
         break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1123,10 +1211,10 @@ uint32_t TFollowService_list_follows_result::write(::apache::thrift::protocol::T
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->success.size()));
-      std::vector<TFollow> ::const_iterator _iter59;
-      for (_iter59 = this->success.begin(); _iter59 != this->success.end(); ++_iter59)
+      std::vector<TFollow> ::const_iterator _iter85;
+      for (_iter85 = this->success.begin(); _iter85 != this->success.end(); ++_iter85)
       {
-        xfer += (*_iter59).write(oprot);
+        xfer += (*_iter85).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -1135,6 +1223,10 @@ uint32_t TFollowService_list_follows_result::write(::apache::thrift::protocol::T
     xfer += oprot->writeFieldBegin("e", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->e.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 2);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -1171,14 +1263,14 @@ uint32_t TFollowService_list_follows_presult::read(::apache::thrift::protocol::T
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size60;
-            ::apache::thrift::protocol::TType _etype63;
-            xfer += iprot->readListBegin(_etype63, _size60);
-            (*(this->success)).resize(_size60);
-            uint32_t _i64;
-            for (_i64 = 0; _i64 < _size60; ++_i64)
+            uint32_t _size86;
+            ::apache::thrift::protocol::TType _etype89;
+            xfer += iprot->readListBegin(_etype89, _size86);
+            (*(this->success)).resize(_size86);
+            uint32_t _i90;
+            for (_i90 = 0; _i90 < _size86; ++_i90)
             {
-              xfer += (*(this->success))[_i64].read(iprot);
+              xfer += (*(this->success))[_i90].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -1195,6 +1287,14 @@ uint32_t TFollowService_list_follows_presult::read(::apache::thrift::protocol::T
           xfer += iprot->skip(ftype);
         }
         break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1352,6 +1452,14 @@ uint32_t TFollowService_check_follow_result::read(::apache::thrift::protocol::TP
           xfer += iprot->skip(ftype);
         }
         break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1374,6 +1482,10 @@ uint32_t TFollowService_check_follow_result::write(::apache::thrift::protocol::T
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_BOOL, 0);
     xfer += oprot->writeBool(this->success);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -1414,6 +1526,14 @@ uint32_t TFollowService_check_follow_presult::read(::apache::thrift::protocol::T
           xfer += iprot->skip(ftype);
         }
         break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1555,6 +1675,14 @@ uint32_t TFollowService_count_followers_result::read(::apache::thrift::protocol:
           xfer += iprot->skip(ftype);
         }
         break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1577,6 +1705,10 @@ uint32_t TFollowService_count_followers_result::write(::apache::thrift::protocol
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_I32, 0);
     xfer += oprot->writeI32(this->success);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -1617,6 +1749,14 @@ uint32_t TFollowService_count_followers_presult::read(::apache::thrift::protocol
           xfer += iprot->skip(ftype);
         }
         break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1758,6 +1898,14 @@ uint32_t TFollowService_count_followees_result::read(::apache::thrift::protocol:
           xfer += iprot->skip(ftype);
         }
         break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1780,6 +1928,10 @@ uint32_t TFollowService_count_followees_result::write(::apache::thrift::protocol
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_I32, 0);
     xfer += oprot->writeI32(this->success);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -1820,6 +1972,14 @@ uint32_t TFollowService_count_followees_presult::read(::apache::thrift::protocol
           xfer += iprot->skip(ftype);
         }
         break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1891,6 +2051,9 @@ void TFollowServiceClient::recv_follow_account(TFollow& _return)
   if (result.__isset.e) {
     throw result.e;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "follow_account failed: unknown result");
 }
 
@@ -1953,6 +2116,9 @@ void TFollowServiceClient::recv_retrieve_standard_follow(TFollow& _return)
   if (result.__isset.e) {
     throw result.e;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "retrieve_standard_follow failed: unknown result");
 }
 
@@ -2018,6 +2184,9 @@ void TFollowServiceClient::recv_retrieve_expanded_follow(TFollow& _return)
   if (result.__isset.e2) {
     throw result.e2;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "retrieve_expanded_follow failed: unknown result");
 }
 
@@ -2078,6 +2247,9 @@ void TFollowServiceClient::recv_delete_follow()
   if (result.__isset.e2) {
     throw result.e2;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   return;
 }
 
@@ -2142,6 +2314,9 @@ void TFollowServiceClient::recv_list_follows(std::vector<TFollow> & _return)
   if (result.__isset.e) {
     throw result.e;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "list_follows failed: unknown result");
 }
 
@@ -2202,6 +2377,9 @@ bool TFollowServiceClient::recv_check_follow()
   if (result.__isset.success) {
     return _return;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "check_follow failed: unknown result");
 }
 
@@ -2261,6 +2439,9 @@ int32_t TFollowServiceClient::recv_count_followers()
   if (result.__isset.success) {
     return _return;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "count_followers failed: unknown result");
 }
 
@@ -2320,6 +2501,9 @@ int32_t TFollowServiceClient::recv_count_followees()
   if (result.__isset.success) {
     return _return;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "count_followees failed: unknown result");
 }
 
@@ -2370,6 +2554,9 @@ void TFollowServiceProcessor::process_follow_account(int32_t seqid, ::apache::th
   } catch (TFollowAlreadyExistsException &e) {
     result.e = e;
     result.__isset.e = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TFollowService.follow_account");
@@ -2427,6 +2614,9 @@ void TFollowServiceProcessor::process_retrieve_standard_follow(int32_t seqid, ::
   } catch (TFollowNotFoundException &e) {
     result.e = e;
     result.__isset.e = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TFollowService.retrieve_standard_follow");
@@ -2487,6 +2677,9 @@ void TFollowServiceProcessor::process_retrieve_expanded_follow(int32_t seqid, ::
   } catch (TAccountNotFoundException &e2) {
     result.e2 = e2;
     result.__isset.e2 = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TFollowService.retrieve_expanded_follow");
@@ -2546,6 +2739,9 @@ void TFollowServiceProcessor::process_delete_follow(int32_t seqid, ::apache::thr
   } catch (TFollowNotAuthorizedException &e2) {
     result.e2 = e2;
     result.__isset.e2 = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TFollowService.delete_follow");
@@ -2603,6 +2799,9 @@ void TFollowServiceProcessor::process_list_follows(int32_t seqid, ::apache::thri
   } catch (TAccountNotFoundException &e) {
     result.e = e;
     result.__isset.e = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TFollowService.list_follows");
@@ -2657,6 +2856,9 @@ void TFollowServiceProcessor::process_check_follow(int32_t seqid, ::apache::thri
   try {
     result.success = iface_->check_follow(args.request_metadata, args.follower_id, args.followee_id);
     result.__isset.success = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TFollowService.check_follow");
@@ -2711,6 +2913,9 @@ void TFollowServiceProcessor::process_count_followers(int32_t seqid, ::apache::t
   try {
     result.success = iface_->count_followers(args.request_metadata, args.account_id);
     result.__isset.success = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TFollowService.count_followers");
@@ -2765,6 +2970,9 @@ void TFollowServiceProcessor::process_count_followees(int32_t seqid, ::apache::t
   try {
     result.success = iface_->count_followees(args.request_metadata, args.account_id);
     result.__isset.success = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TFollowService.count_followees");
@@ -2879,6 +3087,10 @@ void TFollowServiceConcurrentClient::recv_follow_account(TFollow& _return, const
         sentry.commit();
         throw result.e;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       // in a bad state, don't commit
       throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "follow_account failed: unknown result");
     }
@@ -2968,6 +3180,10 @@ void TFollowServiceConcurrentClient::recv_retrieve_standard_follow(TFollow& _ret
         sentry.commit();
         throw result.e;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       // in a bad state, don't commit
       throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "retrieve_standard_follow failed: unknown result");
     }
@@ -3061,6 +3277,10 @@ void TFollowServiceConcurrentClient::recv_retrieve_expanded_follow(TFollow& _ret
         sentry.commit();
         throw result.e2;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       // in a bad state, don't commit
       throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "retrieve_expanded_follow failed: unknown result");
     }
@@ -3148,6 +3368,10 @@ void TFollowServiceConcurrentClient::recv_delete_follow(const int32_t seqid)
         sentry.commit();
         throw result.e2;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       sentry.commit();
       return;
     }
@@ -3239,6 +3463,10 @@ void TFollowServiceConcurrentClient::recv_list_follows(std::vector<TFollow> & _r
         sentry.commit();
         throw result.e;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       // in a bad state, don't commit
       throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "list_follows failed: unknown result");
     }
@@ -3325,6 +3553,10 @@ bool TFollowServiceConcurrentClient::recv_check_follow(const int32_t seqid)
         sentry.commit();
         return _return;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       // in a bad state, don't commit
       throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "check_follow failed: unknown result");
     }
@@ -3410,6 +3642,10 @@ int32_t TFollowServiceConcurrentClient::recv_count_followers(const int32_t seqid
         sentry.commit();
         return _return;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       // in a bad state, don't commit
       throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "count_followers failed: unknown result");
     }
@@ -3495,6 +3731,10 @@ int32_t TFollowServiceConcurrentClient::recv_count_followees(const int32_t seqid
         sentry.commit();
         return _return;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       // in a bad state, don't commit
       throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "count_followees failed: unknown result");
     }
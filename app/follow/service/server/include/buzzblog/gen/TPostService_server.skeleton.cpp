@@ -35,6 +35,11 @@ class TPostServiceHandler : virtual public TPostServiceIf {
     printf("retrieve_expanded_post\n");
   }
 
+  void retrieve_expanded_posts(std::map<int32_t, TPost> & _return, const TRequestMetadata& request_metadata, const std::vector<int32_t> & post_ids) {
+    // Your implementation goes here
+    printf("retrieve_expanded_posts\n");
+  }
+
   void delete_post(const TRequestMetadata& request_metadata, const int32_t post_id) {
     // Your implementation goes here
     printf("delete_post\n");
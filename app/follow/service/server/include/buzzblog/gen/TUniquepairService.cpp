@@ -145,6 +145,14 @@ uint32_t TUniquepairService_get_result::read(::apache::thrift::protocol::TProtoc
           xfer += iprot->skip(ftype);
         }
         break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -171,6 +179,10 @@ uint32_t TUniquepairService_get_result::write(::apache::thrift::protocol::TProto
     xfer += oprot->writeFieldBegin("e", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->e.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 2);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -219,6 +231,14 @@ uint32_t TUniquepairService_get_presult::read(::apache::thrift::protocol::TProto
           xfer += iprot->skip(ftype);
         }
         break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -400,6 +420,14 @@ uint32_t TUniquepairService_add_result::read(::apache::thrift::protocol::TProtoc
           xfer += iprot->skip(ftype);
         }
         break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -426,6 +454,10 @@ uint32_t TUniquepairService_add_result::write(::apache::thrift::protocol::TProto
     xfer += oprot->writeFieldBegin("e", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->e.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 2);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -474,6 +506,14 @@ uint32_t TUniquepairService_add_presult::read(::apache::thrift::protocol::TProto
           xfer += iprot->skip(ftype);
         }
         break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -615,6 +655,14 @@ uint32_t TUniquepairService_remove_result::read(::apache::thrift::protocol::TPro
           xfer += iprot->skip(ftype);
         }
         break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -637,6 +685,10 @@ uint32_t TUniquepairService_remove_result::write(::apache::thrift::protocol::TPr
     xfer += oprot->writeFieldBegin("e", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->e.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 2);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -677,6 +729,14 @@ uint32_t TUniquepairService_remove_presult::read(::apache::thrift::protocol::TPr
           xfer += iprot->skip(ftype);
         }
         break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -858,6 +918,14 @@ uint32_t TUniquepairService_find_result::read(::apache::thrift::protocol::TProto
           xfer += iprot->skip(ftype);
         }
         break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -884,6 +952,10 @@ uint32_t TUniquepairService_find_result::write(::apache::thrift::protocol::TProt
     xfer += oprot->writeFieldBegin("e", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->e.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 2);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -932,6 +1004,14 @@ uint32_t TUniquepairService_find_presult::read(::apache::thrift::protocol::TProt
           xfer += iprot->skip(ftype);
         }
         break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1101,14 +1181,14 @@ uint32_t TUniquepairService_fetch_result::read(::apache::thrift::protocol::TProt
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size87;
-            ::apache::thrift::protocol::TType _etype90;
-            xfer += iprot->readListBegin(_etype90, _size87);
-            this->success.resize(_size87);
-            uint32_t _i91;
-            for (_i91 = 0; _i91 < _size87; ++_i91)
+            uint32_t _size157;
+            ::apache::thrift::protocol::TType _etype160;
+            xfer += iprot->readListBegin(_etype160, _size157);
+            this->success.resize(_size157);
+            uint32_t _i161;
+            for (_i161 = 0; _i161 < _size157; ++_i161)
             {
-              xfer += this->success[_i91].read(iprot);
+              xfer += this->success[_i161].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -1117,6 +1197,14 @@ uint32_t TUniquepairService_fetch_result::read(::apache::thrift::protocol::TProt
           xfer += iprot->skip(ftype);
         }
         break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1139,14 +1227,18 @@ uint32_t TUniquepairService_fetch_result::write(::apache::thrift::protocol::TPro
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->success.size()));
-      std::vector<TUniquepair> ::const_iterator _iter92;
-      for (_iter92 = this->success.begin(); _iter92 != this->success.end(); ++_iter92)
+      std::vector<TUniquepair> ::const_iterator _iter162;
+      for (_iter162 = this->success.begin(); _iter162 != this->success.end(); ++_iter162)
       {
-        xfer += (*_iter92).write(oprot);
+        xfer += (*_iter162).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -1183,14 +1275,14 @@ uint32_t TUniquepairService_fetch_presult::read(::apache::thrift::protocol::TPro
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size93;
-            ::apache::thrift::protocol::TType _etype96;
-            xfer += iprot->readListBegin(_etype96, _size93);
-            (*(this->success)).resize(_size93);
-            uint32_t _i97;
-            for (_i97 = 0; _i97 < _size93; ++_i97)
+            uint32_t _size163;
+            ::apache::thrift::protocol::TType _etype166;
+            xfer += iprot->readListBegin(_etype166, _size163);
+            (*(this->success)).resize(_size163);
+            uint32_t _i167;
+            for (_i167 = 0; _i167 < _size163; ++_i167)
             {
-              xfer += (*(this->success))[_i97].read(iprot);
+              xfer += (*(this->success))[_i167].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -1199,6 +1291,14 @@ uint32_t TUniquepairService_fetch_presult::read(::apache::thrift::protocol::TPro
           xfer += iprot->skip(ftype);
         }
         break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1340,6 +1440,14 @@ uint32_t TUniquepairService_count_result::read(::apache::thrift::protocol::TProt
           xfer += iprot->skip(ftype);
         }
         break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1362,6 +1470,10 @@ uint32_t TUniquepairService_count_result::write(::apache::thrift::protocol::TPro
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_I32, 0);
     xfer += oprot->writeI32(this->success);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -1402,6 +1514,320 @@ uint32_t TUniquepairService_count_presult::read(::apache::thrift::protocol::TPro
           xfer += iprot->skip(ftype);
         }
         break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
+TUniquepairService_count_grouped_args::~TUniquepairService_count_grouped_args() noexcept {
+}
+
+
+uint32_t TUniquepairService_count_grouped_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->request_metadata.read(iprot);
+          this->__isset.request_metadata = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->domain);
+          this->__isset.domain = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->second_elems.clear();
+            uint32_t _size168;
+            ::apache::thrift::protocol::TType _etype171;
+            xfer += iprot->readListBegin(_etype171, _size168);
+            this->second_elems.resize(_size168);
+            uint32_t _i172;
+            for (_i172 = 0; _i172 < _size168; ++_i172)
+            {
+              xfer += iprot->readI32(this->second_elems[_i172]);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.second_elems = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t TUniquepairService_count_grouped_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("TUniquepairService_count_grouped_args");
+
+  xfer += oprot->writeFieldBegin("request_metadata", ::apache::thrift::protocol::T_STRUCT, 1);
+  xfer += this->request_metadata.write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("domain", ::apache::thrift::protocol::T_STRING, 2);
+  xfer += oprot->writeString(this->domain);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("second_elems", ::apache::thrift::protocol::T_LIST, 3);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I32, static_cast<uint32_t>(this->second_elems.size()));
+    std::vector<int32_t> ::const_iterator _iter173;
+    for (_iter173 = this->second_elems.begin(); _iter173 != this->second_elems.end(); ++_iter173)
+    {
+      xfer += oprot->writeI32((*_iter173));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+TUniquepairService_count_grouped_pargs::~TUniquepairService_count_grouped_pargs() noexcept {
+}
+
+
+uint32_t TUniquepairService_count_grouped_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("TUniquepairService_count_grouped_pargs");
+
+  xfer += oprot->writeFieldBegin("request_metadata", ::apache::thrift::protocol::T_STRUCT, 1);
+  xfer += (*(this->request_metadata)).write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("domain", ::apache::thrift::protocol::T_STRING, 2);
+  xfer += oprot->writeString((*(this->domain)));
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("second_elems", ::apache::thrift::protocol::T_LIST, 3);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I32, static_cast<uint32_t>((*(this->second_elems)).size()));
+    std::vector<int32_t> ::const_iterator _iter174;
+    for (_iter174 = (*(this->second_elems)).begin(); _iter174 != (*(this->second_elems)).end(); ++_iter174)
+    {
+      xfer += oprot->writeI32((*_iter174));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+TUniquepairService_count_grouped_result::~TUniquepairService_count_grouped_result() noexcept {
+}
+
+
+uint32_t TUniquepairService_count_grouped_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_MAP) {
+          {
+            this->success.clear();
+            uint32_t _size175;
+            ::apache::thrift::protocol::TType _ktype176;
+            ::apache::thrift::protocol::TType _vtype177;
+            xfer += iprot->readMapBegin(_ktype176, _vtype177, _size175);
+            uint32_t _i179;
+            for (_i179 = 0; _i179 < _size175; ++_i179)
+            {
+              int32_t _key180;
+              xfer += iprot->readI32(_key180);
+              int32_t& _val181 = this->success[_key180];
+              xfer += iprot->readI32(_val181);
+            }
+            xfer += iprot->readMapEnd();
+          }
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t TUniquepairService_count_grouped_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("TUniquepairService_count_grouped_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_MAP, 0);
+    {
+      xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_I32, ::apache::thrift::protocol::T_I32, static_cast<uint32_t>(this->success.size()));
+      std::map<int32_t, int32_t> ::const_iterator _iter182;
+      for (_iter182 = this->success.begin(); _iter182 != this->success.end(); ++_iter182)
+      {
+        xfer += oprot->writeI32(_iter182->first);
+        xfer += oprot->writeI32(_iter182->second);
+      }
+      xfer += oprot->writeMapEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+TUniquepairService_count_grouped_presult::~TUniquepairService_count_grouped_presult() noexcept {
+}
+
+
+uint32_t TUniquepairService_count_grouped_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_MAP) {
+          {
+            (*(this->success)).clear();
+            uint32_t _size183;
+            ::apache::thrift::protocol::TType _ktype184;
+            ::apache::thrift::protocol::TType _vtype185;
+            xfer += iprot->readMapBegin(_ktype184, _vtype185, _size183);
+            uint32_t _i187;
+            for (_i187 = 0; _i187 < _size183; ++_i187)
+            {
+              int32_t _key188;
+              xfer += iprot->readI32(_key188);
+              int32_t& _val189 = (*(this->success))[_key188];
+              xfer += iprot->readI32(_val189);
+            }
+            xfer += iprot->readMapEnd();
+          }
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1473,6 +1899,9 @@ void TUniquepairServiceClient::recv_get(TUniquepair& _return)
   if (result.__isset.e) {
     throw result.e;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "get failed: unknown result");
 }
 
@@ -1537,6 +1966,9 @@ void TUniquepairServiceClient::recv_add(TUniquepair& _return)
   if (result.__isset.e) {
     throw result.e;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "add failed: unknown result");
 }
 
@@ -1594,6 +2026,9 @@ void TUniquepairServiceClient::recv_remove()
   if (result.__isset.e) {
     throw result.e;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   return;
 }
 
@@ -1658,6 +2093,9 @@ void TUniquepairServiceClient::recv_find(TUniquepair& _return)
   if (result.__isset.e) {
     throw result.e;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "find failed: unknown result");
 }
 
@@ -1719,6 +2157,9 @@ void TUniquepairServiceClient::recv_fetch(std::vector<TUniquepair> & _return)
     // _return pointer has now been filled
     return;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "fetch failed: unknown result");
 }
 
@@ -1778,9 +2219,75 @@ int32_t TUniquepairServiceClient::recv_count()
   if (result.__isset.success) {
     return _return;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "count failed: unknown result");
 }
 
+void TUniquepairServiceClient::count_grouped(std::map<int32_t, int32_t> & _return, const TRequestMetadata& request_metadata, const std::string& domain, const std::vector<int32_t> & second_elems)
+{
+  send_count_grouped(request_metadata, domain, second_elems);
+  recv_count_grouped(_return);
+}
+
+void TUniquepairServiceClient::send_count_grouped(const TRequestMetadata& request_metadata, const std::string& domain, const std::vector<int32_t> & second_elems)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("count_grouped", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  TUniquepairService_count_grouped_pargs args;
+  args.request_metadata = &request_metadata;
+  args.domain = &domain;
+  args.second_elems = &second_elems;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void TUniquepairServiceClient::recv_count_grouped(std::map<int32_t, int32_t> & _return)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("count_grouped") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  TUniquepairService_count_grouped_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
+  }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "count_grouped failed: unknown result");
+}
+
 bool TUniquepairServiceProcessor::dispatchCall(::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, const std::string& fname, int32_t seqid, void* callContext) {
   ProcessMap::iterator pfn;
   pfn = processMap_.find(fname);
@@ -1828,6 +2335,9 @@ void TUniquepairServiceProcessor::process_get(int32_t seqid, ::apache::thrift::p
   } catch (TUniquepairNotFoundException &e) {
     result.e = e;
     result.__isset.e = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TUniquepairService.get");
@@ -1885,6 +2395,9 @@ void TUniquepairServiceProcessor::process_add(int32_t seqid, ::apache::thrift::p
   } catch (TUniquepairAlreadyExistsException &e) {
     result.e = e;
     result.__isset.e = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TUniquepairService.add");
@@ -1941,6 +2454,9 @@ void TUniquepairServiceProcessor::process_remove(int32_t seqid, ::apache::thrift
   } catch (TUniquepairNotFoundException &e) {
     result.e = e;
     result.__isset.e = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TUniquepairService.remove");
@@ -1998,6 +2514,9 @@ void TUniquepairServiceProcessor::process_find(int32_t seqid, ::apache::thrift::
   } catch (TUniquepairNotFoundException &e) {
     result.e = e;
     result.__isset.e = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TUniquepairService.find");
@@ -2052,6 +2571,9 @@ void TUniquepairServiceProcessor::process_fetch(int32_t seqid, ::apache::thrift:
   try {
     iface_->fetch(result.success, args.request_metadata, args.query, args.limit, args.offset);
     result.__isset.success = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TUniquepairService.fetch");
@@ -2106,6 +2628,9 @@ void TUniquepairServiceProcessor::process_count(int32_t seqid, ::apache::thrift:
   try {
     result.success = iface_->count(args.request_metadata, args.query);
     result.__isset.success = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TUniquepairService.count");
@@ -2135,6 +2660,63 @@ void TUniquepairServiceProcessor::process_count(int32_t seqid, ::apache::thrift:
   }
 }
 
+void TUniquepairServiceProcessor::process_count_grouped(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("TUniquepairService.count_grouped", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "TUniquepairService.count_grouped");
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "TUniquepairService.count_grouped");
+  }
+
+  TUniquepairService_count_grouped_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "TUniquepairService.count_grouped", bytes);
+  }
+
+  TUniquepairService_count_grouped_result result;
+  try {
+    iface_->count_grouped(result.success, args.request_metadata, args.domain, args.second_elems);
+    result.__isset.success = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "TUniquepairService.count_grouped");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("count_grouped", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "TUniquepairService.count_grouped");
+  }
+
+  oprot->writeMessageBegin("count_grouped", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "TUniquepairService.count_grouped", bytes);
+  }
+}
+
 ::std::shared_ptr< ::apache::thrift::TProcessor > TUniquepairServiceProcessorFactory::getProcessor(const ::apache::thrift::TConnectionInfo& connInfo) {
   ::apache::thrift::ReleaseHandler< TUniquepairServiceIfFactory > cleanup(handlerFactory_);
   ::std::shared_ptr< TUniquepairServiceIf > handler(handlerFactory_->getHandler(connInfo), cleanup);
@@ -2220,6 +2802,10 @@ void TUniquepairServiceConcurrentClient::recv_get(TUniquepair& _return, const in
         sentry.commit();
         throw result.e;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       // in a bad state, don't commit
       throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "get failed: unknown result");
     }
@@ -2311,6 +2897,10 @@ void TUniquepairServiceConcurrentClient::recv_add(TUniquepair& _return, const in
         sentry.commit();
         throw result.e;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       // in a bad state, don't commit
       throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "add failed: unknown result");
     }
@@ -2394,6 +2984,10 @@ void TUniquepairServiceConcurrentClient::recv_remove(const int32_t seqid)
         sentry.commit();
         throw result.e;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       sentry.commit();
       return;
     }
@@ -2485,6 +3079,10 @@ void TUniquepairServiceConcurrentClient::recv_find(TUniquepair& _return, const i
         sentry.commit();
         throw result.e;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       // in a bad state, don't commit
       throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "find failed: unknown result");
     }
@@ -2572,6 +3170,10 @@ void TUniquepairServiceConcurrentClient::recv_fetch(std::vector<TUniquepair> & _
         sentry.commit();
         return;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       // in a bad state, don't commit
       throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "fetch failed: unknown result");
     }
@@ -2657,6 +3259,10 @@ int32_t TUniquepairServiceConcurrentClient::recv_count(const int32_t seqid)
         sentry.commit();
         return _return;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       // in a bad state, don't commit
       throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "count failed: unknown result");
     }
@@ -2668,5 +3274,95 @@ int32_t TUniquepairServiceConcurrentClient::recv_count(const int32_t seqid)
   } // end while(true)
 }
 
+void TUniquepairServiceConcurrentClient::count_grouped(std::map<int32_t, int32_t> & _return, const TRequestMetadata& request_metadata, const std::string& domain, const std::vector<int32_t> & second_elems)
+{
+  int32_t seqid = send_count_grouped(request_metadata, domain, second_elems);
+  recv_count_grouped(_return, seqid);
+}
+
+int32_t TUniquepairServiceConcurrentClient::send_count_grouped(const TRequestMetadata& request_metadata, const std::string& domain, const std::vector<int32_t> & second_elems)
+{
+  int32_t cseqid = this->sync_->generateSeqId();
+  ::apache::thrift::async::TConcurrentSendSentry sentry(this->sync_.get());
+  oprot_->writeMessageBegin("count_grouped", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  TUniquepairService_count_grouped_pargs args;
+  args.request_metadata = &request_metadata;
+  args.domain = &domain;
+  args.second_elems = &second_elems;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+
+  sentry.commit();
+  return cseqid;
+}
+
+void TUniquepairServiceConcurrentClient::recv_count_grouped(std::map<int32_t, int32_t> & _return, const int32_t seqid)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  // the read mutex gets dropped and reacquired as part of waitForWork()
+  // The destructor of this sentry wakes up other clients
+  ::apache::thrift::async::TConcurrentRecvSentry sentry(this->sync_.get(), seqid);
+
+  while(true) {
+    if(!this->sync_->getPending(fname, mtype, rseqid)) {
+      iprot_->readMessageBegin(fname, mtype, rseqid);
+    }
+    if(seqid == rseqid) {
+      if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+        ::apache::thrift::TApplicationException x;
+        x.read(iprot_);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+        sentry.commit();
+        throw x;
+      }
+      if (mtype != ::apache::thrift::protocol::T_REPLY) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+      }
+      if (fname.compare("count_grouped") != 0) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+
+        // in a bad state, don't commit
+        using ::apache::thrift::protocol::TProtocolException;
+        throw TProtocolException(TProtocolException::INVALID_DATA);
+      }
+      TUniquepairService_count_grouped_presult result;
+      result.success = &_return;
+      result.read(iprot_);
+      iprot_->readMessageEnd();
+      iprot_->getTransport()->readEnd();
+
+      if (result.__isset.success) {
+        // _return pointer has now been filled
+        sentry.commit();
+        return;
+      }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
+      // in a bad state, don't commit
+      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "count_grouped failed: unknown result");
+    }
+    // seqid != rseqid
+    this->sync_->updatePending(fname, mtype, rseqid);
+
+    // this will temporarily unlock the readMutex, and let other clients get work done
+    this->sync_->waitForWork(seqid);
+  } // end while(true)
+}
+
 } // namespace
 
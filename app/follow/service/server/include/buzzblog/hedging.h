@@ -0,0 +1,223 @@
+// Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
+// Systems
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <thrift/TApplicationException.h>
+#include <thrift/protocol/TProtocolException.h>
+#include <thrift/transport/TTransportException.h>
+
+#include <buzzblog/gen/buzzblog_types.h>
+#include <buzzblog/executor.h>
+#include <buzzblog/metrics.h>
+
+
+// Recent latencies of a function, kept to estimate one of their percentiles.
+class LatencyWindow {
+public:
+  static const int SIZE = 1024;
+  // Samples between estimations, also the number needed for the first one.
+  static const int PERIOD = 128;
+
+  explicit LatencyWindow(double percentile)
+  : _percentile(percentile),
+    _n_samples(0),
+    _estimate_ns(-1) {
+    _samples.reserve(SIZE);
+  }
+
+  void record(std::chrono::nanoseconds latency) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (int(_samples.size()) < SIZE)
+      _samples.push_back(latency.count());
+    else
+      _samples[_n_samples % SIZE] = latency.count();
+    if (++_n_samples % PERIOD != 0)
+      return;
+    std::vector<int64_t> samples(_samples);
+    auto nth = samples.begin() + std::min(samples.size() - 1,
+        size_t(samples.size() * _percentile / 100));
+    std::nth_element(samples.begin(), nth, samples.end());
+    _estimate_ns = *nth;
+  }
+
+  // The percentile of recent latencies, or a negative duration until enough
+  // samples were recorded.
+  std::chrono::nanoseconds estimate() const {
+    return std::chrono::nanoseconds(_estimate_ns.load());
+  }
+
+private:
+  const double _percentile;
+  std::mutex _mutex;
+  std::vector<int64_t> _samples;
+  int64_t _n_samples;
+  std::atomic<int64_t> _estimate_ns;
+};
+
+// Hedges idempotent calls: if a call has not returned after the `percentile`
+// of the recent latency of its function, a backup call is made to another
+// server, and the first reply is taken. Replies include the exceptions that
+// functions declare, except for TServerOverloadedException; transport,
+// protocol, and application errors and overloaded servers are not replies, so
+// the other call is then waited for.
+//
+// Backup calls are limited by a budget of `max_extra_load` (e.g., 0.05) backup
+// calls per call, accrued as calls are made, of which a burst of at most 10
+// can be saved. Calls run on a pool of `n_threads` threads, while the caller
+// waits; the losing call runs to completion there.
+class Hedger {
+public:
+  Hedger(double percentile, double max_extra_load, int n_threads)
+  : _percentile(percentile),
+    _deposit(max_extra_load * TOKEN),
+    _tokens(0),
+    _executor(std::make_unique<Executor>(n_threads)) {
+  }
+
+  Hedger(const Hedger&) = delete;
+  Hedger& operator=(const Hedger&) = delete;
+
+  // Make a call of `function` with `primary`, and with `backup` too if it
+  // takes long. Both must capture their arguments by value, since the losing
+  // one may outlive this call.
+  template <typename T>
+  T call(const std::string& function, std::function<T()> primary,
+      std::function<T()> backup) {
+    auto window = latency_window(function);
+    auto state = std::make_shared<State<T>>();
+    auto result = state->promise.get_future();
+    deposit();
+    _executor->submit([state, window, primary] {
+      run(state, window, primary, 0);
+    });
+    auto delay = window->estimate();
+    if (delay.count() >= 0 &&
+        result.wait_for(delay) == std::future_status::timeout &&
+        withdraw()) {
+      bool launched = false;
+      {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (!state->done) {
+          state->n_running++;
+          launched = true;
+        }
+      }
+      if (launched) {
+        metrics().counter("buzzblog_hedged_calls_total",
+            "function=\"" + function + "\"")->increment();
+        _executor->submit([state, window, backup] {
+          run(state, window, backup, 1);
+        });
+      }
+    }
+    auto value = result.get();
+    if (state->winner == 1)
+      metrics().counter("buzzblog_hedged_wins_total",
+          "function=\"" + function + "\"")->increment();
+    return value;
+  }
+
+private:
+  static const int64_t TOKEN = 1000;
+  static const int64_t MAX_TOKENS = 10 * TOKEN;
+
+  template <typename T>
+  struct State {
+    std::mutex mutex;
+    std::promise<T> promise;
+    int n_running = 1;
+    bool done = false;
+    int winner = -1;            // 0: primary call, 1: backup call.
+  };
+
+  template <typename T>
+  static void run(const std::shared_ptr<State<T>>& state,
+      const std::shared_ptr<LatencyWindow>& window,
+      const std::function<T()>& rpc, int attempt) {
+    using namespace apache::thrift;
+    auto start_time = std::chrono::steady_clock::now();
+    bool failed = false;
+    std::exception_ptr error;
+    T value{};
+    try {
+      value = rpc();
+    }
+    catch (const transport::TTransportException& e) {
+      failed = true;
+      error = std::current_exception();
+    }
+    catch (const protocol::TProtocolException& e) {
+      failed = true;
+      error = std::current_exception();
+    }
+    catch (const TApplicationException& e) {
+      failed = true;
+      error = std::current_exception();
+    }
+    catch (const gen::TServerOverloadedException& e) {
+      failed = true;
+      error = std::current_exception();
+    }
+    catch (...) {
+      error = std::current_exception();
+    }
+    if (!failed)
+      window->record(std::chrono::steady_clock::now() - start_time);
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->n_running--;
+    if (state->done || (failed && state->n_running > 0))
+      return;
+    state->done = true;
+    state->winner = attempt;
+    if (error)
+      state->promise.set_exception(error);
+    else
+      state->promise.set_value(std::move(value));
+  }
+
+  std::shared_ptr<LatencyWindow> latency_window(const std::string& function) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto& window = _windows[function];
+    if (!window)
+      window = std::make_shared<LatencyWindow>(_percentile);
+    return window;
+  }
+
+  void deposit() {
+    auto tokens = _tokens.load();
+    while (tokens < MAX_TOKENS &&
+        !_tokens.compare_exchange_weak(tokens,
+            tokens + _deposit < MAX_TOKENS ? tokens + _deposit : MAX_TOKENS)) {
+    }
+  }
+
+  bool withdraw() {
+    auto tokens = _tokens.load();
+    while (tokens >= TOKEN) {
+      if (_tokens.compare_exchange_weak(tokens, tokens - TOKEN))
+        return true;
+    }
+    return false;
+  }
+
+  const double _percentile;
+  const int64_t _deposit;
+  std::atomic<int64_t> _tokens;
+  std::mutex _mutex;
+  std::map<std::string, std::shared_ptr<LatencyWindow>> _windows;
+  std::unique_ptr<Executor> _executor;
+};
@@ -1,18 +1,14 @@
 // Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
 // Systems
 
-#include <chrono>
+#include <future>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
-#include <spdlog/spdlog.h>
-#include <spdlog/sinks/basic_file_sink.h>
-#include <thrift/protocol/TBinaryProtocol.h>
-#include <thrift/transport/TSocket.h>
-#include <thrift/transport/TTransportUtils.h>
-
 #include <buzzblog/gen/TLikeService.h>
+#include <buzzblog/base_client.h>
 
 
 using namespace apache::thrift;
@@ -23,127 +19,148 @@ using namespace gen;
 
 
 namespace like_service {
-  class Client {
-   private:
-    std::string _ip_address;
-    int _port;
-    std::shared_ptr<TSocket> _socket;
-    std::shared_ptr<TTransport> _transport;
-    std::shared_ptr<TProtocol> _protocol;
-    std::shared_ptr<TLikeServiceClient> _client;
+  class Client : public BaseClient<TLikeServiceClient> {
    public:
-    Client(const std::string& ip_address, int port, int conn_timeout_ms) {
-      _ip_address = ip_address;
-      _port = port;
-      _socket = std::make_shared<TSocket>(ip_address, port);
-      _socket->setConnTimeout(conn_timeout_ms);
-      _transport = std::make_shared<TBufferedTransport>(_socket);
-      _protocol = std::make_shared<TBinaryProtocol>(_transport);
-      _client = std::make_shared<TLikeServiceClient>(_protocol);
-      _transport->open();
-    }
-
-    ~Client() {
-      close();
-    }
-
-    void close() {
-      if (_transport->isOpen())
-        _transport->close();
+    Client(const std::string& ip_address, int port, int conn_timeout_ms,
+        const WireFormat& wire_format = {})
+    : BaseClient(ip_address, port, conn_timeout_ms, wire_format) {
     }
 
     TLike like_post(const TRequestMetadata& request_metadata,
         const int32_t post_id) {
       TLike _return;
-      auto logger = spdlog::get("logger");
-      auto start_time = std::chrono::steady_clock::now();
-      _client->like_post(_return, request_metadata, post_id);
-      std::chrono::duration<double> latency = \
-          std::chrono::steady_clock::now() - start_time;
-      logger->info("request_id={} server={}:{} "
-          "function=like:like_post latency={}", request_metadata.id,
-          _ip_address, _port, latency.count());
+      call(request_metadata, "like:like_post",
+          [&](const TRequestMetadata& rpc_metadata) {
+        _client->like_post(_return, rpc_metadata, post_id);
+      });
       return _return;
     }
 
+    std::future<TLike> like_post_async(const TRequestMetadata& request_metadata,
+        const int32_t post_id) {
+      return call_async([=] {
+        return like_post(request_metadata, post_id);
+      });
+    }
+
     TLike retrieve_standard_like(const TRequestMetadata& request_metadata,
         const int32_t like_id) {
       TLike _return;
-      auto logger = spdlog::get("logger");
-      auto start_time = std::chrono::steady_clock::now();
-      _client->retrieve_standard_like(_return, request_metadata, like_id);
-      std::chrono::duration<double> latency = \
-          std::chrono::steady_clock::now() - start_time;
-      logger->info("request_id={} server={}:{} "
-          "function=like:retrieve_standard_like latency={}",
-          request_metadata.id, _ip_address, _port, latency.count());
+      call(request_metadata, "like:retrieve_standard_like",
+          [&](const TRequestMetadata& rpc_metadata) {
+        _client->retrieve_standard_like(_return, rpc_metadata, like_id);
+      });
       return _return;
     }
 
+    std::future<TLike> retrieve_standard_like_async(
+        const TRequestMetadata& request_metadata, const int32_t like_id) {
+      return call_async([=] {
+        return retrieve_standard_like(request_metadata, like_id);
+      });
+    }
+
     TLike retrieve_expanded_like(const TRequestMetadata& request_metadata,
         const int32_t like_id) {
       TLike _return;
-      auto logger = spdlog::get("logger");
-      auto start_time = std::chrono::steady_clock::now();
-      _client->retrieve_expanded_like(_return, request_metadata, like_id);
-      std::chrono::duration<double> latency = \
-          std::chrono::steady_clock::now() - start_time;
-      logger->info("request_id={} server={}:{} "
-          "function=like:retrieve_expanded_like latency={}",
-          request_metadata.id, _ip_address, _port, latency.count());
+      call(request_metadata, "like:retrieve_expanded_like",
+          [&](const TRequestMetadata& rpc_metadata) {
+        _client->retrieve_expanded_like(_return, rpc_metadata, like_id);
+      });
       return _return;
     }
 
+    std::future<TLike> retrieve_expanded_like_async(
+        const TRequestMetadata& request_metadata, const int32_t like_id) {
+      return call_async([=] {
+        return retrieve_expanded_like(request_metadata, like_id);
+      });
+    }
+
     void delete_like(const TRequestMetadata& request_metadata,
         const int32_t like_id) {
-      auto logger = spdlog::get("logger");
-      auto start_time = std::chrono::steady_clock::now();
-      _client->delete_like(request_metadata, like_id);
-      std::chrono::duration<double> latency = \
-          std::chrono::steady_clock::now() - start_time;
-      logger->info("request_id={} server={}:{} "
-          "function=like:delete_like latency={}", request_metadata.id,
-          _ip_address, _port, latency.count());
+      call(request_metadata, "like:delete_like",
+          [&](const TRequestMetadata& rpc_metadata) {
+        _client->delete_like(rpc_metadata, like_id);
+      });
+    }
+
+    std::future<void> delete_like_async(
+        const TRequestMetadata& request_metadata, const int32_t like_id) {
+      return call_async([=] {
+        return delete_like(request_metadata, like_id);
+      });
     }
 
     std::vector<TLike> list_likes(const TRequestMetadata& request_metadata,
         const TLikeQuery& query, const int32_t limit, const int32_t offset) {
       std::vector<TLike> _return;
-      auto logger = spdlog::get("logger");
-      auto start_time = std::chrono::steady_clock::now();
-      _client->list_likes(_return, request_metadata, query, limit, offset);
-      std::chrono::duration<double> latency = \
-          std::chrono::steady_clock::now() - start_time;
-      logger->info("request_id={} server={}:{} "
-          "function=like:list_likes latency={}", request_metadata.id,
-          _ip_address, _port, latency.count());
+      call(request_metadata, "like:list_likes",
+          [&](const TRequestMetadata& rpc_metadata) {
+        _client->list_likes(_return, rpc_metadata, query, limit, offset);
+      });
       return _return;
     }
 
+    std::future<std::vector<TLike>> list_likes_async(
+        const TRequestMetadata& request_metadata, const TLikeQuery& query,
+        const int32_t limit, const int32_t offset) {
+      return call_async([=] {
+        return list_likes(request_metadata, query, limit, offset);
+      });
+    }
+
     int32_t count_likes_by_account(const TRequestMetadata& request_metadata,
         const int32_t account_id) {
-      auto logger = spdlog::get("logger");
-      auto start_time = std::chrono::steady_clock::now();
-      auto ret = _client->count_likes_by_account(request_metadata, account_id);
-      std::chrono::duration<double> latency = \
-          std::chrono::steady_clock::now() - start_time;
-      logger->info("request_id={} server={}:{} "
-          "function=like:count_likes_by_account latency={}",
-          request_metadata.id, _ip_address, _port, latency.count());
+      int32_t ret;
+      call(request_metadata, "like:count_likes_by_account",
+          [&](const TRequestMetadata& rpc_metadata) {
+        ret = _client->count_likes_by_account(rpc_metadata, account_id);
+      });
       return ret;
     }
 
+    std::future<int32_t> count_likes_by_account_async(
+        const TRequestMetadata& request_metadata, const int32_t account_id) {
+      return call_async([=] {
+        return count_likes_by_account(request_metadata, account_id);
+      });
+    }
+
     int32_t count_likes_of_post(const TRequestMetadata& request_metadata,
         const int32_t post_id) {
-      auto logger = spdlog::get("logger");
-      auto start_time = std::chrono::steady_clock::now();
-      auto ret = _client->count_likes_of_post(request_metadata, post_id);
-      std::chrono::duration<double> latency = \
-          std::chrono::steady_clock::now() - start_time;
-      logger->info("request_id={} server={}:{} "
-          "function=like:count_likes_of_post latency={}", request_metadata.id,
-          _ip_address, _port, latency.count());
+      int32_t ret;
+      call(request_metadata, "like:count_likes_of_post",
+          [&](const TRequestMetadata& rpc_metadata) {
+        ret = _client->count_likes_of_post(rpc_metadata, post_id);
+      });
       return ret;
     }
+
+    std::future<int32_t> count_likes_of_post_async(
+        const TRequestMetadata& request_metadata, const int32_t post_id) {
+      return call_async([=] {
+        return count_likes_of_post(request_metadata, post_id);
+      });
+    }
+
+    std::map<int32_t, int32_t> count_likes_of_posts(
+        const TRequestMetadata& request_metadata,
+        const std::vector<int32_t>& post_ids) {
+      std::map<int32_t, int32_t> _return;
+      call(request_metadata, "like:count_likes_of_posts",
+          [&](const TRequestMetadata& rpc_metadata) {
+        _client->count_likes_of_posts(_return, rpc_metadata, post_ids);
+      });
+      return _return;
+    }
+
+    std::future<std::map<int32_t, int32_t>> count_likes_of_posts_async(
+        const TRequestMetadata& request_metadata,
+        const std::vector<int32_t>& post_ids) {
+      return call_async([=] {
+        return count_likes_of_posts(request_metadata, post_ids);
+      });
+    }
   };
 }
@@ -0,0 +1,90 @@
+// Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
+// Systems
+
+#pragma once
+
+#include <csignal>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include <unistd.h>
+
+#include <thrift/TProcessor.h>
+#include <thrift/concurrency/ThreadFactory.h>
+#include <thrift/concurrency/ThreadManager.h>
+#include <thrift/server/TNonblockingServer.h>
+#include <thrift/server/TServer.h>
+#include <thrift/server/TThreadedServer.h>
+#include <thrift/transport/TNonblockingServerSocket.h>
+#include <thrift/transport/TServerSocket.h>
+
+#include <buzzblog/wire_format.h>
+
+
+#ifdef BUZZBLOG_PGO_GENERATE
+extern "C" void __gcov_dump();
+
+// Servers built for profile-guided optimization write their profiles when they
+// exit, but servers only stop on a signal: write them then.
+inline void dump_profile_on_signal() {
+  auto handler = [](int) {
+    __gcov_dump();
+    _exit(0);
+  };
+  std::signal(SIGINT, handler);
+  std::signal(SIGTERM, handler);
+}
+#endif
+
+// Build a Thrift server for `processor` listening on `host`:`port`. Modes are:
+// - "threaded": one thread per connection, for at most `threads` connections
+//   (TThreadedServer).
+// - "nonblocking": `io_threads` threads multiplex all connections with
+//   libevent, and hand requests to a pool of `threads` workers
+//   (TNonblockingServer). Idle connections do not hold a worker, so the
+//   number of connections is not bounded by the number of threads.
+// There is no mode where a fixed pool of threads serves connections
+// (TThreadPoolServer): each connection would hold a thread until it closes, so
+// the persistent connections kept by client pools would starve it.
+// Servers accept clients of any wire format (see 'wire_format.h'), except that
+// clients must use framed transport without zlib to talk to servers in the
+// "nonblocking" mode.
+inline std::shared_ptr<apache::thrift::server::TServer> make_server(
+    const std::string& mode,
+    const std::shared_ptr<apache::thrift::TProcessor>& processor,
+    const std::string& host, int port, int threads, int io_threads) {
+  using namespace apache::thrift::concurrency;
+  using namespace apache::thrift::protocol;
+  using namespace apache::thrift::server;
+  using namespace apache::thrift::transport;
+
+#ifdef BUZZBLOG_PGO_GENERATE
+  dump_profile_on_signal();
+#endif
+
+  auto negotiating_processor = std::make_shared<NegotiatingProcessor>(
+      processor);
+  if (mode == "threaded") {
+    auto server = std::make_shared<TThreadedServer>(negotiating_processor,
+        std::make_shared<TServerSocket>(host, port),
+        std::make_shared<NegotiatingTransportFactory>(),
+        std::make_shared<NegotiatingProtocolFactory>());
+    server->setConcurrentClientLimit(threads);
+    return server;
+  }
+
+  if (mode != "nonblocking")
+    throw std::invalid_argument("Invalid server mode: " + mode);
+
+  // Start worker threads.
+  auto thread_manager = ThreadManager::newSimpleThreadManager(threads);
+  thread_manager->threadFactory(std::make_shared<ThreadFactory>());
+  thread_manager->start();
+
+  auto server = std::make_shared<TNonblockingServer>(negotiating_processor,
+      std::make_shared<NegotiatingProtocolFactory>(),
+      std::make_shared<TNonblockingServerSocket>(host, port), thread_manager);
+  server->setNumIOThreads(io_threads);
+  return server;
+}
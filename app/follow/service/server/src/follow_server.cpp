@@ -1,17 +1,22 @@
 // Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
 // Systems
 
+#include <map>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 #include <cxxopts.hpp>
-#include <spdlog/sinks/basic_file_sink.h>
-#include <thrift/protocol/TBinaryProtocol.h>
-#include <thrift/server/TThreadedServer.h>
-#include <thrift/transport/TBufferTransports.h>
-#include <thrift/transport/TServerSocket.h>
 
 #include <buzzblog/gen/TFollowService.h>
+#include <buzzblog/admission_controller.h>
 #include <buzzblog/base_server.h>
+#include <buzzblog/call_logger.h>
+#include <buzzblog/call_tracer.h>
+#include <buzzblog/metrics_server.h>
+#include <buzzblog/server_event_handler.h>
+#include <buzzblog/span_collector.h>
+#include <buzzblog/thrift_server.h>
 
 
 using namespace apache::thrift;
@@ -33,6 +38,7 @@ public:
 
   void follow_account(TFollow& _return,
       const TRequestMetadata& request_metadata, const int32_t account_id) {
+    ServerEventHandler::set_request_metadata(request_metadata);
     // Add unique pair (follower, followee).
     auto uniquepair_client = get_uniquepair_client();
     TUniquepair uniquepair;
@@ -43,7 +49,6 @@ public:
     catch (TUniquepairAlreadyExistsException e) {
       throw TFollowAlreadyExistsException();
     }
-    uniquepair_client->close();
 
     // Build follow (standard mode).
     _return.id = uniquepair.id;
@@ -54,6 +59,7 @@ public:
 
   void retrieve_standard_follow(TFollow& _return,
       const TRequestMetadata& request_metadata, const int32_t follow_id) {
+    ServerEventHandler::set_request_metadata(request_metadata);
     // Get unique pair.
     auto uniquepair_client = get_uniquepair_client();
     TUniquepair uniquepair;
@@ -63,7 +69,6 @@ public:
     catch (TUniquepairNotFoundException e) {
       throw TFollowNotFoundException();
     }
-    uniquepair_client->close();
 
     // Build follow (standard mode).
     _return.id = uniquepair.id;
@@ -74,24 +79,32 @@ public:
 
   void retrieve_expanded_follow(TFollow& _return,
       const TRequestMetadata& request_metadata, const int32_t follow_id) {
+    ServerEventHandler::set_request_metadata(request_metadata);
     // Retrieve standard follow.
     retrieve_standard_follow(_return, request_metadata, follow_id);
 
-    // Retrieve accounts.
-    auto account_client = get_account_client();
-    auto follower = account_client->retrieve_standard_account(request_metadata,
-        _return.follower_id);
-    auto followee = account_client->retrieve_standard_account(request_metadata,
-        _return.followee_id);
-    account_client->close();
+    // Retrieve accounts concurrently.
+    auto follower_id = _return.follower_id;
+    auto follower = async_account_call("account:retrieve_standard_account",
+        [=](account_service::Client& client) {
+          return client.retrieve_standard_account(request_metadata,
+              follower_id);
+        });
+    auto followee_id = _return.followee_id;
+    auto followee = hedged_account_call("account:retrieve_standard_account",
+        [=](account_service::Client& client) {
+          return client.retrieve_standard_account(request_metadata,
+              followee_id);
+        });
 
     // Build follow (expanded mode).
-    _return.__set_follower(follower);
+    _return.__set_follower(follower.get());
     _return.__set_followee(followee);
   }
 
   void delete_follow(const TRequestMetadata& request_metadata,
       const int32_t follow_id) {
+    ServerEventHandler::set_request_metadata(request_metadata);
     {
       // Get unique pair.
       auto uniquepair_client = get_uniquepair_client();
@@ -102,7 +115,6 @@ public:
       catch (TUniquepairNotFoundException e) {
         throw TFollowNotFoundException();
       }
-      uniquepair_client->close();
 
       // Check if requester is authorized.
       if (request_metadata.requester_id != uniquepair.first_elem)
@@ -117,12 +129,12 @@ public:
     catch (TUniquepairNotFoundException e) {
       throw TFollowNotFoundException();
     }
-    uniquepair_client->close();
   }
 
   void list_follows(std::vector<TFollow>& _return,
       const TRequestMetadata& request_metadata, const TFollowQuery& query,
       const int32_t limit, const int32_t offset) {
+    ServerEventHandler::set_request_metadata(request_metadata);
     // Build query struct.
     TUniquepairQuery uniquepair_query;
     uniquepair_query.__set_domain("follow");
@@ -130,21 +142,33 @@ public:
       uniquepair_query.__set_first_elem(query.follower_id);
     if (query.__isset.followee_id)
       uniquepair_query.__set_second_elem(query.followee_id);
+    if (query.__isset.cursor)
+      uniquepair_query.__set_cursor(query.cursor);
 
     // Fetch unique pairs.
     auto uniquepair_client = get_uniquepair_client();
     std::vector<TUniquepair> uniquepairs = uniquepair_client->fetch(
         request_metadata, uniquepair_query, limit, offset);
-    uniquepair_client->close();
+
+    // Retrieve accounts.
+    std::map<int32_t, TAccount> accounts;
+    if (!uniquepairs.empty()) {
+      std::vector<int32_t> account_ids;
+      for (auto it : uniquepairs) {
+        account_ids.push_back(it.first_elem);
+        account_ids.push_back(it.second_elem);
+      }
+      accounts = get_account_client()->retrieve_standard_accounts(
+          request_metadata, account_ids);
+    }
 
     // Build follows.
-    auto account_client = get_account_client();
     for (auto it : uniquepairs) {
       // Retrieve accounts.
-      auto follower = account_client->retrieve_standard_account(
-          request_metadata, it.first_elem);
-      auto followee = account_client->retrieve_standard_account(
-          request_metadata, it.second_elem);
+      auto follower = accounts.find(it.first_elem);
+      auto followee = accounts.find(it.second_elem);
+      if (follower == accounts.end() || followee == accounts.end())
+        throw TAccountNotFoundException();
 
       // Build follow (expanded mode).
       TFollow follow;
@@ -152,55 +176,58 @@ public:
       follow.created_at = it.created_at;
       follow.follower_id = it.first_elem;
       follow.followee_id = it.second_elem;
-      follow.__set_follower(follower);
-      follow.__set_followee(followee);
+      follow.__set_follower(follower->second);
+      follow.__set_followee(followee->second);
       _return.push_back(follow);
     }
-    account_client->close();
   }
 
   bool check_follow(const TRequestMetadata& request_metadata,
       const int32_t follower_id, const int32_t followee_id) {
+    ServerEventHandler::set_request_metadata(request_metadata);
     bool follow_exists;
-    auto uniquepair_client = get_uniquepair_client();
     try {
-      uniquepair_client->find(request_metadata, "follow", follower_id,
-          followee_id);
+      hedged_uniquepair_call("uniquepair:find",
+          [=](uniquepair_service::Client& client) {
+            return client.find(request_metadata, "follow", follower_id,
+                followee_id);
+          });
       follow_exists = true;
     }
     catch (TUniquepairNotFoundException e) {
       follow_exists = false;
     }
-    uniquepair_client->close();
     return follow_exists;
   }
 
   int32_t count_followers(const TRequestMetadata& request_metadata,
       const int32_t account_id) {
+    ServerEventHandler::set_request_metadata(request_metadata);
     // Build query struct.
     TUniquepairQuery query;
     query.__set_domain("follow");
     query.__set_second_elem(account_id);
 
     // Count unique pairs.
-    auto uniquepair_client = get_uniquepair_client();
-    auto count = uniquepair_client->count(request_metadata, query);
-    uniquepair_client->close();
-    return count;
+    return hedged_uniquepair_call("uniquepair:count",
+        [=](uniquepair_service::Client& client) {
+          return client.count(request_metadata, query);
+        });
   }
 
   int32_t count_followees(const TRequestMetadata& request_metadata,
       const int32_t account_id) {
+    ServerEventHandler::set_request_metadata(request_metadata);
     // Build query struct.
     TUniquepairQuery query;
     query.__set_domain("follow");
     query.__set_first_elem(account_id);
 
     // Count unique pairs.
-    auto uniquepair_client = get_uniquepair_client();
-    auto count = uniquepair_client->count(request_metadata, query);
-    uniquepair_client->close();
-    return count;
+    return hedged_uniquepair_call("uniquepair:count",
+        [=](uniquepair_service::Client& client) {
+          return client.count(request_metadata, query);
+        });
   }
 };
 
@@ -212,6 +239,21 @@ int main(int argc, char** argv) {
       ("host", "", cxxopts::value<std::string>()->default_value("0.0.0.0"))
       ("port", "", cxxopts::value<int>())
       ("threads", "", cxxopts::value<int>())
+      ("server_mode", "", cxxopts::value<std::string>()->default_value(
+          "nonblocking"))
+      ("io_threads", "", cxxopts::value<int>()->default_value("2"))
+      ("client_threads", "", cxxopts::value<int>()->default_value("32"))
+      ("log_queue_size", "", cxxopts::value<int>()->default_value("8192"))
+      ("log_blocking", "", cxxopts::value<bool>()->default_value("false"))
+      ("handler_log", "", cxxopts::value<bool>()->default_value("false"))
+      ("trace_format", "", cxxopts::value<std::string>()->default_value(
+          "text"))
+      ("trace_file_size_mb", "", cxxopts::value<int>()->default_value("64"))
+      ("trace_max_files", "", cxxopts::value<int>()->default_value("8"))
+      ("metrics_port", "", cxxopts::value<int>()->default_value("0"))
+      ("span_sample_rate", "", cxxopts::value<double>()->default_value("0"))
+      ("admission_limit", "", cxxopts::value<int>()->default_value("0"))
+      ("admission_max_limit", "", cxxopts::value<int>()->default_value("1000"))
       ("backend_filepath", "", cxxopts::value<std::string>()->default_value(
           "/etc/opt/BuzzBlogApp/backend.yml"))
       ("postgres_user", "", cxxopts::value<std::string>()->default_value(
@@ -226,27 +268,62 @@ int main(int argc, char** argv) {
   std::string host = result["host"].as<std::string>();
   int port = result["port"].as<int>();
   int threads = result["threads"].as<int>();
+  std::string server_mode = result["server_mode"].as<std::string>();
+  int io_threads = result["io_threads"].as<int>();
+  int client_threads = result["client_threads"].as<int>();
+  int log_queue_size = result["log_queue_size"].as<int>();
+  bool log_blocking = result["log_blocking"].as<bool>();
+  bool handler_log = result["handler_log"].as<bool>();
+  std::string trace_format = result["trace_format"].as<std::string>();
+  int trace_file_size_mb = result["trace_file_size_mb"].as<int>();
+  int trace_max_files = result["trace_max_files"].as<int>();
+  int metrics_port = result["metrics_port"].as<int>();
+  double span_sample_rate = result["span_sample_rate"].as<double>();
+  int admission_limit = result["admission_limit"].as<int>();
+  int admission_max_limit = result["admission_max_limit"].as<int>();
   std::string backend_filepath = result["backend_filepath"].as<std::string>();
   std::string postgres_user = result["postgres_user"].as<std::string>();
   std::string postgres_password = result["postgres_password"].as<std::string>();
   std::string postgres_dbname = result["postgres_dbname"].as<std::string>();
 
-  // Initialize logger.
-  auto logger = spdlog::basic_logger_mt("logger", "/tmp/calls.log");
-  logger->set_pattern("[%H:%M:%S.%F] pid=%P tid=%t %v");
+  // Initialize loggers. The phases of handled calls are only logged on
+  // request.
+  if (trace_format == "text")
+    init_call_logger("/tmp/calls.log", log_queue_size, log_blocking);
+  else if (trace_format == "binary")
+    init_call_tracer("/tmp/calls.bin", size_t(trace_file_size_mb) << 20,
+        trace_max_files);
+  else
+    throw std::invalid_argument("Invalid trace format: " + trace_format);
+  if (handler_log)
+    init_handler_logger("/tmp/handlers.log", log_blocking);
+
+  // Initialize span collector.
+  if (span_sample_rate > 0)
+    init_span_collector("/tmp/spans.json", "follow", span_sample_rate);
+
+  // Initialize admission controller.
+  if (admission_limit > 0)
+    init_admission_controller(admission_limit, admission_max_limit);
+
+  // Initialize executor of asynchronous RPCs.
+  if (client_threads > 0)
+    init_client_executor(client_threads);
+
+  // Serve metrics.
+  if (metrics_port)
+    start_metrics_server(metrics_port);
 
   // Create server.
-  TThreadedServer server(
-      std::make_shared<TFollowServiceProcessor>(
-          std::make_shared<TFollowServiceHandler>(backend_filepath,
-              postgres_user, postgres_password, postgres_dbname)),
-      std::make_shared<TServerSocket>(host, port),
-      std::make_shared<TBufferedTransportFactory>(),
-      std::make_shared<TBinaryProtocolFactory>());
-  server.setConcurrentClientLimit(threads);
+  auto processor = std::make_shared<TFollowServiceProcessor>(
+      std::make_shared<TFollowServiceHandler>(backend_filepath,
+          postgres_user, postgres_password, postgres_dbname));
+  processor->setEventHandler(std::make_shared<ServerEventHandler>());
+  auto server = make_server(server_mode, processor, host, port, threads,
+      io_threads);
 
   // Serve requests.
-  server.serve();
+  server->serve();
 
   return 0;
 }
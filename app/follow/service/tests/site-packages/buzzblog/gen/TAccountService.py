@@ -50,6 +50,15 @@ class Iface(object):
         """
         pass
 
+    def retrieve_standard_accounts(self, request_metadata, account_ids):
+        """
+        Parameters:
+         - request_metadata
+         - account_ids
+
+        """
+        pass
+
     def retrieve_expanded_account(self, request_metadata, account_id):
         """
         Parameters:
@@ -126,6 +135,8 @@ class Client(Iface):
             raise result.e1
         if result.e2 is not None:
             raise result.e2
+        if result.overloaded is not None:
+            raise result.overloaded
         raise TApplicationException(TApplicationException.MISSING_RESULT, "authenticate_user failed: unknown result")
 
     def create_account(self, request_metadata, username, password, first_name, last_name):
@@ -170,6 +181,8 @@ class Client(Iface):
             raise result.e1
         if result.e2 is not None:
             raise result.e2
+        if result.overloaded is not None:
+            raise result.overloaded
         raise TApplicationException(TApplicationException.MISSING_RESULT, "create_account failed: unknown result")
 
     def retrieve_standard_account(self, request_metadata, account_id):
@@ -206,8 +219,46 @@ class Client(Iface):
             return result.success
         if result.e is not None:
             raise result.e
+        if result.overloaded is not None:
+            raise result.overloaded
         raise TApplicationException(TApplicationException.MISSING_RESULT, "retrieve_standard_account failed: unknown result")
 
+    def retrieve_standard_accounts(self, request_metadata, account_ids):
+        """
+        Parameters:
+         - request_metadata
+         - account_ids
+
+        """
+        self.send_retrieve_standard_accounts(request_metadata, account_ids)
+        return self.recv_retrieve_standard_accounts()
+
+    def send_retrieve_standard_accounts(self, request_metadata, account_ids):
+        self._oprot.writeMessageBegin('retrieve_standard_accounts', TMessageType.CALL, self._seqid)
+        args = retrieve_standard_accounts_args()
+        args.request_metadata = request_metadata
+        args.account_ids = account_ids
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_retrieve_standard_accounts(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = retrieve_standard_accounts_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.success is not None:
+            return result.success
+        if result.overloaded is not None:
+            raise result.overloaded
+        raise TApplicationException(TApplicationException.MISSING_RESULT, "retrieve_standard_accounts failed: unknown result")
+
     def retrieve_expanded_account(self, request_metadata, account_id):
         """
         Parameters:
@@ -242,6 +293,8 @@ class Client(Iface):
             return result.success
         if result.e is not None:
             raise result.e
+        if result.overloaded is not None:
+            raise result.overloaded
         raise TApplicationException(TApplicationException.MISSING_RESULT, "retrieve_expanded_account failed: unknown result")
 
     def update_account(self, request_metadata, account_id, password, first_name, last_name):
@@ -288,6 +341,8 @@ class Client(Iface):
             raise result.e2
         if result.e3 is not None:
             raise result.e3
+        if result.overloaded is not None:
+            raise result.overloaded
         raise TApplicationException(TApplicationException.MISSING_RESULT, "update_account failed: unknown result")
 
     def delete_account(self, request_metadata, account_id):
@@ -324,6 +379,8 @@ class Client(Iface):
             raise result.e1
         if result.e2 is not None:
             raise result.e2
+        if result.overloaded is not None:
+            raise result.overloaded
         return
 
 
@@ -334,6 +391,7 @@ class Processor(Iface, TProcessor):
         self._processMap["authenticate_user"] = Processor.process_authenticate_user
         self._processMap["create_account"] = Processor.process_create_account
         self._processMap["retrieve_standard_account"] = Processor.process_retrieve_standard_account
+        self._processMap["retrieve_standard_accounts"] = Processor.process_retrieve_standard_accounts
         self._processMap["retrieve_expanded_account"] = Processor.process_retrieve_expanded_account
         self._processMap["update_account"] = Processor.process_update_account
         self._processMap["delete_account"] = Processor.process_delete_account
@@ -375,6 +433,9 @@ class Processor(Iface, TProcessor):
         except TAccountDeactivatedException as e2:
             msg_type = TMessageType.REPLY
             result.e2 = e2
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -404,6 +465,9 @@ class Processor(Iface, TProcessor):
         except TAccountUsernameAlreadyExistsException as e2:
             msg_type = TMessageType.REPLY
             result.e2 = e2
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -430,6 +494,9 @@ class Processor(Iface, TProcessor):
         except TAccountNotFoundException as e:
             msg_type = TMessageType.REPLY
             result.e = e
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -443,6 +510,32 @@ class Processor(Iface, TProcessor):
         oprot.writeMessageEnd()
         oprot.trans.flush()
 
+    def process_retrieve_standard_accounts(self, seqid, iprot, oprot):
+        args = retrieve_standard_accounts_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = retrieve_standard_accounts_result()
+        try:
+            result.success = self._handler.retrieve_standard_accounts(args.request_metadata, args.account_ids)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("retrieve_standard_accounts", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
     def process_retrieve_expanded_account(self, seqid, iprot, oprot):
         args = retrieve_expanded_account_args()
         args.read(iprot)
@@ -456,6 +549,9 @@ class Processor(Iface, TProcessor):
         except TAccountNotFoundException as e:
             msg_type = TMessageType.REPLY
             result.e = e
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -488,6 +584,9 @@ class Processor(Iface, TProcessor):
         except TAccountNotFoundException as e3:
             msg_type = TMessageType.REPLY
             result.e3 = e3
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -517,6 +616,9 @@ class Processor(Iface, TProcessor):
         except TAccountNotFoundException as e2:
             msg_type = TMessageType.REPLY
             result.e2 = e2
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -626,14 +728,16 @@ class authenticate_user_result(object):
      - success
      - e1
      - e2
+     - overloaded
 
     """
 
 
-    def __init__(self, success=None, e1=None, e2=None,):
+    def __init__(self, success=None, e1=None, e2=None, overloaded=None,):
         self.success = success
         self.e1 = e1
         self.e2 = e2
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -662,6 +766,12 @@ class authenticate_user_result(object):
                     self.e2.read(iprot)
                 else:
                     iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -684,6 +794,10 @@ class authenticate_user_result(object):
             oprot.writeFieldBegin('e2', TType.STRUCT, 2)
             self.e2.write(oprot)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 3)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -705,6 +819,7 @@ authenticate_user_result.thrift_spec = (
     (0, TType.STRUCT, 'success', [TAccount, None], None, ),  # 0
     (1, TType.STRUCT, 'e1', [TAccountInvalidCredentialsException, None], None, ),  # 1
     (2, TType.STRUCT, 'e2', [TAccountDeactivatedException, None], None, ),  # 2
+    (3, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 3
 )
 
 
@@ -825,14 +940,16 @@ class create_account_result(object):
      - success
      - e1
      - e2
+     - overloaded
 
     """
 
 
-    def __init__(self, success=None, e1=None, e2=None,):
+    def __init__(self, success=None, e1=None, e2=None, overloaded=None,):
         self.success = success
         self.e1 = e1
         self.e2 = e2
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -861,6 +978,12 @@ class create_account_result(object):
                     self.e2.read(iprot)
                 else:
                     iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -883,6 +1006,10 @@ class create_account_result(object):
             oprot.writeFieldBegin('e2', TType.STRUCT, 2)
             self.e2.write(oprot)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 3)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -904,6 +1031,7 @@ create_account_result.thrift_spec = (
     (0, TType.STRUCT, 'success', [TAccount, None], None, ),  # 0
     (1, TType.STRUCT, 'e1', [TAccountInvalidAttributesException, None], None, ),  # 1
     (2, TType.STRUCT, 'e2', [TAccountUsernameAlreadyExistsException, None], None, ),  # 2
+    (3, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 3
 )
 
 
@@ -987,13 +1115,15 @@ class retrieve_standard_account_result(object):
     Attributes:
      - success
      - e
+     - overloaded
 
     """
 
 
-    def __init__(self, success=None, e=None,):
+    def __init__(self, success=None, e=None, overloaded=None,):
         self.success = success
         self.e = e
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -1016,6 +1146,12 @@ class retrieve_standard_account_result(object):
                     self.e.read(iprot)
                 else:
                     iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -1034,6 +1170,10 @@ class retrieve_standard_account_result(object):
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
             self.e.write(oprot)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 2)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -1054,6 +1194,175 @@ all_structs.append(retrieve_standard_account_result)
 retrieve_standard_account_result.thrift_spec = (
     (0, TType.STRUCT, 'success', [TAccount, None], None, ),  # 0
     (1, TType.STRUCT, 'e', [TAccountNotFoundException, None], None, ),  # 1
+    (2, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 2
+)
+
+
+class retrieve_standard_accounts_args(object):
+    """
+    Attributes:
+     - request_metadata
+     - account_ids
+
+    """
+
+
+    def __init__(self, request_metadata=None, account_ids=None,):
+        self.request_metadata = request_metadata
+        self.account_ids = account_ids
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRUCT:
+                    self.request_metadata = TRequestMetadata()
+                    self.request_metadata.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.LIST:
+                    self.account_ids = []
+                    (_etype3, _size0) = iprot.readListBegin()
+                    for _i4 in range(_size0):
+                        _elem5 = iprot.readI32()
+                        self.account_ids.append(_elem5)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('retrieve_standard_accounts_args')
+        if self.request_metadata is not None:
+            oprot.writeFieldBegin('request_metadata', TType.STRUCT, 1)
+            self.request_metadata.write(oprot)
+            oprot.writeFieldEnd()
+        if self.account_ids is not None:
+            oprot.writeFieldBegin('account_ids', TType.LIST, 2)
+            oprot.writeListBegin(TType.I32, len(self.account_ids))
+            for iter6 in self.account_ids:
+                oprot.writeI32(iter6)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(retrieve_standard_accounts_args)
+retrieve_standard_accounts_args.thrift_spec = (
+    None,  # 0
+    (1, TType.STRUCT, 'request_metadata', [TRequestMetadata, None], None, ),  # 1
+    (2, TType.LIST, 'account_ids', (TType.I32, None, False), None, ),  # 2
+)
+
+
+class retrieve_standard_accounts_result(object):
+    """
+    Attributes:
+     - success
+     - overloaded
+
+    """
+
+
+    def __init__(self, success=None, overloaded=None,):
+        self.success = success
+        self.overloaded = overloaded
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 0:
+                if ftype == TType.MAP:
+                    self.success = {}
+                    (_ktype8, _vtype9, _size7) = iprot.readMapBegin()
+                    for _i11 in range(_size7):
+                        _key12 = iprot.readI32()
+                        _val13 = TAccount()
+                        _val13.read(iprot)
+                        self.success[_key12] = _val13
+                    iprot.readMapEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('retrieve_standard_accounts_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.MAP, 0)
+            oprot.writeMapBegin(TType.I32, TType.STRUCT, len(self.success))
+            for kiter14, viter15 in self.success.items():
+                oprot.writeI32(kiter14)
+                viter15.write(oprot)
+            oprot.writeMapEnd()
+            oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 1)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(retrieve_standard_accounts_result)
+retrieve_standard_accounts_result.thrift_spec = (
+    (0, TType.MAP, 'success', (TType.I32, None, TType.STRUCT, [TAccount, None], False), None, ),  # 0
+    (1, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 1
 )
 
 
@@ -1137,13 +1446,15 @@ class retrieve_expanded_account_result(object):
     Attributes:
      - success
      - e
+     - overloaded
 
     """
 
 
-    def __init__(self, success=None, e=None,):
+    def __init__(self, success=None, e=None, overloaded=None,):
         self.success = success
         self.e = e
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -1166,6 +1477,12 @@ class retrieve_expanded_account_result(object):
                     self.e.read(iprot)
                 else:
                     iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -1184,6 +1501,10 @@ class retrieve_expanded_account_result(object):
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
             self.e.write(oprot)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 2)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -1204,6 +1525,7 @@ all_structs.append(retrieve_expanded_account_result)
 retrieve_expanded_account_result.thrift_spec = (
     (0, TType.STRUCT, 'success', [TAccount, None], None, ),  # 0
     (1, TType.STRUCT, 'e', [TAccountNotFoundException, None], None, ),  # 1
+    (2, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 2
 )
 
 
@@ -1325,15 +1647,17 @@ class update_account_result(object):
      - e1
      - e2
      - e3
+     - overloaded
 
     """
 
 
-    def __init__(self, success=None, e1=None, e2=None, e3=None,):
+    def __init__(self, success=None, e1=None, e2=None, e3=None, overloaded=None,):
         self.success = success
         self.e1 = e1
         self.e2 = e2
         self.e3 = e3
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -1368,6 +1692,12 @@ class update_account_result(object):
                     self.e3.read(iprot)
                 else:
                     iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -1394,6 +1724,10 @@ class update_account_result(object):
             oprot.writeFieldBegin('e3', TType.STRUCT, 3)
             self.e3.write(oprot)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 4)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -1416,6 +1750,7 @@ update_account_result.thrift_spec = (
     (1, TType.STRUCT, 'e1', [TAccountNotAuthorizedException, None], None, ),  # 1
     (2, TType.STRUCT, 'e2', [TAccountInvalidAttributesException, None], None, ),  # 2
     (3, TType.STRUCT, 'e3', [TAccountNotFoundException, None], None, ),  # 3
+    (4, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 4
 )
 
 
@@ -1499,13 +1834,15 @@ class delete_account_result(object):
     Attributes:
      - e1
      - e2
+     - overloaded
 
     """
 
 
-    def __init__(self, e1=None, e2=None,):
+    def __init__(self, e1=None, e2=None, overloaded=None,):
         self.e1 = e1
         self.e2 = e2
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -1528,6 +1865,12 @@ class delete_account_result(object):
                     self.e2.read(iprot)
                 else:
                     iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -1546,6 +1889,10 @@ class delete_account_result(object):
             oprot.writeFieldBegin('e2', TType.STRUCT, 2)
             self.e2.write(oprot)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 3)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -1567,6 +1914,7 @@ delete_account_result.thrift_spec = (
     None,  # 0
     (1, TType.STRUCT, 'e1', [TAccountNotAuthorizedException, None], None, ),  # 1
     (2, TType.STRUCT, 'e2', [TAccountNotFoundException, None], None, ),  # 2
+    (3, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 3
 )
 fix_spec(all_structs)
 del all_structs
@@ -1,18 +1,30 @@
 # Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
 # Systems
 
+import random
 import time
 
 import spdlog as spd
 from thrift.transport import TSocket
 from thrift.transport import TTransport
+from thrift.transport import TZlibTransport
 from thrift.protocol import TBinaryProtocol
+from thrift.protocol import TCompactProtocol
 
 from buzzblog.gen import TLikeService
 
 
 def instrumented(func):
   def func_wrapper(self, request_metadata, *args, **kwargs):
+    # Every call is a new span, so that backend services can tell apart the
+    # calls made for the same request (see 'span_collector.h').
+    request_metadata.span_id = random.getrandbits(63) or 1
+    # Calls made for the same request share the deadline set by the first one,
+    # and wait for the server no longer than the time left before it.
+    if getattr(request_metadata, "deadline_ms", None) is None:
+      request_metadata.deadline_ms = int(time.time() * 1000) + self._timeout
+    self._socket.setTimeout(max(
+        request_metadata.deadline_ms - int(time.time() * 1000), 1))
     start_time = time.monotonic()
     ret = func(self, request_metadata, *args, **kwargs)
     latency = time.monotonic() - start_time
@@ -28,13 +40,25 @@ def instrumented(func):
 
 
 class Client:
-  def __init__(self, ip_address, port, timeout=10000):
+  def __init__(self, ip_address, port, timeout=10000, framed=True,
+      compact=False, zlib=False):
     self._ip_address = ip_address
     self._port = port
+    self._timeout = timeout
     self._socket = TSocket.TSocket(ip_address, port)
     self._socket.setTimeout(timeout)
-    self._transport = TTransport.TBufferedTransport(self._socket)
-    self._protocol = TBinaryProtocol.TBinaryProtocol(self._transport)
+    # Wire format of calls (see 'wire_format.h').
+    stream = self._socket
+    if zlib:
+      stream = TZlibTransport.TZlibTransport(stream, compresslevel=6)
+    if framed:
+      self._transport = TTransport.TFramedTransport(stream)
+    else:
+      self._transport = TTransport.TBufferedTransport(stream)
+    if compact:
+      self._protocol = TCompactProtocol.TCompactProtocol(self._transport)
+    else:
+      self._protocol = TBinaryProtocol.TBinaryProtocol(self._transport)
     self._tclient = TLikeService.Client(self._protocol)
     self._transport.open()
 
@@ -85,3 +109,8 @@ class Client:
   def count_likes_of_post(self, request_metadata, post_id):
     return self._tclient.count_likes_of_post(request_metadata=request_metadata,
         post_id=post_id)
+
+  @instrumented
+  def count_likes_of_posts(self, request_metadata, post_ids):
+    return self._tclient.count_likes_of_posts(
+        request_metadata=request_metadata, post_ids=post_ids)
@@ -1,11 +1,16 @@
 // Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
 // Systems
 
+#include <chrono>
 #include <iostream>
 #include <memory>
+#include <sstream>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include <pqxx/pqxx>
 #include <yaml-cpp/yaml.h>
 
 #include <buzzblog/account_client.h>
@@ -13,6 +18,14 @@
 #include <buzzblog/like_client.h>
 #include <buzzblog/post_client.h>
 #include <buzzblog/uniquepair_client.h>
+#include <buzzblog/circuit_breaker.h>
+#include <buzzblog/client_executor.h>
+#include <buzzblog/client_pool.h>
+#include <buzzblog/hedging.h>
+#include <buzzblog/load_balancer.h>
+#include <buzzblog/metrics.h>
+#include <buzzblog/pg_connection_pool.h>
+#include <buzzblog/wire_format.h>
 
 
 class BaseServer {
@@ -23,22 +36,49 @@ protected:
       const std::string& postgres_dbname) {
     char conn_cstr[128];
     const char *conn_fmt = "postgres://%s:%s@%s:%d/%s";
+    const int default_db_pool_size = 8;
+    const int default_service_pool_size = 2;
+    const int default_service_max_connections = 32;
 
     // Parse configuration.
     std::cout << "Initializing BaseServer:" << std::endl;
     auto backend = YAML::LoadFile(backend_filepath);
     if (backend["account"]) {
       // Load account service configuration.
+      auto account_service_pool_size =
+          backend["account"]["service_pool_size"] ?
+          backend["account"]["service_pool_size"].as<int>() :
+          default_service_pool_size;
+      auto account_service_max_connections =
+          backend["account"]["service_max_connections"] ?
+          backend["account"]["service_max_connections"].as<int>() :
+          default_service_max_connections;
+      // Calls are made in the wire format of the service.
+      auto account_wire_format = make_wire_format(backend["account"]);
+      // Servers are chosen by a load-balancing policy ("p2c" by default).
+      if (backend["account"]["load_balancing"])
+        account_balancer = LoadBalancer(
+            backend["account"]["load_balancing"].as<std::string>());
+      // Idempotent reads may be hedged (disabled by default).
+      if (backend["account"]["hedging_percentile"])
+        account_hedger = make_hedger(backend["account"]);
+      // Failing servers are ejected by circuit breakers.
+      auto account_breaker_options = make_breaker_options(backend["account"]);
       auto account_service = backend["account"]["service"];
       for (auto it = account_service.begin(); it != account_service.end(); it++) {
         auto server = it->as<std::string>();
         auto hostname = server.substr(0, server.find(":"));
         auto port = std::stoi(server.substr(server.find(":") + 1));
-        this->account_service.push_back(std::make_pair(hostname, port));
+        this->account_service.push_back(
+            std::make_shared<ClientPool<account_service::Client>>(
+                hostname, port, account_service_pool_size,
+                account_service_max_connections, 10000,
+                account_wire_format, account_breaker_options));
+        export_stats("account", this->account_service.back());
         std::cout << "\tAdded account service on " << \
             hostname << ":" << port << std::endl;
       }
-      // Build account database connection string.
+      // Build account database connection pool.
       auto account_db = backend["account"]["database"].as<std::string>();
       auto account_db_host = account_db.substr(0, account_db.find(":"));
       auto account_db_port = std::stoi(
@@ -46,69 +86,179 @@ protected:
       sprintf(conn_cstr, conn_fmt, postgres_user.c_str(),
           postgres_password.c_str(), account_db_host.c_str(), account_db_port,
           postgres_dbname.c_str());
-      account_db_conn_str = std::string(conn_cstr);
+      auto account_db_pool_size = backend["account"]["database_pool_size"] ?
+          backend["account"]["database_pool_size"].as<int>() :
+          default_db_pool_size;
+      account_db_pool = std::make_unique<PGConnectionPool>(
+          std::string(conn_cstr), account_db_pool_size,
+          metrics().histogram("buzzblog_pool_wait_seconds",
+              "pool=\"account_db\""));
+      export_stats("account_db", account_db_pool.get());
       std::cout << "\tAdded account database on: " << \
-          account_db_host << ":" << account_db_port << std::endl;
+          account_db_host << ":" << account_db_port << " (pool size: " << \
+          account_db_pool_size << ")" << std::endl;
     }
     if (backend["follow"]) {
       // Load follow service configuration.
+      auto follow_service_pool_size = backend["follow"]["service_pool_size"] ?
+          backend["follow"]["service_pool_size"].as<int>() :
+          default_service_pool_size;
+      auto follow_service_max_connections =
+          backend["follow"]["service_max_connections"] ?
+          backend["follow"]["service_max_connections"].as<int>() :
+          default_service_max_connections;
+      // Calls are made in the wire format of the service.
+      auto follow_wire_format = make_wire_format(backend["follow"]);
+      // Servers are chosen by a load-balancing policy ("p2c" by default).
+      if (backend["follow"]["load_balancing"])
+        follow_balancer = LoadBalancer(
+            backend["follow"]["load_balancing"].as<std::string>());
+      // Idempotent reads may be hedged (disabled by default).
+      if (backend["follow"]["hedging_percentile"])
+        follow_hedger = make_hedger(backend["follow"]);
+      // Failing servers are ejected by circuit breakers.
+      auto follow_breaker_options = make_breaker_options(backend["follow"]);
       auto follow_service = backend["follow"]["service"];
       for (auto it = follow_service.begin(); it != follow_service.end(); it++) {
         auto server = it->as<std::string>();
         auto hostname = server.substr(0, server.find(":"));
         auto port = std::stoi(server.substr(server.find(":") + 1));
-        this->follow_service.push_back(std::make_pair(hostname, port));
+        this->follow_service.push_back(
+            std::make_shared<ClientPool<follow_service::Client>>(
+                hostname, port, follow_service_pool_size,
+                follow_service_max_connections, 10000,
+                follow_wire_format, follow_breaker_options));
+        export_stats("follow", this->follow_service.back());
         std::cout << "\tAdded follow service on " << \
             hostname << ":" << port << std::endl;
       }
     }
     if (backend["like"]) {
       // Load like service configuration.
+      auto like_service_pool_size = backend["like"]["service_pool_size"] ?
+          backend["like"]["service_pool_size"].as<int>() :
+          default_service_pool_size;
+      auto like_service_max_connections =
+          backend["like"]["service_max_connections"] ?
+          backend["like"]["service_max_connections"].as<int>() :
+          default_service_max_connections;
+      // Calls are made in the wire format of the service.
+      auto like_wire_format = make_wire_format(backend["like"]);
+      // Servers are chosen by a load-balancing policy ("p2c" by default).
+      if (backend["like"]["load_balancing"])
+        like_balancer = LoadBalancer(
+            backend["like"]["load_balancing"].as<std::string>());
+      // Idempotent reads may be hedged (disabled by default).
+      if (backend["like"]["hedging_percentile"])
+        like_hedger = make_hedger(backend["like"]);
+      // Failing servers are ejected by circuit breakers.
+      auto like_breaker_options = make_breaker_options(backend["like"]);
       auto like_service = backend["like"]["service"];
       for (auto it = like_service.begin(); it != like_service.end(); it++) {
         auto server = it->as<std::string>();
         auto hostname = server.substr(0, server.find(":"));
         auto port = std::stoi(server.substr(server.find(":") + 1));
-        this->like_service.push_back(std::make_pair(hostname, port));
+        this->like_service.push_back(
+            std::make_shared<ClientPool<like_service::Client>>(
+                hostname, port, like_service_pool_size,
+                like_service_max_connections, 10000,
+                like_wire_format, like_breaker_options));
+        export_stats("like", this->like_service.back());
         std::cout << "\tAdded like service on " << \
             hostname << ":" << port << std::endl;
       }
     }
     if (backend["post"]) {
       // Load post service configuration.
+      auto post_service_pool_size = backend["post"]["service_pool_size"] ?
+          backend["post"]["service_pool_size"].as<int>() :
+          default_service_pool_size;
+      auto post_service_max_connections =
+          backend["post"]["service_max_connections"] ?
+          backend["post"]["service_max_connections"].as<int>() :
+          default_service_max_connections;
+      // Calls are made in the wire format of the service.
+      auto post_wire_format = make_wire_format(backend["post"]);
+      // Servers are chosen by a load-balancing policy ("p2c" by default).
+      if (backend["post"]["load_balancing"])
+        post_balancer = LoadBalancer(
+            backend["post"]["load_balancing"].as<std::string>());
+      // Idempotent reads may be hedged (disabled by default).
+      if (backend["post"]["hedging_percentile"])
+        post_hedger = make_hedger(backend["post"]);
+      // Failing servers are ejected by circuit breakers.
+      auto post_breaker_options = make_breaker_options(backend["post"]);
       auto post_service = backend["post"]["service"];
       for (auto it = post_service.begin(); it != post_service.end(); it++) {
         auto server = it->as<std::string>();
         auto hostname = server.substr(0, server.find(":"));
         auto port = std::stoi(server.substr(server.find(":") + 1));
-        this->post_service.push_back(std::make_pair(hostname, port));
+        this->post_service.push_back(
+            std::make_shared<ClientPool<post_service::Client>>(
+                hostname, port, post_service_pool_size,
+                post_service_max_connections, 10000,
+                post_wire_format, post_breaker_options));
+        export_stats("post", this->post_service.back());
         std::cout << "\tAdded post service on " << \
             hostname << ":" << port << std::endl;
       }
-      // Build post database connection string.
+      // Build post database connection pool.
       auto post_db = backend["post"]["database"].as<std::string>();
       auto post_db_host = post_db.substr(0, post_db.find(":"));
       auto post_db_port = std::stoi(post_db.substr(post_db.find(":") + 1));
       sprintf(conn_cstr, conn_fmt, postgres_user.c_str(),
           postgres_password.c_str(), post_db_host.c_str(), post_db_port,
           postgres_dbname.c_str());
-      post_db_conn_str = std::string(conn_cstr);
+      auto post_db_pool_size = backend["post"]["database_pool_size"] ?
+          backend["post"]["database_pool_size"].as<int>() :
+          default_db_pool_size;
+      post_db_pool = std::make_unique<PGConnectionPool>(
+          std::string(conn_cstr), post_db_pool_size,
+          metrics().histogram("buzzblog_pool_wait_seconds",
+              "pool=\"post_db\""));
+      export_stats("post_db", post_db_pool.get());
       std::cout << "\tAdded post database on: " << \
-          post_db_host << ":" << post_db_port << std::endl;
+          post_db_host << ":" << post_db_port << " (pool size: " << \
+          post_db_pool_size << ")" << std::endl;
     }
     if (backend["uniquepair"]) {
       // Load uniquepair service configuration.
+      auto uniquepair_service_pool_size =
+          backend["uniquepair"]["service_pool_size"] ?
+          backend["uniquepair"]["service_pool_size"].as<int>() :
+          default_service_pool_size;
+      auto uniquepair_service_max_connections =
+          backend["uniquepair"]["service_max_connections"] ?
+          backend["uniquepair"]["service_max_connections"].as<int>() :
+          default_service_max_connections;
+      // Calls are made in the wire format of the service.
+      auto uniquepair_wire_format = make_wire_format(backend["uniquepair"]);
+      // Servers are chosen by a load-balancing policy ("p2c" by default).
+      if (backend["uniquepair"]["load_balancing"])
+        uniquepair_balancer = LoadBalancer(
+            backend["uniquepair"]["load_balancing"].as<std::string>());
+      // Idempotent reads may be hedged (disabled by default).
+      if (backend["uniquepair"]["hedging_percentile"])
+        uniquepair_hedger = make_hedger(backend["uniquepair"]);
+      // Failing servers are ejected by circuit breakers.
+      auto uniquepair_breaker_options =
+          make_breaker_options(backend["uniquepair"]);
       auto uniquepair_service = backend["uniquepair"]["service"];
       for (auto it = uniquepair_service.begin(); it != uniquepair_service.end();
           it++) {
         auto server = it->as<std::string>();
         auto hostname = server.substr(0, server.find(":"));
         auto port = std::stoi(server.substr(server.find(":") + 1));
-        this->uniquepair_service.push_back(std::make_pair(hostname, port));
+        this->uniquepair_service.push_back(
+            std::make_shared<ClientPool<uniquepair_service::Client>>(
+                hostname, port, uniquepair_service_pool_size,
+                uniquepair_service_max_connections, 10000,
+                uniquepair_wire_format, uniquepair_breaker_options));
+        export_stats("uniquepair", this->uniquepair_service.back());
         std::cout << "\tAdded uniquepair service on " << \
             hostname << ":" << port << std::endl;
       }
-      // Build uniquepair database connection string.
+      // Build uniquepair database connection pool.
       auto uniquepair_db = backend["uniquepair"]["database"].as<std::string>();
       auto uniquepair_db_host = uniquepair_db.substr(0, uniquepair_db.find(":"));
       auto uniquepair_db_port = std::stoi(
@@ -116,60 +266,265 @@ protected:
       sprintf(conn_cstr, conn_fmt, postgres_user.c_str(),
           postgres_password.c_str(), uniquepair_db_host.c_str(),
           uniquepair_db_port, postgres_dbname.c_str());
-      uniquepair_db_conn_str = std::string(conn_cstr);
+      auto uniquepair_db_pool_size =
+          backend["uniquepair"]["database_pool_size"] ?
+          backend["uniquepair"]["database_pool_size"].as<int>() :
+          default_db_pool_size;
+      uniquepair_db_pool = std::make_unique<PGConnectionPool>(
+          std::string(conn_cstr), uniquepair_db_pool_size,
+          metrics().histogram("buzzblog_pool_wait_seconds",
+              "pool=\"uniquepair_db\""));
+      export_stats("uniquepair_db", uniquepair_db_pool.get());
       std::cout << "\tAdded uniquepair database on: " << \
-          uniquepair_db_host << ":" << uniquepair_db_port << std::endl;
+          uniquepair_db_host << ":" << uniquepair_db_port << \
+          " (pool size: " << uniquepair_db_pool_size << ")" << std::endl;
     }
   }
 
-  std::unique_ptr<account_service::Client> get_account_client() {
-    // Randomly select a server.
-    std::pair<std::string, int> server =
-        account_service[rand() % int(account_service.size())];
-    return std::move(std::make_unique<account_service::Client>(
-        server.first, server.second, 10000));
-  }
-
-  std::unique_ptr<follow_service::Client> get_follow_client() {
-    // Randomly select a server.
-    std::pair<std::string, int> server =
-        follow_service[rand() % int(follow_service.size())];
-    return std::move(std::make_unique<follow_service::Client>(
-        server.first, server.second, 10000));
-  }
-
-  std::unique_ptr<like_service::Client> get_like_client() {
-    // Randomly select a server.
-    std::pair<std::string, int> server =
-        like_service[rand() % int(like_service.size())];
-    return std::move(std::make_unique<like_service::Client>(
-        server.first, server.second, 10000));
-  }
-
-  std::unique_ptr<post_service::Client> get_post_client() {
-    // Randomly select a server.
-    std::pair<std::string, int> server =
-        post_service[rand() % int(post_service.size())];
-    return std::move(std::make_unique<post_service::Client>(
-        server.first, server.second, 10000));
-  }
-
-  std::unique_ptr<uniquepair_service::Client> get_uniquepair_client() {
-    // Randomly select a server.
-    std::pair<std::string, int> server =
-        uniquepair_service[rand() % int(uniquepair_service.size())];
-    return std::move(std::make_unique<uniquepair_service::Client>(
-        server.first, server.second, 10000));
-  }
-
-  // Pairs of server hosts and ports.
-  std::vector<std::pair<std::string, int>> account_service;
-  std::vector<std::pair<std::string, int>> follow_service;
-  std::vector<std::pair<std::string, int>> like_service;
-  std::vector<std::pair<std::string, int>> post_service;
-  std::vector<std::pair<std::string, int>> uniquepair_service;
-  // Database connection strings.
-  std::string account_db_conn_str;
-  std::string post_db_conn_str;
-  std::string uniquepair_db_conn_str;
+  // Build the hedger of calls to a service from its configuration.
+  static std::unique_ptr<Hedger> make_hedger(const YAML::Node& service) {
+    auto budget = service["hedging_budget"] ?
+        service["hedging_budget"].as<double>() : 0.05;
+    auto threads = service["hedging_threads"] ?
+        service["hedging_threads"].as<int>() : 16;
+    return std::make_unique<Hedger>(service["hedging_percentile"].as<double>(),
+        budget, threads);
+  }
+
+  // Build the options of the circuit breakers of a service's servers from its
+  // configuration.
+  static CircuitBreaker::Options make_breaker_options(
+      const YAML::Node& service) {
+    CircuitBreaker::Options options;
+    if (service["ejection_failures"])
+      options.max_failures = service["ejection_failures"].as<int>();
+    if (service["ejection_slow_call_ms"])
+      options.slow_call_ms = service["ejection_slow_call_ms"].as<int>();
+    if (service["ejection_base_ms"])
+      options.base_ejection_ms = service["ejection_base_ms"].as<int>();
+    if (service["ejection_max_ms"])
+      options.max_ejection_ms = service["ejection_max_ms"].as<int>();
+    return options;
+  }
+
+  // Build the wire format of calls to a service from its configuration.
+  static WireFormat make_wire_format(const YAML::Node& service) {
+    return parse_wire_format(
+        service["server_mode"] ?
+            service["server_mode"].as<std::string>() : "nonblocking",
+        service["protocol"] ? service["protocol"].as<std::string>() : "binary",
+        service["transport"] ? service["transport"].as<std::string>() : "",
+        service["zlib"] && service["zlib"].as<bool>());
+  }
+
+  // Format ids as a PostgreSQL array literal (e.g. "{1,2,3}"), to be bound to
+  // an `integer[]` statement parameter.
+  template <typename Container>
+  static std::string to_pg_array(const Container& ids) {
+    std::ostringstream array;
+    array << "{";
+    for (auto it = ids.begin(); it != ids.end(); it++)
+      array << (it == ids.begin() ? "" : ",") << *it;
+    array << "}";
+    return array.str();
+  }
+
+  // Execute a prepared statement, recording its latency. `statement` must be a
+  // string literal, as the histogram of its latency is cached by address.
+  template <typename... Args>
+  static pqxx::result exec_prepared(pqxx::transaction_base& txn,
+      const char* statement, Args&&... args) {
+    auto start_time = std::chrono::steady_clock::now();
+    auto result = txn.exec_prepared(statement, std::forward<Args>(args)...);
+    statement_histogram(statement)->record(
+        std::chrono::steady_clock::now() - start_time);
+    return result;
+  }
+
+  // Each thread keeps its own cache of histograms, by statement.
+  static Histogram* statement_histogram(const char* statement) {
+    static thread_local std::unordered_map<const char*, Histogram*> histograms;
+    auto& histogram = histograms[statement];
+    if (!histogram)
+      histogram = metrics().histogram("buzzblog_db_query_seconds",
+          "statement=\"" + std::string(statement) + "\"");
+    return histogram;
+  }
+
+  // Export the usage of a connection pool to a service server as metrics.
+  template <typename TClient>
+  static void export_stats(const std::string& service,
+      const std::shared_ptr<ClientPool<TClient>>& pool) {
+    auto labels = "service=\"" + service + "\",server=\"" +
+        pool->ip_address() + ":" + std::to_string(pool->port()) + "\"";
+    auto& m = metrics();
+    m.add_callback("gauge", "buzzblog_client_pool_idle", labels,
+        [pool] { return pool->stats().n_idle; });
+    m.add_callback("gauge", "buzzblog_client_pool_in_use", labels,
+        [pool] { return pool->stats().n_in_use; });
+    m.add_callback("counter", "buzzblog_client_pool_acquisitions_total",
+        labels, [pool] { return pool->stats().n_acquisitions; });
+    m.add_callback("counter", "buzzblog_client_pool_connections_total",
+        labels, [pool] { return pool->stats().n_connections; });
+    m.add_callback("counter", "buzzblog_client_pool_evictions_total", labels,
+        [pool] { return pool->stats().n_evictions; });
+    m.add_callback("counter", "buzzblog_client_pool_errors_total", labels,
+        [pool] { return pool->stats().n_errors; });
+    m.add_callback("counter", "buzzblog_client_pool_timeouts_total", labels,
+        [pool] { return pool->stats().n_timeouts; });
+    m.add_callback("gauge", "buzzblog_client_in_flight", labels,
+        [pool] { return pool->load().n_in_flight(); });
+    m.add_callback("gauge", "buzzblog_client_latency_ewma_seconds", labels,
+        [pool] { return pool->load().ewma_latency(); });
+    m.add_callback("gauge", "buzzblog_client_breaker_state", labels,
+        [pool] { return pool->breaker().state(); });
+    m.add_callback("counter", "buzzblog_client_ejections_total", labels,
+        [pool] { return pool->breaker().n_ejections(); });
+  }
+
+  // Export the usage of a database connection pool as metrics.
+  static void export_stats(const std::string& name, PGConnectionPool* pool) {
+    auto labels = "pool=\"" + name + "\"";
+    auto& m = metrics();
+    m.add_callback("gauge", "buzzblog_db_pool_open", labels,
+        [pool] { return pool->stats().n_open; });
+    m.add_callback("gauge", "buzzblog_db_pool_in_use", labels,
+        [pool] { return pool->stats().n_in_use; });
+    m.add_callback("counter", "buzzblog_db_pool_acquisitions_total", labels,
+        [pool] { return pool->stats().n_acquisitions; });
+    m.add_callback("counter", "buzzblog_db_pool_timeouts_total", labels,
+        [pool] { return pool->stats().n_timeouts; });
+    m.add_callback("counter", "buzzblog_db_pool_reconnections_total", labels,
+        [pool] { return pool->stats().n_reconnections; });
+  }
+
+  // Make the idempotent call `rpc` (e.g., "account:retrieve_standard_account")
+  // to a server of `servers`, hedged by `hedger` if it is set. `rpc` takes a
+  // client and must capture its arguments by value.
+  template <typename TClient, typename F>
+  static auto hedged_call(
+      const std::vector<std::shared_ptr<ClientPool<TClient>>>& servers,
+      const LoadBalancer& balancer, Hedger* hedger, const std::string& function,
+      F rpc) -> decltype(rpc(std::declval<TClient&>())) {
+    using T = decltype(rpc(std::declval<TClient&>()));
+    int primary = balancer.select(servers);
+    if (!hedger || servers.size() < 2)
+      return rpc(*servers[primary]->acquire());
+    auto primary_server = servers[primary];
+    return hedger->call<T>(function,
+        [primary_server, rpc] { return rpc(*primary_server->acquire()); },
+        [&servers, &balancer, primary, rpc] {
+          return rpc(*servers[balancer.select(servers, primary)]->acquire());
+        });
+  }
+
+  template <typename F>
+  auto hedged_account_call(const std::string& function, F rpc) {
+    return hedged_call(account_service, account_balancer, account_hedger.get(),
+        function, rpc);
+  }
+
+  template <typename F>
+  auto hedged_follow_call(const std::string& function, F rpc) {
+    return hedged_call(follow_service, follow_balancer, follow_hedger.get(),
+        function, rpc);
+  }
+
+  template <typename F>
+  auto hedged_like_call(const std::string& function, F rpc) {
+    return hedged_call(like_service, like_balancer, like_hedger.get(),
+        function, rpc);
+  }
+
+  template <typename F>
+  auto hedged_post_call(const std::string& function, F rpc) {
+    return hedged_call(post_service, post_balancer, post_hedger.get(),
+        function, rpc);
+  }
+
+  template <typename F>
+  auto hedged_uniquepair_call(const std::string& function, F rpc) {
+    return hedged_call(uniquepair_service, uniquepair_balancer,
+        uniquepair_hedger.get(), function, rpc);
+  }
+
+  // Make a hedged call on the executor of asynchronous RPCs (see
+  // 'client_executor.h'), returning a future of its result, so that callers can
+  // overlap it with their other calls.
+  template <typename F>
+  auto async_account_call(const std::string& function, F rpc) {
+    return run_async([=] { return hedged_account_call(function, rpc); });
+  }
+
+  template <typename F>
+  auto async_follow_call(const std::string& function, F rpc) {
+    return run_async([=] { return hedged_follow_call(function, rpc); });
+  }
+
+  template <typename F>
+  auto async_like_call(const std::string& function, F rpc) {
+    return run_async([=] { return hedged_like_call(function, rpc); });
+  }
+
+  template <typename F>
+  auto async_post_call(const std::string& function, F rpc) {
+    return run_async([=] { return hedged_post_call(function, rpc); });
+  }
+
+  template <typename F>
+  auto async_uniquepair_call(const std::string& function, F rpc) {
+    return run_async([=] { return hedged_uniquepair_call(function, rpc); });
+  }
+
+  ClientPool<account_service::Client>::Client get_account_client() {
+    auto& server = account_service[account_balancer.select(account_service)];
+    return server->acquire();
+  }
+
+  ClientPool<follow_service::Client>::Client get_follow_client() {
+    auto& server = follow_service[follow_balancer.select(follow_service)];
+    return server->acquire();
+  }
+
+  ClientPool<like_service::Client>::Client get_like_client() {
+    auto& server = like_service[like_balancer.select(like_service)];
+    return server->acquire();
+  }
+
+  ClientPool<post_service::Client>::Client get_post_client() {
+    auto& server = post_service[post_balancer.select(post_service)];
+    return server->acquire();
+  }
+
+  ClientPool<uniquepair_service::Client>::Client get_uniquepair_client() {
+    auto& server = uniquepair_service[
+        uniquepair_balancer.select(uniquepair_service)];
+    return server->acquire();
+  }
+
+  // Connection pools of servers.
+  std::vector<std::shared_ptr<ClientPool<account_service::Client>>>
+      account_service;
+  std::vector<std::shared_ptr<ClientPool<follow_service::Client>>>
+      follow_service;
+  std::vector<std::shared_ptr<ClientPool<like_service::Client>>> like_service;
+  std::vector<std::shared_ptr<ClientPool<post_service::Client>>> post_service;
+  std::vector<std::shared_ptr<ClientPool<uniquepair_service::Client>>>
+      uniquepair_service;
+  // Load-balancing policies of services.
+  LoadBalancer account_balancer;
+  LoadBalancer follow_balancer;
+  LoadBalancer like_balancer;
+  LoadBalancer post_balancer;
+  LoadBalancer uniquepair_balancer;
+  // Hedgers of idempotent calls to services, if enabled.
+  std::unique_ptr<Hedger> account_hedger;
+  std::unique_ptr<Hedger> follow_hedger;
+  std::unique_ptr<Hedger> like_hedger;
+  std::unique_ptr<Hedger> post_hedger;
+  std::unique_ptr<Hedger> uniquepair_hedger;
+  // Database connection pools.
+  std::unique_ptr<PGConnectionPool> account_db_pool;
+  std::unique_ptr<PGConnectionPool> post_db_pool;
+  std::unique_ptr<PGConnectionPool> uniquepair_db_pool;
 };
@@ -0,0 +1,33 @@
+// Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
+// Systems
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+
+#include <buzzblog/gen/buzzblog_types.h>
+
+
+// Requests may carry an absolute deadline (`TRequestMetadata.deadline_ms`, in
+// milliseconds since the Unix epoch), after which their callers no longer wait
+// for them. Clocks of all servers are assumed to be synchronized (e.g., with
+// NTP) to well below the deadlines used.
+inline int64_t unix_time_ms() {
+  return std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+// Time left before the deadline of a request, which must have one. Negative
+// once it passed.
+inline std::chrono::milliseconds time_left(
+    const gen::TRequestMetadata& request_metadata) {
+  return std::chrono::milliseconds(request_metadata.deadline_ms -
+      unix_time_ms());
+}
+
+// Whether the request has a deadline that already passed.
+inline bool deadline_exceeded(const gen::TRequestMetadata& request_metadata) {
+  return request_metadata.__isset.deadline_ms &&
+      time_left(request_metadata).count() <= 0;
+}
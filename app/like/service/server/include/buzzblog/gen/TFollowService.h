@@ -145,9 +145,10 @@ class TFollowService_follow_account_pargs {
 };
 
 typedef struct _TFollowService_follow_account_result__isset {
-  _TFollowService_follow_account_result__isset() : success(false), e(false) {}
+  _TFollowService_follow_account_result__isset() : success(false), e(false), overloaded(false) {}
   bool success :1;
   bool e :1;
+  bool overloaded :1;
 } _TFollowService_follow_account_result__isset;
 
 class TFollowService_follow_account_result {
@@ -161,6 +162,7 @@ class TFollowService_follow_account_result {
   virtual ~TFollowService_follow_account_result() noexcept;
   TFollow success;
   TFollowAlreadyExistsException e;
+  TServerOverloadedException overloaded;
 
   _TFollowService_follow_account_result__isset __isset;
 
@@ -168,12 +170,16 @@ class TFollowService_follow_account_result {
 
   void __set_e(const TFollowAlreadyExistsException& val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TFollowService_follow_account_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
     if (!(e == rhs.e))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TFollowService_follow_account_result &rhs) const {
@@ -188,9 +194,10 @@ class TFollowService_follow_account_result {
 };
 
 typedef struct _TFollowService_follow_account_presult__isset {
-  _TFollowService_follow_account_presult__isset() : success(false), e(false) {}
+  _TFollowService_follow_account_presult__isset() : success(false), e(false), overloaded(false) {}
   bool success :1;
   bool e :1;
+  bool overloaded :1;
 } _TFollowService_follow_account_presult__isset;
 
 class TFollowService_follow_account_presult {
@@ -200,6 +207,7 @@ class TFollowService_follow_account_presult {
   virtual ~TFollowService_follow_account_presult() noexcept;
   TFollow* success;
   TFollowAlreadyExistsException e;
+  TServerOverloadedException overloaded;
 
   _TFollowService_follow_account_presult__isset __isset;
 
@@ -264,9 +272,10 @@ class TFollowService_retrieve_standard_follow_pargs {
 };
 
 typedef struct _TFollowService_retrieve_standard_follow_result__isset {
-  _TFollowService_retrieve_standard_follow_result__isset() : success(false), e(false) {}
+  _TFollowService_retrieve_standard_follow_result__isset() : success(false), e(false), overloaded(false) {}
   bool success :1;
   bool e :1;
+  bool overloaded :1;
 } _TFollowService_retrieve_standard_follow_result__isset;
 
 class TFollowService_retrieve_standard_follow_result {
@@ -280,6 +289,7 @@ class TFollowService_retrieve_standard_follow_result {
   virtual ~TFollowService_retrieve_standard_follow_result() noexcept;
   TFollow success;
   TFollowNotFoundException e;
+  TServerOverloadedException overloaded;
 
   _TFollowService_retrieve_standard_follow_result__isset __isset;
 
@@ -287,12 +297,16 @@ class TFollowService_retrieve_standard_follow_result {
 
   void __set_e(const TFollowNotFoundException& val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TFollowService_retrieve_standard_follow_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
     if (!(e == rhs.e))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TFollowService_retrieve_standard_follow_result &rhs) const {
@@ -307,9 +321,10 @@ class TFollowService_retrieve_standard_follow_result {
 };
 
 typedef struct _TFollowService_retrieve_standard_follow_presult__isset {
-  _TFollowService_retrieve_standard_follow_presult__isset() : success(false), e(false) {}
+  _TFollowService_retrieve_standard_follow_presult__isset() : success(false), e(false), overloaded(false) {}
   bool success :1;
   bool e :1;
+  bool overloaded :1;
 } _TFollowService_retrieve_standard_follow_presult__isset;
 
 class TFollowService_retrieve_standard_follow_presult {
@@ -319,6 +334,7 @@ class TFollowService_retrieve_standard_follow_presult {
   virtual ~TFollowService_retrieve_standard_follow_presult() noexcept;
   TFollow* success;
   TFollowNotFoundException e;
+  TServerOverloadedException overloaded;
 
   _TFollowService_retrieve_standard_follow_presult__isset __isset;
 
@@ -383,10 +399,11 @@ class TFollowService_retrieve_expanded_follow_pargs {
 };
 
 typedef struct _TFollowService_retrieve_expanded_follow_result__isset {
-  _TFollowService_retrieve_expanded_follow_result__isset() : success(false), e1(false), e2(false) {}
+  _TFollowService_retrieve_expanded_follow_result__isset() : success(false), e1(false), e2(false), overloaded(false) {}
   bool success :1;
   bool e1 :1;
   bool e2 :1;
+  bool overloaded :1;
 } _TFollowService_retrieve_expanded_follow_result__isset;
 
 class TFollowService_retrieve_expanded_follow_result {
@@ -401,6 +418,7 @@ class TFollowService_retrieve_expanded_follow_result {
   TFollow success;
   TFollowNotFoundException e1;
   TAccountNotFoundException e2;
+  TServerOverloadedException overloaded;
 
   _TFollowService_retrieve_expanded_follow_result__isset __isset;
 
@@ -410,6 +428,8 @@ class TFollowService_retrieve_expanded_follow_result {
 
   void __set_e2(const TAccountNotFoundException& val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TFollowService_retrieve_expanded_follow_result & rhs) const
   {
     if (!(success == rhs.success))
@@ -418,6 +438,8 @@ class TFollowService_retrieve_expanded_follow_result {
       return false;
     if (!(e2 == rhs.e2))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TFollowService_retrieve_expanded_follow_result &rhs) const {
@@ -432,10 +454,11 @@ class TFollowService_retrieve_expanded_follow_result {
 };
 
 typedef struct _TFollowService_retrieve_expanded_follow_presult__isset {
-  _TFollowService_retrieve_expanded_follow_presult__isset() : success(false), e1(false), e2(false) {}
+  _TFollowService_retrieve_expanded_follow_presult__isset() : success(false), e1(false), e2(false), overloaded(false) {}
   bool success :1;
   bool e1 :1;
   bool e2 :1;
+  bool overloaded :1;
 } _TFollowService_retrieve_expanded_follow_presult__isset;
 
 class TFollowService_retrieve_expanded_follow_presult {
@@ -446,6 +469,7 @@ class TFollowService_retrieve_expanded_follow_presult {
   TFollow* success;
   TFollowNotFoundException e1;
   TAccountNotFoundException e2;
+  TServerOverloadedException overloaded;
 
   _TFollowService_retrieve_expanded_follow_presult__isset __isset;
 
@@ -510,9 +534,10 @@ class TFollowService_delete_follow_pargs {
 };
 
 typedef struct _TFollowService_delete_follow_result__isset {
-  _TFollowService_delete_follow_result__isset() : e1(false), e2(false) {}
+  _TFollowService_delete_follow_result__isset() : e1(false), e2(false), overloaded(false) {}
   bool e1 :1;
   bool e2 :1;
+  bool overloaded :1;
 } _TFollowService_delete_follow_result__isset;
 
 class TFollowService_delete_follow_result {
@@ -526,6 +551,7 @@ class TFollowService_delete_follow_result {
   virtual ~TFollowService_delete_follow_result() noexcept;
   TFollowNotFoundException e1;
   TFollowNotAuthorizedException e2;
+  TServerOverloadedException overloaded;
 
   _TFollowService_delete_follow_result__isset __isset;
 
@@ -533,12 +559,16 @@ class TFollowService_delete_follow_result {
 
   void __set_e2(const TFollowNotAuthorizedException& val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TFollowService_delete_follow_result & rhs) const
   {
     if (!(e1 == rhs.e1))
       return false;
     if (!(e2 == rhs.e2))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TFollowService_delete_follow_result &rhs) const {
@@ -553,9 +583,10 @@ class TFollowService_delete_follow_result {
 };
 
 typedef struct _TFollowService_delete_follow_presult__isset {
-  _TFollowService_delete_follow_presult__isset() : e1(false), e2(false) {}
+  _TFollowService_delete_follow_presult__isset() : e1(false), e2(false), overloaded(false) {}
   bool e1 :1;
   bool e2 :1;
+  bool overloaded :1;
 } _TFollowService_delete_follow_presult__isset;
 
 class TFollowService_delete_follow_presult {
@@ -565,6 +596,7 @@ class TFollowService_delete_follow_presult {
   virtual ~TFollowService_delete_follow_presult() noexcept;
   TFollowNotFoundException e1;
   TFollowNotAuthorizedException e2;
+  TServerOverloadedException overloaded;
 
   _TFollowService_delete_follow_presult__isset __isset;
 
@@ -643,9 +675,10 @@ class TFollowService_list_follows_pargs {
 };
 
 typedef struct _TFollowService_list_follows_result__isset {
-  _TFollowService_list_follows_result__isset() : success(false), e(false) {}
+  _TFollowService_list_follows_result__isset() : success(false), e(false), overloaded(false) {}
   bool success :1;
   bool e :1;
+  bool overloaded :1;
 } _TFollowService_list_follows_result__isset;
 
 class TFollowService_list_follows_result {
@@ -659,6 +692,7 @@ class TFollowService_list_follows_result {
   virtual ~TFollowService_list_follows_result() noexcept;
   std::vector<TFollow>  success;
   TAccountNotFoundException e;
+  TServerOverloadedException overloaded;
 
   _TFollowService_list_follows_result__isset __isset;
 
@@ -666,12 +700,16 @@ class TFollowService_list_follows_result {
 
   void __set_e(const TAccountNotFoundException& val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TFollowService_list_follows_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
     if (!(e == rhs.e))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TFollowService_list_follows_result &rhs) const {
@@ -686,9 +724,10 @@ class TFollowService_list_follows_result {
 };
 
 typedef struct _TFollowService_list_follows_presult__isset {
-  _TFollowService_list_follows_presult__isset() : success(false), e(false) {}
+  _TFollowService_list_follows_presult__isset() : success(false), e(false), overloaded(false) {}
   bool success :1;
   bool e :1;
+  bool overloaded :1;
 } _TFollowService_list_follows_presult__isset;
 
 class TFollowService_list_follows_presult {
@@ -698,6 +737,7 @@ class TFollowService_list_follows_presult {
   virtual ~TFollowService_list_follows_presult() noexcept;
   std::vector<TFollow> * success;
   TAccountNotFoundException e;
+  TServerOverloadedException overloaded;
 
   _TFollowService_list_follows_presult__isset __isset;
 
@@ -769,8 +809,9 @@ class TFollowService_check_follow_pargs {
 };
 
 typedef struct _TFollowService_check_follow_result__isset {
-  _TFollowService_check_follow_result__isset() : success(false) {}
+  _TFollowService_check_follow_result__isset() : success(false), overloaded(false) {}
   bool success :1;
+  bool overloaded :1;
 } _TFollowService_check_follow_result__isset;
 
 class TFollowService_check_follow_result {
@@ -783,15 +824,20 @@ class TFollowService_check_follow_result {
 
   virtual ~TFollowService_check_follow_result() noexcept;
   bool success;
+  TServerOverloadedException overloaded;
 
   _TFollowService_check_follow_result__isset __isset;
 
   void __set_success(const bool val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TFollowService_check_follow_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TFollowService_check_follow_result &rhs) const {
@@ -806,8 +852,9 @@ class TFollowService_check_follow_result {
 };
 
 typedef struct _TFollowService_check_follow_presult__isset {
-  _TFollowService_check_follow_presult__isset() : success(false) {}
+  _TFollowService_check_follow_presult__isset() : success(false), overloaded(false) {}
   bool success :1;
+  bool overloaded :1;
 } _TFollowService_check_follow_presult__isset;
 
 class TFollowService_check_follow_presult {
@@ -816,6 +863,7 @@ class TFollowService_check_follow_presult {
 
   virtual ~TFollowService_check_follow_presult() noexcept;
   bool* success;
+  TServerOverloadedException overloaded;
 
   _TFollowService_check_follow_presult__isset __isset;
 
@@ -880,8 +928,9 @@ class TFollowService_count_followers_pargs {
 };
 
 typedef struct _TFollowService_count_followers_result__isset {
-  _TFollowService_count_followers_result__isset() : success(false) {}
+  _TFollowService_count_followers_result__isset() : success(false), overloaded(false) {}
   bool success :1;
+  bool overloaded :1;
 } _TFollowService_count_followers_result__isset;
 
 class TFollowService_count_followers_result {
@@ -894,15 +943,20 @@ class TFollowService_count_followers_result {
 
   virtual ~TFollowService_count_followers_result() noexcept;
   int32_t success;
+  TServerOverloadedException overloaded;
 
   _TFollowService_count_followers_result__isset __isset;
 
   void __set_success(const int32_t val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TFollowService_count_followers_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TFollowService_count_followers_result &rhs) const {
@@ -917,8 +971,9 @@ class TFollowService_count_followers_result {
 };
 
 typedef struct _TFollowService_count_followers_presult__isset {
-  _TFollowService_count_followers_presult__isset() : success(false) {}
+  _TFollowService_count_followers_presult__isset() : success(false), overloaded(false) {}
   bool success :1;
+  bool overloaded :1;
 } _TFollowService_count_followers_presult__isset;
 
 class TFollowService_count_followers_presult {
@@ -927,6 +982,7 @@ class TFollowService_count_followers_presult {
 
   virtual ~TFollowService_count_followers_presult() noexcept;
   int32_t* success;
+  TServerOverloadedException overloaded;
 
   _TFollowService_count_followers_presult__isset __isset;
 
@@ -991,8 +1047,9 @@ class TFollowService_count_followees_pargs {
 };
 
 typedef struct _TFollowService_count_followees_result__isset {
-  _TFollowService_count_followees_result__isset() : success(false) {}
+  _TFollowService_count_followees_result__isset() : success(false), overloaded(false) {}
   bool success :1;
+  bool overloaded :1;
 } _TFollowService_count_followees_result__isset;
 
 class TFollowService_count_followees_result {
@@ -1005,15 +1062,20 @@ class TFollowService_count_followees_result {
 
   virtual ~TFollowService_count_followees_result() noexcept;
   int32_t success;
+  TServerOverloadedException overloaded;
 
   _TFollowService_count_followees_result__isset __isset;
 
   void __set_success(const int32_t val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TFollowService_count_followees_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TFollowService_count_followees_result &rhs) const {
@@ -1028,8 +1090,9 @@ class TFollowService_count_followees_result {
 };
 
 typedef struct _TFollowService_count_followees_presult__isset {
-  _TFollowService_count_followees_presult__isset() : success(false) {}
+  _TFollowService_count_followees_presult__isset() : success(false), overloaded(false) {}
   bool success :1;
+  bool overloaded :1;
 } _TFollowService_count_followees_presult__isset;
 
 class TFollowService_count_followees_presult {
@@ -1038,6 +1101,7 @@ class TFollowService_count_followees_presult {
 
   virtual ~TFollowService_count_followees_presult() noexcept;
   int32_t* success;
+  TServerOverloadedException overloaded;
 
   _TFollowService_count_followees_presult__isset __isset;
 
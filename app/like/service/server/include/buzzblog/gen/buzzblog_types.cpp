@@ -26,6 +26,26 @@ void TRequestMetadata::__set_requester_id(const int32_t val) {
   this->requester_id = val;
 __isset.requester_id = true;
 }
+
+void TRequestMetadata::__set_span_id(const int64_t val) {
+  this->span_id = val;
+__isset.span_id = true;
+}
+
+void TRequestMetadata::__set_parent_span_id(const int64_t val) {
+  this->parent_span_id = val;
+__isset.parent_span_id = true;
+}
+
+void TRequestMetadata::__set_sampled(const bool val) {
+  this->sampled = val;
+__isset.sampled = true;
+}
+
+void TRequestMetadata::__set_deadline_ms(const int64_t val) {
+  this->deadline_ms = val;
+__isset.deadline_ms = true;
+}
 std::ostream& operator<<(std::ostream& out, const TRequestMetadata& obj)
 {
   obj.printTo(out);
@@ -71,6 +91,38 @@ uint32_t TRequestMetadata::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->span_id);
+          this->__isset.span_id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->parent_span_id);
+          this->__isset.parent_span_id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_BOOL) {
+          xfer += iprot->readBool(this->sampled);
+          this->__isset.sampled = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 6:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->deadline_ms);
+          this->__isset.deadline_ms = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -99,6 +151,26 @@ uint32_t TRequestMetadata::write(::apache::thrift::protocol::TProtocol* oprot) c
     xfer += oprot->writeI32(this->requester_id);
     xfer += oprot->writeFieldEnd();
   }
+  if (this->__isset.span_id) {
+    xfer += oprot->writeFieldBegin("span_id", ::apache::thrift::protocol::T_I64, 3);
+    xfer += oprot->writeI64(this->span_id);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.parent_span_id) {
+    xfer += oprot->writeFieldBegin("parent_span_id", ::apache::thrift::protocol::T_I64, 4);
+    xfer += oprot->writeI64(this->parent_span_id);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.sampled) {
+    xfer += oprot->writeFieldBegin("sampled", ::apache::thrift::protocol::T_BOOL, 5);
+    xfer += oprot->writeBool(this->sampled);
+    xfer += oprot->writeFieldEnd();
+  }
+  if (this->__isset.deadline_ms) {
+    xfer += oprot->writeFieldBegin("deadline_ms", ::apache::thrift::protocol::T_I64, 6);
+    xfer += oprot->writeI64(this->deadline_ms);
+    xfer += oprot->writeFieldEnd();
+  }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -108,17 +180,29 @@ void swap(TRequestMetadata &a, TRequestMetadata &b) {
   using ::std::swap;
   swap(a.id, b.id);
   swap(a.requester_id, b.requester_id);
+  swap(a.span_id, b.span_id);
+  swap(a.parent_span_id, b.parent_span_id);
+  swap(a.sampled, b.sampled);
+  swap(a.deadline_ms, b.deadline_ms);
   swap(a.__isset, b.__isset);
 }
 
 TRequestMetadata::TRequestMetadata(const TRequestMetadata& other0) {
   id = other0.id;
   requester_id = other0.requester_id;
+  span_id = other0.span_id;
+  parent_span_id = other0.parent_span_id;
+  sampled = other0.sampled;
+  deadline_ms = other0.deadline_ms;
   __isset = other0.__isset;
 }
 TRequestMetadata& TRequestMetadata::operator=(const TRequestMetadata& other1) {
   id = other1.id;
   requester_id = other1.requester_id;
+  span_id = other1.span_id;
+  parent_span_id = other1.parent_span_id;
+  sampled = other1.sampled;
+  deadline_ms = other1.deadline_ms;
   __isset = other1.__isset;
   return *this;
 }
@@ -127,6 +211,125 @@ void TRequestMetadata::printTo(std::ostream& out) const {
   out << "TRequestMetadata(";
   out << "id=" << to_string(id);
   out << ", " << "requester_id="; (__isset.requester_id ? (out << to_string(requester_id)) : (out << "<null>"));
+  out << ", " << "span_id="; (__isset.span_id ? (out << to_string(span_id)) : (out << "<null>"));
+  out << ", " << "parent_span_id="; (__isset.parent_span_id ? (out << to_string(parent_span_id)) : (out << "<null>"));
+  out << ", " << "sampled="; (__isset.sampled ? (out << to_string(sampled)) : (out << "<null>"));
+  out << ", " << "deadline_ms="; (__isset.deadline_ms ? (out << to_string(deadline_ms)) : (out << "<null>"));
+  out << ")";
+}
+
+
+TCursor::~TCursor() noexcept {
+}
+
+
+void TCursor::__set_created_at(const int32_t val) {
+  this->created_at = val;
+}
+
+void TCursor::__set_id(const int32_t val) {
+  this->id = val;
+}
+std::ostream& operator<<(std::ostream& out, const TCursor& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+uint32_t TCursor::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+  bool isset_created_at = false;
+  bool isset_id = false;
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->created_at);
+          isset_created_at = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_I32) {
+          xfer += iprot->readI32(this->id);
+          isset_id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  if (!isset_created_at)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  if (!isset_id)
+    throw TProtocolException(TProtocolException::INVALID_DATA);
+  return xfer;
+}
+
+uint32_t TCursor::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("TCursor");
+
+  xfer += oprot->writeFieldBegin("created_at", ::apache::thrift::protocol::T_I32, 1);
+  xfer += oprot->writeI32(this->created_at);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("id", ::apache::thrift::protocol::T_I32, 2);
+  xfer += oprot->writeI32(this->id);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(TCursor &a, TCursor &b) {
+  using ::std::swap;
+  swap(a.created_at, b.created_at);
+  swap(a.id, b.id);
+}
+
+TCursor::TCursor(const TCursor& other2) {
+  created_at = other2.created_at;
+  id = other2.id;
+}
+TCursor& TCursor::operator=(const TCursor& other3) {
+  created_at = other3.created_at;
+  id = other3.id;
+  return *this;
+}
+void TCursor::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "TCursor(";
+  out << "created_at=" << to_string(created_at);
+  out << ", " << "id=" << to_string(id);
   out << ")";
 }
 
@@ -423,35 +626,35 @@ void swap(TAccount &a, TAccount &b) {
   swap(a.__isset, b.__isset);
 }
 
-TAccount::TAccount(const TAccount& other2) {
-  id = other2.id;
-  created_at = other2.created_at;
-  active = other2.active;
-  username = other2.username;
-  first_name = other2.first_name;
-  last_name = other2.last_name;
-  follows_you = other2.follows_you;
-  followed_by_you = other2.followed_by_you;
-  n_followers = other2.n_followers;
-  n_following = other2.n_following;
-  n_posts = other2.n_posts;
-  n_likes = other2.n_likes;
-  __isset = other2.__isset;
-}
-TAccount& TAccount::operator=(const TAccount& other3) {
-  id = other3.id;
-  created_at = other3.created_at;
-  active = other3.active;
-  username = other3.username;
-  first_name = other3.first_name;
-  last_name = other3.last_name;
-  follows_you = other3.follows_you;
-  followed_by_you = other3.followed_by_you;
-  n_followers = other3.n_followers;
-  n_following = other3.n_following;
-  n_posts = other3.n_posts;
-  n_likes = other3.n_likes;
-  __isset = other3.__isset;
+TAccount::TAccount(const TAccount& other4) {
+  id = other4.id;
+  created_at = other4.created_at;
+  active = other4.active;
+  username = other4.username;
+  first_name = other4.first_name;
+  last_name = other4.last_name;
+  follows_you = other4.follows_you;
+  followed_by_you = other4.followed_by_you;
+  n_followers = other4.n_followers;
+  n_following = other4.n_following;
+  n_posts = other4.n_posts;
+  n_likes = other4.n_likes;
+  __isset = other4.__isset;
+}
+TAccount& TAccount::operator=(const TAccount& other5) {
+  id = other5.id;
+  created_at = other5.created_at;
+  active = other5.active;
+  username = other5.username;
+  first_name = other5.first_name;
+  last_name = other5.last_name;
+  follows_you = other5.follows_you;
+  followed_by_you = other5.followed_by_you;
+  n_followers = other5.n_followers;
+  n_following = other5.n_following;
+  n_posts = other5.n_posts;
+  n_likes = other5.n_likes;
+  __isset = other5.__isset;
   return *this;
 }
 void TAccount::printTo(std::ostream& out) const {
@@ -649,23 +852,23 @@ void swap(TFollow &a, TFollow &b) {
   swap(a.__isset, b.__isset);
 }
 
-TFollow::TFollow(const TFollow& other4) {
-  id = other4.id;
-  created_at = other4.created_at;
-  follower_id = other4.follower_id;
-  followee_id = other4.followee_id;
-  follower = other4.follower;
-  followee = other4.followee;
-  __isset = other4.__isset;
+TFollow::TFollow(const TFollow& other6) {
+  id = other6.id;
+  created_at = other6.created_at;
+  follower_id = other6.follower_id;
+  followee_id = other6.followee_id;
+  follower = other6.follower;
+  followee = other6.followee;
+  __isset = other6.__isset;
 }
-TFollow& TFollow::operator=(const TFollow& other5) {
-  id = other5.id;
-  created_at = other5.created_at;
-  follower_id = other5.follower_id;
-  followee_id = other5.followee_id;
-  follower = other5.follower;
-  followee = other5.followee;
-  __isset = other5.__isset;
+TFollow& TFollow::operator=(const TFollow& other7) {
+  id = other7.id;
+  created_at = other7.created_at;
+  follower_id = other7.follower_id;
+  followee_id = other7.followee_id;
+  follower = other7.follower;
+  followee = other7.followee;
+  __isset = other7.__isset;
   return *this;
 }
 void TFollow::printTo(std::ostream& out) const {
@@ -694,6 +897,11 @@ void TFollowQuery::__set_followee_id(const int32_t val) {
   this->followee_id = val;
 __isset.followee_id = true;
 }
+
+void TFollowQuery::__set_cursor(const TCursor& val) {
+  this->cursor = val;
+__isset.cursor = true;
+}
 std::ostream& operator<<(std::ostream& out, const TFollowQuery& obj)
 {
   obj.printTo(out);
@@ -738,6 +946,14 @@ uint32_t TFollowQuery::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->cursor.read(iprot);
+          this->__isset.cursor = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -765,6 +981,11 @@ uint32_t TFollowQuery::write(::apache::thrift::protocol::TProtocol* oprot) const
     xfer += oprot->writeI32(this->followee_id);
     xfer += oprot->writeFieldEnd();
   }
+  if (this->__isset.cursor) {
+    xfer += oprot->writeFieldBegin("cursor", ::apache::thrift::protocol::T_STRUCT, 3);
+    xfer += this->cursor.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -774,18 +995,21 @@ void swap(TFollowQuery &a, TFollowQuery &b) {
   using ::std::swap;
   swap(a.follower_id, b.follower_id);
   swap(a.followee_id, b.followee_id);
+  swap(a.cursor, b.cursor);
   swap(a.__isset, b.__isset);
 }
 
-TFollowQuery::TFollowQuery(const TFollowQuery& other6) {
-  follower_id = other6.follower_id;
-  followee_id = other6.followee_id;
-  __isset = other6.__isset;
+TFollowQuery::TFollowQuery(const TFollowQuery& other8) {
+  follower_id = other8.follower_id;
+  followee_id = other8.followee_id;
+  cursor = other8.cursor;
+  __isset = other8.__isset;
 }
-TFollowQuery& TFollowQuery::operator=(const TFollowQuery& other7) {
-  follower_id = other7.follower_id;
-  followee_id = other7.followee_id;
-  __isset = other7.__isset;
+TFollowQuery& TFollowQuery::operator=(const TFollowQuery& other9) {
+  follower_id = other9.follower_id;
+  followee_id = other9.followee_id;
+  cursor = other9.cursor;
+  __isset = other9.__isset;
   return *this;
 }
 void TFollowQuery::printTo(std::ostream& out) const {
@@ -793,6 +1017,7 @@ void TFollowQuery::printTo(std::ostream& out) const {
   out << "TFollowQuery(";
   out << "follower_id="; (__isset.follower_id ? (out << to_string(follower_id)) : (out << "<null>"));
   out << ", " << "followee_id="; (__isset.followee_id ? (out << to_string(followee_id)) : (out << "<null>"));
+  out << ", " << "cursor="; (__isset.cursor ? (out << to_string(cursor)) : (out << "<null>"));
   out << ")";
 }
 
@@ -993,25 +1218,25 @@ void swap(TPost &a, TPost &b) {
   swap(a.__isset, b.__isset);
 }
 
-TPost::TPost(const TPost& other8) {
-  id = other8.id;
-  created_at = other8.created_at;
-  active = other8.active;
-  text = other8.text;
-  author_id = other8.author_id;
-  author = other8.author;
-  n_likes = other8.n_likes;
-  __isset = other8.__isset;
+TPost::TPost(const TPost& other10) {
+  id = other10.id;
+  created_at = other10.created_at;
+  active = other10.active;
+  text = other10.text;
+  author_id = other10.author_id;
+  author = other10.author;
+  n_likes = other10.n_likes;
+  __isset = other10.__isset;
 }
-TPost& TPost::operator=(const TPost& other9) {
-  id = other9.id;
-  created_at = other9.created_at;
-  active = other9.active;
-  text = other9.text;
-  author_id = other9.author_id;
-  author = other9.author;
-  n_likes = other9.n_likes;
-  __isset = other9.__isset;
+TPost& TPost::operator=(const TPost& other11) {
+  id = other11.id;
+  created_at = other11.created_at;
+  active = other11.active;
+  text = other11.text;
+  author_id = other11.author_id;
+  author = other11.author;
+  n_likes = other11.n_likes;
+  __isset = other11.__isset;
   return *this;
 }
 void TPost::printTo(std::ostream& out) const {
@@ -1036,6 +1261,11 @@ void TPostQuery::__set_author_id(const int32_t val) {
   this->author_id = val;
 __isset.author_id = true;
 }
+
+void TPostQuery::__set_cursor(const TCursor& val) {
+  this->cursor = val;
+__isset.cursor = true;
+}
 std::ostream& operator<<(std::ostream& out, const TPostQuery& obj)
 {
   obj.printTo(out);
@@ -1072,6 +1302,14 @@ uint32_t TPostQuery::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->cursor.read(iprot);
+          this->__isset.cursor = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1094,6 +1332,11 @@ uint32_t TPostQuery::write(::apache::thrift::protocol::TProtocol* oprot) const {
     xfer += oprot->writeI32(this->author_id);
     xfer += oprot->writeFieldEnd();
   }
+  if (this->__isset.cursor) {
+    xfer += oprot->writeFieldBegin("cursor", ::apache::thrift::protocol::T_STRUCT, 2);
+    xfer += this->cursor.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -1102,22 +1345,26 @@ uint32_t TPostQuery::write(::apache::thrift::protocol::TProtocol* oprot) const {
 void swap(TPostQuery &a, TPostQuery &b) {
   using ::std::swap;
   swap(a.author_id, b.author_id);
+  swap(a.cursor, b.cursor);
   swap(a.__isset, b.__isset);
 }
 
-TPostQuery::TPostQuery(const TPostQuery& other10) {
-  author_id = other10.author_id;
-  __isset = other10.__isset;
+TPostQuery::TPostQuery(const TPostQuery& other12) {
+  author_id = other12.author_id;
+  cursor = other12.cursor;
+  __isset = other12.__isset;
 }
-TPostQuery& TPostQuery::operator=(const TPostQuery& other11) {
-  author_id = other11.author_id;
-  __isset = other11.__isset;
+TPostQuery& TPostQuery::operator=(const TPostQuery& other13) {
+  author_id = other13.author_id;
+  cursor = other13.cursor;
+  __isset = other13.__isset;
   return *this;
 }
 void TPostQuery::printTo(std::ostream& out) const {
   using ::apache::thrift::to_string;
   out << "TPostQuery(";
   out << "author_id="; (__isset.author_id ? (out << to_string(author_id)) : (out << "<null>"));
+  out << ", " << "cursor="; (__isset.cursor ? (out << to_string(cursor)) : (out << "<null>"));
   out << ")";
 }
 
@@ -1299,21 +1546,21 @@ void swap(TLike &a, TLike &b) {
   swap(a.post, b.post);
 }
 
-TLike::TLike(const TLike& other12) {
-  id = other12.id;
-  created_at = other12.created_at;
-  account_id = other12.account_id;
-  post_id = other12.post_id;
-  account = other12.account;
-  post = other12.post;
-}
-TLike& TLike::operator=(const TLike& other13) {
-  id = other13.id;
-  created_at = other13.created_at;
-  account_id = other13.account_id;
-  post_id = other13.post_id;
-  account = other13.account;
-  post = other13.post;
+TLike::TLike(const TLike& other14) {
+  id = other14.id;
+  created_at = other14.created_at;
+  account_id = other14.account_id;
+  post_id = other14.post_id;
+  account = other14.account;
+  post = other14.post;
+}
+TLike& TLike::operator=(const TLike& other15) {
+  id = other15.id;
+  created_at = other15.created_at;
+  account_id = other15.account_id;
+  post_id = other15.post_id;
+  account = other15.account;
+  post = other15.post;
   return *this;
 }
 void TLike::printTo(std::ostream& out) const {
@@ -1342,6 +1589,11 @@ void TLikeQuery::__set_post_id(const int32_t val) {
   this->post_id = val;
 __isset.post_id = true;
 }
+
+void TLikeQuery::__set_cursor(const TCursor& val) {
+  this->cursor = val;
+__isset.cursor = true;
+}
 std::ostream& operator<<(std::ostream& out, const TLikeQuery& obj)
 {
   obj.printTo(out);
@@ -1386,6 +1638,14 @@ uint32_t TLikeQuery::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->cursor.read(iprot);
+          this->__isset.cursor = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1413,6 +1673,11 @@ uint32_t TLikeQuery::write(::apache::thrift::protocol::TProtocol* oprot) const {
     xfer += oprot->writeI32(this->post_id);
     xfer += oprot->writeFieldEnd();
   }
+  if (this->__isset.cursor) {
+    xfer += oprot->writeFieldBegin("cursor", ::apache::thrift::protocol::T_STRUCT, 3);
+    xfer += this->cursor.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -1422,18 +1687,21 @@ void swap(TLikeQuery &a, TLikeQuery &b) {
   using ::std::swap;
   swap(a.account_id, b.account_id);
   swap(a.post_id, b.post_id);
+  swap(a.cursor, b.cursor);
   swap(a.__isset, b.__isset);
 }
 
-TLikeQuery::TLikeQuery(const TLikeQuery& other14) {
-  account_id = other14.account_id;
-  post_id = other14.post_id;
-  __isset = other14.__isset;
+TLikeQuery::TLikeQuery(const TLikeQuery& other16) {
+  account_id = other16.account_id;
+  post_id = other16.post_id;
+  cursor = other16.cursor;
+  __isset = other16.__isset;
 }
-TLikeQuery& TLikeQuery::operator=(const TLikeQuery& other15) {
-  account_id = other15.account_id;
-  post_id = other15.post_id;
-  __isset = other15.__isset;
+TLikeQuery& TLikeQuery::operator=(const TLikeQuery& other17) {
+  account_id = other17.account_id;
+  post_id = other17.post_id;
+  cursor = other17.cursor;
+  __isset = other17.__isset;
   return *this;
 }
 void TLikeQuery::printTo(std::ostream& out) const {
@@ -1441,6 +1709,7 @@ void TLikeQuery::printTo(std::ostream& out) const {
   out << "TLikeQuery(";
   out << "account_id="; (__isset.account_id ? (out << to_string(account_id)) : (out << "<null>"));
   out << ", " << "post_id="; (__isset.post_id ? (out << to_string(post_id)) : (out << "<null>"));
+  out << ", " << "cursor="; (__isset.cursor ? (out << to_string(cursor)) : (out << "<null>"));
   out << ")";
 }
 
@@ -1602,19 +1871,19 @@ void swap(TUniquepair &a, TUniquepair &b) {
   swap(a.second_elem, b.second_elem);
 }
 
-TUniquepair::TUniquepair(const TUniquepair& other16) {
-  id = other16.id;
-  created_at = other16.created_at;
-  domain = other16.domain;
-  first_elem = other16.first_elem;
-  second_elem = other16.second_elem;
+TUniquepair::TUniquepair(const TUniquepair& other18) {
+  id = other18.id;
+  created_at = other18.created_at;
+  domain = other18.domain;
+  first_elem = other18.first_elem;
+  second_elem = other18.second_elem;
 }
-TUniquepair& TUniquepair::operator=(const TUniquepair& other17) {
-  id = other17.id;
-  created_at = other17.created_at;
-  domain = other17.domain;
-  first_elem = other17.first_elem;
-  second_elem = other17.second_elem;
+TUniquepair& TUniquepair::operator=(const TUniquepair& other19) {
+  id = other19.id;
+  created_at = other19.created_at;
+  domain = other19.domain;
+  first_elem = other19.first_elem;
+  second_elem = other19.second_elem;
   return *this;
 }
 void TUniquepair::printTo(std::ostream& out) const {
@@ -1646,6 +1915,11 @@ void TUniquepairQuery::__set_second_elem(const int32_t val) {
   this->second_elem = val;
 __isset.second_elem = true;
 }
+
+void TUniquepairQuery::__set_cursor(const TCursor& val) {
+  this->cursor = val;
+__isset.cursor = true;
+}
 std::ostream& operator<<(std::ostream& out, const TUniquepairQuery& obj)
 {
   obj.printTo(out);
@@ -1699,6 +1973,14 @@ uint32_t TUniquepairQuery::read(::apache::thrift::protocol::TProtocol* iprot) {
           xfer += iprot->skip(ftype);
         }
         break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->cursor.read(iprot);
+          this->__isset.cursor = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1732,6 +2014,11 @@ uint32_t TUniquepairQuery::write(::apache::thrift::protocol::TProtocol* oprot) c
     xfer += oprot->writeI32(this->second_elem);
     xfer += oprot->writeFieldEnd();
   }
+  if (this->__isset.cursor) {
+    xfer += oprot->writeFieldBegin("cursor", ::apache::thrift::protocol::T_STRUCT, 4);
+    xfer += this->cursor.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
   return xfer;
@@ -1742,20 +2029,23 @@ void swap(TUniquepairQuery &a, TUniquepairQuery &b) {
   swap(a.domain, b.domain);
   swap(a.first_elem, b.first_elem);
   swap(a.second_elem, b.second_elem);
+  swap(a.cursor, b.cursor);
   swap(a.__isset, b.__isset);
 }
 
-TUniquepairQuery::TUniquepairQuery(const TUniquepairQuery& other18) {
-  domain = other18.domain;
-  first_elem = other18.first_elem;
-  second_elem = other18.second_elem;
-  __isset = other18.__isset;
+TUniquepairQuery::TUniquepairQuery(const TUniquepairQuery& other20) {
+  domain = other20.domain;
+  first_elem = other20.first_elem;
+  second_elem = other20.second_elem;
+  cursor = other20.cursor;
+  __isset = other20.__isset;
 }
-TUniquepairQuery& TUniquepairQuery::operator=(const TUniquepairQuery& other19) {
-  domain = other19.domain;
-  first_elem = other19.first_elem;
-  second_elem = other19.second_elem;
-  __isset = other19.__isset;
+TUniquepairQuery& TUniquepairQuery::operator=(const TUniquepairQuery& other21) {
+  domain = other21.domain;
+  first_elem = other21.first_elem;
+  second_elem = other21.second_elem;
+  cursor = other21.cursor;
+  __isset = other21.__isset;
   return *this;
 }
 void TUniquepairQuery::printTo(std::ostream& out) const {
@@ -1764,6 +2054,7 @@ void TUniquepairQuery::printTo(std::ostream& out) const {
   out << "domain=" << to_string(domain);
   out << ", " << "first_elem="; (__isset.first_elem ? (out << to_string(first_elem)) : (out << "<null>"));
   out << ", " << "second_elem="; (__isset.second_elem ? (out << to_string(second_elem)) : (out << "<null>"));
+  out << ", " << "cursor="; (__isset.cursor ? (out << to_string(cursor)) : (out << "<null>"));
   out << ")";
 }
 
@@ -1822,11 +2113,11 @@ void swap(TAccountInvalidCredentialsException &a, TAccountInvalidCredentialsExce
   (void) b;
 }
 
-TAccountInvalidCredentialsException::TAccountInvalidCredentialsException(const TAccountInvalidCredentialsException& other20) : TException() {
-  (void) other20;
+TAccountInvalidCredentialsException::TAccountInvalidCredentialsException(const TAccountInvalidCredentialsException& other22) : TException() {
+  (void) other22;
 }
-TAccountInvalidCredentialsException& TAccountInvalidCredentialsException::operator=(const TAccountInvalidCredentialsException& other21) {
-  (void) other21;
+TAccountInvalidCredentialsException& TAccountInvalidCredentialsException::operator=(const TAccountInvalidCredentialsException& other23) {
+  (void) other23;
   return *this;
 }
 void TAccountInvalidCredentialsException::printTo(std::ostream& out) const {
@@ -1901,11 +2192,11 @@ void swap(TAccountDeactivatedException &a, TAccountDeactivatedException &b) {
   (void) b;
 }
 
-TAccountDeactivatedException::TAccountDeactivatedException(const TAccountDeactivatedException& other22) : TException() {
-  (void) other22;
+TAccountDeactivatedException::TAccountDeactivatedException(const TAccountDeactivatedException& other24) : TException() {
+  (void) other24;
 }
-TAccountDeactivatedException& TAccountDeactivatedException::operator=(const TAccountDeactivatedException& other23) {
-  (void) other23;
+TAccountDeactivatedException& TAccountDeactivatedException::operator=(const TAccountDeactivatedException& other25) {
+  (void) other25;
   return *this;
 }
 void TAccountDeactivatedException::printTo(std::ostream& out) const {
@@ -1980,11 +2271,11 @@ void swap(TAccountInvalidAttributesException &a, TAccountInvalidAttributesExcept
   (void) b;
 }
 
-TAccountInvalidAttributesException::TAccountInvalidAttributesException(const TAccountInvalidAttributesException& other24) : TException() {
-  (void) other24;
+TAccountInvalidAttributesException::TAccountInvalidAttributesException(const TAccountInvalidAttributesException& other26) : TException() {
+  (void) other26;
 }
-TAccountInvalidAttributesException& TAccountInvalidAttributesException::operator=(const TAccountInvalidAttributesException& other25) {
-  (void) other25;
+TAccountInvalidAttributesException& TAccountInvalidAttributesException::operator=(const TAccountInvalidAttributesException& other27) {
+  (void) other27;
   return *this;
 }
 void TAccountInvalidAttributesException::printTo(std::ostream& out) const {
@@ -2059,11 +2350,11 @@ void swap(TAccountUsernameAlreadyExistsException &a, TAccountUsernameAlreadyExis
   (void) b;
 }
 
-TAccountUsernameAlreadyExistsException::TAccountUsernameAlreadyExistsException(const TAccountUsernameAlreadyExistsException& other26) : TException() {
-  (void) other26;
+TAccountUsernameAlreadyExistsException::TAccountUsernameAlreadyExistsException(const TAccountUsernameAlreadyExistsException& other28) : TException() {
+  (void) other28;
 }
-TAccountUsernameAlreadyExistsException& TAccountUsernameAlreadyExistsException::operator=(const TAccountUsernameAlreadyExistsException& other27) {
-  (void) other27;
+TAccountUsernameAlreadyExistsException& TAccountUsernameAlreadyExistsException::operator=(const TAccountUsernameAlreadyExistsException& other29) {
+  (void) other29;
   return *this;
 }
 void TAccountUsernameAlreadyExistsException::printTo(std::ostream& out) const {
@@ -2138,11 +2429,11 @@ void swap(TAccountNotFoundException &a, TAccountNotFoundException &b) {
   (void) b;
 }
 
-TAccountNotFoundException::TAccountNotFoundException(const TAccountNotFoundException& other28) : TException() {
-  (void) other28;
+TAccountNotFoundException::TAccountNotFoundException(const TAccountNotFoundException& other30) : TException() {
+  (void) other30;
 }
-TAccountNotFoundException& TAccountNotFoundException::operator=(const TAccountNotFoundException& other29) {
-  (void) other29;
+TAccountNotFoundException& TAccountNotFoundException::operator=(const TAccountNotFoundException& other31) {
+  (void) other31;
   return *this;
 }
 void TAccountNotFoundException::printTo(std::ostream& out) const {
@@ -2217,11 +2508,11 @@ void swap(TAccountNotAuthorizedException &a, TAccountNotAuthorizedException &b)
   (void) b;
 }
 
-TAccountNotAuthorizedException::TAccountNotAuthorizedException(const TAccountNotAuthorizedException& other30) : TException() {
-  (void) other30;
+TAccountNotAuthorizedException::TAccountNotAuthorizedException(const TAccountNotAuthorizedException& other32) : TException() {
+  (void) other32;
 }
-TAccountNotAuthorizedException& TAccountNotAuthorizedException::operator=(const TAccountNotAuthorizedException& other31) {
-  (void) other31;
+TAccountNotAuthorizedException& TAccountNotAuthorizedException::operator=(const TAccountNotAuthorizedException& other33) {
+  (void) other33;
   return *this;
 }
 void TAccountNotAuthorizedException::printTo(std::ostream& out) const {
@@ -2296,11 +2587,11 @@ void swap(TFollowAlreadyExistsException &a, TFollowAlreadyExistsException &b) {
   (void) b;
 }
 
-TFollowAlreadyExistsException::TFollowAlreadyExistsException(const TFollowAlreadyExistsException& other32) : TException() {
-  (void) other32;
+TFollowAlreadyExistsException::TFollowAlreadyExistsException(const TFollowAlreadyExistsException& other34) : TException() {
+  (void) other34;
 }
-TFollowAlreadyExistsException& TFollowAlreadyExistsException::operator=(const TFollowAlreadyExistsException& other33) {
-  (void) other33;
+TFollowAlreadyExistsException& TFollowAlreadyExistsException::operator=(const TFollowAlreadyExistsException& other35) {
+  (void) other35;
   return *this;
 }
 void TFollowAlreadyExistsException::printTo(std::ostream& out) const {
@@ -2375,11 +2666,11 @@ void swap(TFollowNotFoundException &a, TFollowNotFoundException &b) {
   (void) b;
 }
 
-TFollowNotFoundException::TFollowNotFoundException(const TFollowNotFoundException& other34) : TException() {
-  (void) other34;
+TFollowNotFoundException::TFollowNotFoundException(const TFollowNotFoundException& other36) : TException() {
+  (void) other36;
 }
-TFollowNotFoundException& TFollowNotFoundException::operator=(const TFollowNotFoundException& other35) {
-  (void) other35;
+TFollowNotFoundException& TFollowNotFoundException::operator=(const TFollowNotFoundException& other37) {
+  (void) other37;
   return *this;
 }
 void TFollowNotFoundException::printTo(std::ostream& out) const {
@@ -2454,11 +2745,11 @@ void swap(TFollowNotAuthorizedException &a, TFollowNotAuthorizedException &b) {
   (void) b;
 }
 
-TFollowNotAuthorizedException::TFollowNotAuthorizedException(const TFollowNotAuthorizedException& other36) : TException() {
-  (void) other36;
+TFollowNotAuthorizedException::TFollowNotAuthorizedException(const TFollowNotAuthorizedException& other38) : TException() {
+  (void) other38;
 }
-TFollowNotAuthorizedException& TFollowNotAuthorizedException::operator=(const TFollowNotAuthorizedException& other37) {
-  (void) other37;
+TFollowNotAuthorizedException& TFollowNotAuthorizedException::operator=(const TFollowNotAuthorizedException& other39) {
+  (void) other39;
   return *this;
 }
 void TFollowNotAuthorizedException::printTo(std::ostream& out) const {
@@ -2533,11 +2824,11 @@ void swap(TLikeAlreadyExistsException &a, TLikeAlreadyExistsException &b) {
   (void) b;
 }
 
-TLikeAlreadyExistsException::TLikeAlreadyExistsException(const TLikeAlreadyExistsException& other38) : TException() {
-  (void) other38;
+TLikeAlreadyExistsException::TLikeAlreadyExistsException(const TLikeAlreadyExistsException& other40) : TException() {
+  (void) other40;
 }
-TLikeAlreadyExistsException& TLikeAlreadyExistsException::operator=(const TLikeAlreadyExistsException& other39) {
-  (void) other39;
+TLikeAlreadyExistsException& TLikeAlreadyExistsException::operator=(const TLikeAlreadyExistsException& other41) {
+  (void) other41;
   return *this;
 }
 void TLikeAlreadyExistsException::printTo(std::ostream& out) const {
@@ -2612,11 +2903,11 @@ void swap(TLikeNotFoundException &a, TLikeNotFoundException &b) {
   (void) b;
 }
 
-TLikeNotFoundException::TLikeNotFoundException(const TLikeNotFoundException& other40) : TException() {
-  (void) other40;
+TLikeNotFoundException::TLikeNotFoundException(const TLikeNotFoundException& other42) : TException() {
+  (void) other42;
 }
-TLikeNotFoundException& TLikeNotFoundException::operator=(const TLikeNotFoundException& other41) {
-  (void) other41;
+TLikeNotFoundException& TLikeNotFoundException::operator=(const TLikeNotFoundException& other43) {
+  (void) other43;
   return *this;
 }
 void TLikeNotFoundException::printTo(std::ostream& out) const {
@@ -2691,11 +2982,11 @@ void swap(TLikeNotAuthorizedException &a, TLikeNotAuthorizedException &b) {
   (void) b;
 }
 
-TLikeNotAuthorizedException::TLikeNotAuthorizedException(const TLikeNotAuthorizedException& other42) : TException() {
-  (void) other42;
+TLikeNotAuthorizedException::TLikeNotAuthorizedException(const TLikeNotAuthorizedException& other44) : TException() {
+  (void) other44;
 }
-TLikeNotAuthorizedException& TLikeNotAuthorizedException::operator=(const TLikeNotAuthorizedException& other43) {
-  (void) other43;
+TLikeNotAuthorizedException& TLikeNotAuthorizedException::operator=(const TLikeNotAuthorizedException& other45) {
+  (void) other45;
   return *this;
 }
 void TLikeNotAuthorizedException::printTo(std::ostream& out) const {
@@ -2770,11 +3061,11 @@ void swap(TPostInvalidAttributesException &a, TPostInvalidAttributesException &b
   (void) b;
 }
 
-TPostInvalidAttributesException::TPostInvalidAttributesException(const TPostInvalidAttributesException& other44) : TException() {
-  (void) other44;
+TPostInvalidAttributesException::TPostInvalidAttributesException(const TPostInvalidAttributesException& other46) : TException() {
+  (void) other46;
 }
-TPostInvalidAttributesException& TPostInvalidAttributesException::operator=(const TPostInvalidAttributesException& other45) {
-  (void) other45;
+TPostInvalidAttributesException& TPostInvalidAttributesException::operator=(const TPostInvalidAttributesException& other47) {
+  (void) other47;
   return *this;
 }
 void TPostInvalidAttributesException::printTo(std::ostream& out) const {
@@ -2849,11 +3140,11 @@ void swap(TPostNotFoundException &a, TPostNotFoundException &b) {
   (void) b;
 }
 
-TPostNotFoundException::TPostNotFoundException(const TPostNotFoundException& other46) : TException() {
-  (void) other46;
+TPostNotFoundException::TPostNotFoundException(const TPostNotFoundException& other48) : TException() {
+  (void) other48;
 }
-TPostNotFoundException& TPostNotFoundException::operator=(const TPostNotFoundException& other47) {
-  (void) other47;
+TPostNotFoundException& TPostNotFoundException::operator=(const TPostNotFoundException& other49) {
+  (void) other49;
   return *this;
 }
 void TPostNotFoundException::printTo(std::ostream& out) const {
@@ -2928,11 +3219,11 @@ void swap(TPostNotAuthorizedException &a, TPostNotAuthorizedException &b) {
   (void) b;
 }
 
-TPostNotAuthorizedException::TPostNotAuthorizedException(const TPostNotAuthorizedException& other48) : TException() {
-  (void) other48;
+TPostNotAuthorizedException::TPostNotAuthorizedException(const TPostNotAuthorizedException& other50) : TException() {
+  (void) other50;
 }
-TPostNotAuthorizedException& TPostNotAuthorizedException::operator=(const TPostNotAuthorizedException& other49) {
-  (void) other49;
+TPostNotAuthorizedException& TPostNotAuthorizedException::operator=(const TPostNotAuthorizedException& other51) {
+  (void) other51;
   return *this;
 }
 void TPostNotAuthorizedException::printTo(std::ostream& out) const {
@@ -3007,11 +3298,11 @@ void swap(TUniquepairNotFoundException &a, TUniquepairNotFoundException &b) {
   (void) b;
 }
 
-TUniquepairNotFoundException::TUniquepairNotFoundException(const TUniquepairNotFoundException& other50) : TException() {
-  (void) other50;
+TUniquepairNotFoundException::TUniquepairNotFoundException(const TUniquepairNotFoundException& other52) : TException() {
+  (void) other52;
 }
-TUniquepairNotFoundException& TUniquepairNotFoundException::operator=(const TUniquepairNotFoundException& other51) {
-  (void) other51;
+TUniquepairNotFoundException& TUniquepairNotFoundException::operator=(const TUniquepairNotFoundException& other53) {
+  (void) other53;
   return *this;
 }
 void TUniquepairNotFoundException::printTo(std::ostream& out) const {
@@ -3086,11 +3377,11 @@ void swap(TUniquepairAlreadyExistsException &a, TUniquepairAlreadyExistsExceptio
   (void) b;
 }
 
-TUniquepairAlreadyExistsException::TUniquepairAlreadyExistsException(const TUniquepairAlreadyExistsException& other52) : TException() {
-  (void) other52;
+TUniquepairAlreadyExistsException::TUniquepairAlreadyExistsException(const TUniquepairAlreadyExistsException& other54) : TException() {
+  (void) other54;
 }
-TUniquepairAlreadyExistsException& TUniquepairAlreadyExistsException::operator=(const TUniquepairAlreadyExistsException& other53) {
-  (void) other53;
+TUniquepairAlreadyExistsException& TUniquepairAlreadyExistsException::operator=(const TUniquepairAlreadyExistsException& other55) {
+  (void) other55;
   return *this;
 }
 void TUniquepairAlreadyExistsException::printTo(std::ostream& out) const {
@@ -3110,4 +3401,83 @@ const char* TUniquepairAlreadyExistsException::what() const noexcept {
   }
 }
 
+
+TServerOverloadedException::~TServerOverloadedException() noexcept {
+}
+
+std::ostream& operator<<(std::ostream& out, const TServerOverloadedException& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+uint32_t TServerOverloadedException::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    xfer += iprot->skip(ftype);
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t TServerOverloadedException::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("TServerOverloadedException");
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(TServerOverloadedException &a, TServerOverloadedException &b) {
+  using ::std::swap;
+  (void) a;
+  (void) b;
+}
+
+TServerOverloadedException::TServerOverloadedException(const TServerOverloadedException& other56) : TException() {
+  (void) other56;
+}
+TServerOverloadedException& TServerOverloadedException::operator=(const TServerOverloadedException& other57) {
+  (void) other57;
+  return *this;
+}
+void TServerOverloadedException::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "TServerOverloadedException(";
+  out << ")";
+}
+
+const char* TServerOverloadedException::what() const noexcept {
+  try {
+    std::stringstream ss;
+    ss << "TException - service has thrown: " << *this;
+    this->thriftTExceptionMessageHolder_ = ss.str();
+    return this->thriftTExceptionMessageHolder_.c_str();
+  } catch (const std::exception&) {
+    return "TException - service has thrown: TServerOverloadedException";
+  }
+}
+
 } // namespace
@@ -0,0 +1,218 @@
+// Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
+// Systems
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <pqxx/pqxx>
+
+#include <buzzblog/metrics.h>
+
+
+// A bounded, thread-safe pool of PostgreSQL connections. Connections are opened
+// lazily (up to `size`) and kept open across requests, so handlers do not pay
+// a TCP and authentication handshake with the database on every call. Every
+// connection registers the pool's prepared statements when it is opened.
+class PGConnectionPool {
+public:
+  // A connection checked out from the pool. It goes back to the pool when the
+  // handle is destroyed.
+  using Connection = std::unique_ptr<pqxx::connection,
+      std::function<void(pqxx::connection*)>>;
+
+  // Pool usage since its creation.
+  struct Stats {
+    int size;                   // maximum number of connections.
+    int n_open;                 // number of connections currently open.
+    int n_in_use;               // number of connections currently checked out.
+    int64_t n_acquisitions;     // number of successful checkouts.
+    int64_t n_timeouts;         // number of timed checkouts that gave up.
+    int64_t n_reconnections;    // number of connections found broken.
+    int64_t total_wait_us;      // total time spent waiting for a connection.
+    int64_t max_wait_us;        // longest time spent waiting for a connection.
+  };
+
+  // If given, the time spent waiting for each connection is recorded into
+  // `wait_histogram`.
+  PGConnectionPool(const std::string& conn_str, int size,
+      Histogram* wait_histogram = nullptr, int health_check_interval_ms = 1000)
+  : _conn_str(conn_str),
+    _size(std::max(size, 1)),
+    _wait_histogram(wait_histogram),
+    _health_check_interval(health_check_interval_ms),
+    _n_open(0),
+    _n_in_use(0),
+    _n_acquisitions(0),
+    _n_timeouts(0),
+    _n_reconnections(0),
+    _total_wait_us(0),
+    _max_wait_us(0) {
+  }
+
+  PGConnectionPool(const PGConnectionPool&) = delete;
+  PGConnectionPool& operator=(const PGConnectionPool&) = delete;
+
+  // Register a named prepared statement. Statements must be registered before
+  // the first checkout, so that every connection of the pool knows them.
+  void prepare(const std::string& name, const std::string& definition) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _statements.push_back(std::make_pair(name, definition));
+  }
+
+  // Check out a connection, blocking until one is available.
+  Connection acquire() {
+    return checkout(nullptr);
+  }
+
+  // Check out a connection, blocking for at most `timeout`. Returns an empty
+  // handle if no connection became available in time.
+  Connection acquire_for(std::chrono::milliseconds timeout) {
+    return checkout(&timeout);
+  }
+
+  Stats stats() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return Stats{_size, _n_open, _n_in_use, _n_acquisitions, _n_timeouts,
+        _n_reconnections, _total_wait_us, _max_wait_us};
+  }
+
+private:
+  struct IdleConnection {
+    std::unique_ptr<pqxx::connection> conn;
+    std::chrono::steady_clock::time_point last_used;
+  };
+
+  Connection checkout(const std::chrono::milliseconds* timeout) {
+    auto start_time = std::chrono::steady_clock::now();
+    IdleConnection idle;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      auto available = [this] {
+        return !_idle.empty() || _n_open < _size;
+      };
+      if (timeout == nullptr) {
+        _cv.wait(lock, available);
+      }
+      else if (!_cv.wait_for(lock, *timeout, available)) {
+        _n_timeouts++;
+        return Connection(nullptr, [](pqxx::connection*) {});
+      }
+      if (!_idle.empty()) {
+        idle = std::move(_idle.back());
+        _idle.pop_back();
+      }
+      else {
+        // Reserve a slot for a new connection, opened outside the lock.
+        _n_open++;
+      }
+      _n_in_use++;
+      auto wait = std::chrono::steady_clock::now() - start_time;
+      auto wait_us = std::chrono::duration_cast<std::chrono::microseconds>(
+          wait).count();
+      if (_wait_histogram)
+        _wait_histogram->record(wait);
+      _n_acquisitions++;
+      _total_wait_us += wait_us;
+      _max_wait_us = std::max(_max_wait_us, int64_t(wait_us));
+    }
+
+    try {
+      if (!idle.conn) {
+        idle.conn = open();
+      }
+      else if (!healthy(idle)) {
+        {
+          std::lock_guard<std::mutex> lock(_mutex);
+          _n_reconnections++;
+        }
+        idle.conn.reset();
+        idle.conn = open();
+      }
+    }
+    catch (...) {
+      // Give the slot back if the database could not be reached.
+      discard();
+      throw;
+    }
+
+    return Connection(idle.conn.release(), [this](pqxx::connection* conn) {
+      release(conn);
+    });
+  }
+
+  std::unique_ptr<pqxx::connection> open() {
+    auto conn = std::make_unique<pqxx::connection>(_conn_str);
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (const auto& statement : _statements)
+      conn->prepare(statement.first, statement.second);
+    return conn;
+  }
+
+  // Connections that were idle for a while are probed before being handed out,
+  // since the database may have closed them in the meantime.
+  bool healthy(const IdleConnection& idle) {
+    if (!idle.conn->is_open())
+      return false;
+    if (std::chrono::steady_clock::now() - idle.last_used <
+        _health_check_interval)
+      return true;
+    try {
+      pqxx::nontransaction txn(*idle.conn);
+      txn.exec("SELECT 1");
+      return true;
+    }
+    catch (const pqxx::broken_connection& e) {
+      return false;
+    }
+  }
+
+  void release(pqxx::connection* conn) {
+    std::unique_ptr<pqxx::connection> owned(conn);
+    if (!owned->is_open()) {
+      discard();
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _idle.push_back(IdleConnection{std::move(owned),
+          std::chrono::steady_clock::now()});
+      _n_in_use--;
+    }
+    _cv.notify_one();
+  }
+
+  void discard() {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _n_open--;
+      _n_in_use--;
+    }
+    _cv.notify_one();
+  }
+
+  const std::string _conn_str;
+  const int _size;
+  Histogram* const _wait_histogram;
+  const std::chrono::milliseconds _health_check_interval;
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  std::vector<IdleConnection> _idle;
+  std::vector<std::pair<std::string, std::string>> _statements;
+  int _n_open;
+  int _n_in_use;
+  int64_t _n_acquisitions;
+  int64_t _n_timeouts;
+  int64_t _n_reconnections;
+  int64_t _total_wait_us;
+  int64_t _max_wait_us;
+};
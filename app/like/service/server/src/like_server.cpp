@@ -1,17 +1,22 @@
 // Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
 // Systems
 
+#include <map>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 #include <cxxopts.hpp>
-#include <spdlog/sinks/basic_file_sink.h>
-#include <thrift/protocol/TBinaryProtocol.h>
-#include <thrift/server/TThreadedServer.h>
-#include <thrift/transport/TBufferTransports.h>
-#include <thrift/transport/TServerSocket.h>
 
 #include <buzzblog/gen/TLikeService.h>
+#include <buzzblog/admission_controller.h>
 #include <buzzblog/base_server.h>
+#include <buzzblog/call_logger.h>
+#include <buzzblog/call_tracer.h>
+#include <buzzblog/metrics_server.h>
+#include <buzzblog/server_event_handler.h>
+#include <buzzblog/span_collector.h>
+#include <buzzblog/thrift_server.h>
 
 
 using namespace apache::thrift;
@@ -33,6 +38,7 @@ public:
 
   void like_post(TLike& _return, const TRequestMetadata& request_metadata,
       const int32_t post_id) {
+    ServerEventHandler::set_request_metadata(request_metadata);
     // Add unique pair (account, post).
     auto uniquepair_client = get_uniquepair_client();
     TUniquepair uniquepair;
@@ -43,7 +49,6 @@ public:
     catch (TUniquepairAlreadyExistsException e) {
       throw TLikeAlreadyExistsException();
     }
-    uniquepair_client->close();
 
     // Build like (standard mode).
     _return.id = uniquepair.id;
@@ -54,6 +59,7 @@ public:
 
   void retrieve_standard_like(TLike& _return,
       const TRequestMetadata& request_metadata, const int32_t like_id) {
+    ServerEventHandler::set_request_metadata(request_metadata);
     // Get unique pair.
     auto uniquepair_client = get_uniquepair_client();
     TUniquepair uniquepair;
@@ -63,7 +69,6 @@ public:
     catch (TUniquepairNotFoundException e) {
       throw TLikeNotFoundException();
     }
-    uniquepair_client->close();
 
     // Build like (standard mode).
     _return.id = uniquepair.id;
@@ -74,28 +79,31 @@ public:
 
   void retrieve_expanded_like(TLike& _return,
       const TRequestMetadata& request_metadata, const int32_t like_id) {
+    ServerEventHandler::set_request_metadata(request_metadata);
     // Retrieve standard like.
     retrieve_standard_like(_return, request_metadata, like_id);
 
-    // Retrieve account.
-    auto account_client = get_account_client();
-    auto account = account_client->retrieve_standard_account(request_metadata,
-        _return.account_id);
-    account_client->close();
-
-    // Retrieve post.
+    // Retrieve post concurrently.
     auto post_client = get_post_client();
-    auto post = post_client->retrieve_expanded_post(request_metadata,
+    auto post = post_client->retrieve_expanded_post_async(request_metadata,
         _return.post_id);
-    post_client->close();
+
+    // Retrieve account meanwhile.
+    auto account_id = _return.account_id;
+    auto account = hedged_account_call("account:retrieve_standard_account",
+        [=](account_service::Client& client) {
+          return client.retrieve_standard_account(request_metadata,
+              account_id);
+        });
 
     // Build like (expanded mode).
     _return.__set_account(account);
-    _return.__set_post(post);
+    _return.__set_post(post.get());
   }
 
   void delete_like(const TRequestMetadata& request_metadata,
       const int32_t like_id) {
+    ServerEventHandler::set_request_metadata(request_metadata);
     {
       // Get unique pair.
       auto uniquepair_client = get_uniquepair_client();
@@ -106,7 +114,6 @@ public:
       catch (TUniquepairNotFoundException e) {
         throw TLikeNotFoundException();
       }
-      uniquepair_client->close();
 
       // Check if requester is authorized.
       if (request_metadata.requester_id != uniquepair.first_elem)
@@ -121,12 +128,12 @@ public:
     catch (TUniquepairNotFoundException e) {
       throw TLikeNotFoundException();
     }
-    uniquepair_client->close();
   }
 
   void list_likes(std::vector<TLike>& _return,
       const TRequestMetadata& request_metadata, const TLikeQuery& query,
       const int32_t limit, const int32_t offset) {
+    ServerEventHandler::set_request_metadata(request_metadata);
     // Build query struct.
     TUniquepairQuery uniquepair_query;
     uniquepair_query.__set_domain("like");
@@ -134,24 +141,50 @@ public:
       uniquepair_query.__set_first_elem(query.account_id);
     if (query.__isset.post_id)
       uniquepair_query.__set_second_elem(query.post_id);
+    if (query.__isset.cursor)
+      uniquepair_query.__set_cursor(query.cursor);
 
     // Fetch unique pairs.
     auto uniquepair_client = get_uniquepair_client();
     std::vector<TUniquepair> uniquepairs = uniquepair_client->fetch(
         request_metadata, uniquepair_query, limit, offset);
-    uniquepair_client->close();
+
+    std::map<int32_t, TAccount> accounts;
+    std::map<int32_t, TPost> posts;
+    if (!uniquepairs.empty()) {
+      std::vector<int32_t> account_ids;
+      std::vector<int32_t> post_ids;
+      for (auto it : uniquepairs) {
+        account_ids.push_back(it.first_elem);
+        post_ids.push_back(it.second_elem);
+      }
+
+      // Retrieve posts concurrently.
+      auto expanded_posts = async_post_call("post:retrieve_expanded_posts",
+          [=](post_service::Client& client) {
+            return client.retrieve_expanded_posts(request_metadata, post_ids);
+          });
+
+      // Retrieve accounts meanwhile.
+      accounts = hedged_account_call("account:retrieve_standard_accounts",
+          [=](account_service::Client& client) {
+            return client.retrieve_standard_accounts(request_metadata,
+                account_ids);
+          });
+      posts = expanded_posts.get();
+    }
 
     // Build likes.
-    auto account_client = get_account_client();
-    auto post_client = get_post_client();
     for (auto it : uniquepairs) {
       // Retrieve account.
-      auto account = account_client->retrieve_standard_account(request_metadata,
-          it.first_elem);
+      auto account = accounts.find(it.first_elem);
+      if (account == accounts.end())
+        throw TAccountNotFoundException();
 
       // Retrieve post.
-      auto post = post_client->retrieve_expanded_post(request_metadata,
-          it.second_elem);
+      auto post = posts.find(it.second_elem);
+      if (post == posts.end())
+        throw TPostNotFoundException();
 
       // Build like (expanded mode).
       TLike like;
@@ -159,40 +192,53 @@ public:
       like.created_at = it.created_at;
       like.account_id = it.first_elem;
       like.post_id = it.second_elem;
-      like.__set_account(account);
-      like.__set_post(post);
+      like.__set_account(account->second);
+      like.__set_post(post->second);
       _return.push_back(like);
     }
-    account_client->close();
-    post_client->close();
   }
 
   int32_t count_likes_by_account(const TRequestMetadata& request_metadata,
       const int32_t account_id) {
+    ServerEventHandler::set_request_metadata(request_metadata);
     // Build query struct.
     TUniquepairQuery query;
     query.__set_domain("like");
     query.__set_first_elem(account_id);
 
     // Count unique pairs.
-    auto uniquepair_client = get_uniquepair_client();
-    auto count = uniquepair_client->count(request_metadata, query);
-    uniquepair_client->close();
-    return count;
+    return hedged_uniquepair_call("uniquepair:count",
+        [=](uniquepair_service::Client& client) {
+          return client.count(request_metadata, query);
+        });
   }
 
   int32_t count_likes_of_post(const TRequestMetadata& request_metadata,
       const int32_t post_id) {
+    ServerEventHandler::set_request_metadata(request_metadata);
     // Build query struct.
     TUniquepairQuery query;
     query.__set_domain("like");
     query.__set_second_elem(post_id);
 
     // Count unique pairs.
+    return hedged_uniquepair_call("uniquepair:count",
+        [=](uniquepair_service::Client& client) {
+          return client.count(request_metadata, query);
+        });
+  }
+
+  void count_likes_of_posts(std::map<int32_t, int32_t>& _return,
+      const TRequestMetadata& request_metadata,
+      const std::vector<int32_t>& post_ids) {
+    ServerEventHandler::set_request_metadata(request_metadata);
+    if (post_ids.empty())
+      return;
+
+    // Count unique pairs of all posts at once.
     auto uniquepair_client = get_uniquepair_client();
-    auto count = uniquepair_client->count(request_metadata, query);
-    uniquepair_client->close();
-    return count;
+    _return = uniquepair_client->count_grouped(request_metadata, "like",
+        post_ids);
   }
 };
 
@@ -204,6 +250,21 @@ int main(int argc, char** argv) {
       ("host", "", cxxopts::value<std::string>()->default_value("0.0.0.0"))
       ("port", "", cxxopts::value<int>())
       ("threads", "", cxxopts::value<int>())
+      ("server_mode", "", cxxopts::value<std::string>()->default_value(
+          "nonblocking"))
+      ("io_threads", "", cxxopts::value<int>()->default_value("2"))
+      ("client_threads", "", cxxopts::value<int>()->default_value("32"))
+      ("log_queue_size", "", cxxopts::value<int>()->default_value("8192"))
+      ("log_blocking", "", cxxopts::value<bool>()->default_value("false"))
+      ("handler_log", "", cxxopts::value<bool>()->default_value("false"))
+      ("trace_format", "", cxxopts::value<std::string>()->default_value(
+          "text"))
+      ("trace_file_size_mb", "", cxxopts::value<int>()->default_value("64"))
+      ("trace_max_files", "", cxxopts::value<int>()->default_value("8"))
+      ("metrics_port", "", cxxopts::value<int>()->default_value("0"))
+      ("span_sample_rate", "", cxxopts::value<double>()->default_value("0"))
+      ("admission_limit", "", cxxopts::value<int>()->default_value("0"))
+      ("admission_max_limit", "", cxxopts::value<int>()->default_value("1000"))
       ("backend_filepath", "", cxxopts::value<std::string>()->default_value(
           "/etc/opt/BuzzBlogApp/backend.yml"))
       ("postgres_user", "", cxxopts::value<std::string>()->default_value(
@@ -218,27 +279,62 @@ int main(int argc, char** argv) {
   std::string host = result["host"].as<std::string>();
   int port = result["port"].as<int>();
   int threads = result["threads"].as<int>();
+  std::string server_mode = result["server_mode"].as<std::string>();
+  int io_threads = result["io_threads"].as<int>();
+  int client_threads = result["client_threads"].as<int>();
+  int log_queue_size = result["log_queue_size"].as<int>();
+  bool log_blocking = result["log_blocking"].as<bool>();
+  bool handler_log = result["handler_log"].as<bool>();
+  std::string trace_format = result["trace_format"].as<std::string>();
+  int trace_file_size_mb = result["trace_file_size_mb"].as<int>();
+  int trace_max_files = result["trace_max_files"].as<int>();
+  int metrics_port = result["metrics_port"].as<int>();
+  double span_sample_rate = result["span_sample_rate"].as<double>();
+  int admission_limit = result["admission_limit"].as<int>();
+  int admission_max_limit = result["admission_max_limit"].as<int>();
   std::string backend_filepath = result["backend_filepath"].as<std::string>();
   std::string postgres_user = result["postgres_user"].as<std::string>();
   std::string postgres_password = result["postgres_password"].as<std::string>();
   std::string postgres_dbname = result["postgres_dbname"].as<std::string>();
 
-  // Initialize logger.
-  auto logger = spdlog::basic_logger_mt("logger", "/tmp/calls.log");
-  logger->set_pattern("[%H:%M:%S.%F] pid=%P tid=%t %v");
+  // Initialize loggers. The phases of handled calls are only logged on
+  // request.
+  if (trace_format == "text")
+    init_call_logger("/tmp/calls.log", log_queue_size, log_blocking);
+  else if (trace_format == "binary")
+    init_call_tracer("/tmp/calls.bin", size_t(trace_file_size_mb) << 20,
+        trace_max_files);
+  else
+    throw std::invalid_argument("Invalid trace format: " + trace_format);
+  if (handler_log)
+    init_handler_logger("/tmp/handlers.log", log_blocking);
+
+  // Initialize span collector.
+  if (span_sample_rate > 0)
+    init_span_collector("/tmp/spans.json", "like", span_sample_rate);
+
+  // Initialize admission controller.
+  if (admission_limit > 0)
+    init_admission_controller(admission_limit, admission_max_limit);
+
+  // Initialize executor of asynchronous RPCs.
+  if (client_threads > 0)
+    init_client_executor(client_threads);
+
+  // Serve metrics.
+  if (metrics_port)
+    start_metrics_server(metrics_port);
 
   // Create server.
-  TThreadedServer server(
-      std::make_shared<TLikeServiceProcessor>(
-          std::make_shared<TLikeServiceHandler>(backend_filepath,
-              postgres_user, postgres_password, postgres_dbname)),
-      std::make_shared<TServerSocket>(host, port),
-      std::make_shared<TBufferedTransportFactory>(),
-      std::make_shared<TBinaryProtocolFactory>());
-  server.setConcurrentClientLimit(threads);
+  auto processor = std::make_shared<TLikeServiceProcessor>(
+      std::make_shared<TLikeServiceHandler>(backend_filepath,
+          postgres_user, postgres_password, postgres_dbname));
+  processor->setEventHandler(std::make_shared<ServerEventHandler>());
+  auto server = make_server(server_mode, processor, host, port, threads,
+      io_threads);
 
   // Serve requests.
-  server.serve();
+  server->serve();
 
   return 0;
 }
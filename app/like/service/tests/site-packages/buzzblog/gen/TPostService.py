@@ -46,6 +46,15 @@ class Iface(object):
         """
         pass
 
+    def retrieve_expanded_posts(self, request_metadata, post_ids):
+        """
+        Parameters:
+         - request_metadata
+         - post_ids
+
+        """
+        pass
+
     def delete_post(self, request_metadata, post_id):
         """
         Parameters:
@@ -117,6 +126,8 @@ class Client(Iface):
             return result.success
         if result.e is not None:
             raise result.e
+        if result.overloaded is not None:
+            raise result.overloaded
         raise TApplicationException(TApplicationException.MISSING_RESULT, "create_post failed: unknown result")
 
     def retrieve_standard_post(self, request_metadata, post_id):
@@ -153,6 +164,8 @@ class Client(Iface):
             return result.success
         if result.e is not None:
             raise result.e
+        if result.overloaded is not None:
+            raise result.overloaded
         raise TApplicationException(TApplicationException.MISSING_RESULT, "retrieve_standard_post failed: unknown result")
 
     def retrieve_expanded_post(self, request_metadata, post_id):
@@ -191,8 +204,48 @@ class Client(Iface):
             raise result.e1
         if result.e2 is not None:
             raise result.e2
+        if result.overloaded is not None:
+            raise result.overloaded
         raise TApplicationException(TApplicationException.MISSING_RESULT, "retrieve_expanded_post failed: unknown result")
 
+    def retrieve_expanded_posts(self, request_metadata, post_ids):
+        """
+        Parameters:
+         - request_metadata
+         - post_ids
+
+        """
+        self.send_retrieve_expanded_posts(request_metadata, post_ids)
+        return self.recv_retrieve_expanded_posts()
+
+    def send_retrieve_expanded_posts(self, request_metadata, post_ids):
+        self._oprot.writeMessageBegin('retrieve_expanded_posts', TMessageType.CALL, self._seqid)
+        args = retrieve_expanded_posts_args()
+        args.request_metadata = request_metadata
+        args.post_ids = post_ids
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_retrieve_expanded_posts(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = retrieve_expanded_posts_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.success is not None:
+            return result.success
+        if result.e is not None:
+            raise result.e
+        if result.overloaded is not None:
+            raise result.overloaded
+        raise TApplicationException(TApplicationException.MISSING_RESULT, "retrieve_expanded_posts failed: unknown result")
+
     def delete_post(self, request_metadata, post_id):
         """
         Parameters:
@@ -227,6 +280,8 @@ class Client(Iface):
             raise result.e1
         if result.e2 is not None:
             raise result.e2
+        if result.overloaded is not None:
+            raise result.overloaded
         return
 
     def list_posts(self, request_metadata, query, limit, offset):
@@ -267,6 +322,8 @@ class Client(Iface):
             return result.success
         if result.e is not None:
             raise result.e
+        if result.overloaded is not None:
+            raise result.overloaded
         raise TApplicationException(TApplicationException.MISSING_RESULT, "list_posts failed: unknown result")
 
     def count_posts_by_author(self, request_metadata, author_id):
@@ -301,6 +358,8 @@ class Client(Iface):
         iprot.readMessageEnd()
         if result.success is not None:
             return result.success
+        if result.overloaded is not None:
+            raise result.overloaded
         raise TApplicationException(TApplicationException.MISSING_RESULT, "count_posts_by_author failed: unknown result")
 
 
@@ -311,6 +370,7 @@ class Processor(Iface, TProcessor):
         self._processMap["create_post"] = Processor.process_create_post
         self._processMap["retrieve_standard_post"] = Processor.process_retrieve_standard_post
         self._processMap["retrieve_expanded_post"] = Processor.process_retrieve_expanded_post
+        self._processMap["retrieve_expanded_posts"] = Processor.process_retrieve_expanded_posts
         self._processMap["delete_post"] = Processor.process_delete_post
         self._processMap["list_posts"] = Processor.process_list_posts
         self._processMap["count_posts_by_author"] = Processor.process_count_posts_by_author
@@ -349,6 +409,9 @@ class Processor(Iface, TProcessor):
         except TPostInvalidAttributesException as e:
             msg_type = TMessageType.REPLY
             result.e = e
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -375,6 +438,9 @@ class Processor(Iface, TProcessor):
         except TPostNotFoundException as e:
             msg_type = TMessageType.REPLY
             result.e = e
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -404,6 +470,9 @@ class Processor(Iface, TProcessor):
         except TAccountNotFoundException as e2:
             msg_type = TMessageType.REPLY
             result.e2 = e2
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -417,6 +486,35 @@ class Processor(Iface, TProcessor):
         oprot.writeMessageEnd()
         oprot.trans.flush()
 
+    def process_retrieve_expanded_posts(self, seqid, iprot, oprot):
+        args = retrieve_expanded_posts_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = retrieve_expanded_posts_result()
+        try:
+            result.success = self._handler.retrieve_expanded_posts(args.request_metadata, args.post_ids)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except TAccountNotFoundException as e:
+            msg_type = TMessageType.REPLY
+            result.e = e
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("retrieve_expanded_posts", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
     def process_delete_post(self, seqid, iprot, oprot):
         args = delete_post_args()
         args.read(iprot)
@@ -433,6 +531,9 @@ class Processor(Iface, TProcessor):
         except TPostNotAuthorizedException as e2:
             msg_type = TMessageType.REPLY
             result.e2 = e2
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -459,6 +560,9 @@ class Processor(Iface, TProcessor):
         except TAccountNotFoundException as e:
             msg_type = TMessageType.REPLY
             result.e = e
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -482,6 +586,9 @@ class Processor(Iface, TProcessor):
             msg_type = TMessageType.REPLY
         except TTransport.TTransportException:
             raise
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -578,13 +685,15 @@ class create_post_result(object):
     Attributes:
      - success
      - e
+     - overloaded
 
     """
 
 
-    def __init__(self, success=None, e=None,):
+    def __init__(self, success=None, e=None, overloaded=None,):
         self.success = success
         self.e = e
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -607,6 +716,12 @@ class create_post_result(object):
                     self.e.read(iprot)
                 else:
                     iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -625,6 +740,10 @@ class create_post_result(object):
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
             self.e.write(oprot)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 2)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -645,6 +764,7 @@ all_structs.append(create_post_result)
 create_post_result.thrift_spec = (
     (0, TType.STRUCT, 'success', [TPost, None], None, ),  # 0
     (1, TType.STRUCT, 'e', [TPostInvalidAttributesException, None], None, ),  # 1
+    (2, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 2
 )
 
 
@@ -728,13 +848,15 @@ class retrieve_standard_post_result(object):
     Attributes:
      - success
      - e
+     - overloaded
 
     """
 
 
-    def __init__(self, success=None, e=None,):
+    def __init__(self, success=None, e=None, overloaded=None,):
         self.success = success
         self.e = e
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -757,6 +879,12 @@ class retrieve_standard_post_result(object):
                     self.e.read(iprot)
                 else:
                     iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -775,6 +903,10 @@ class retrieve_standard_post_result(object):
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
             self.e.write(oprot)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 2)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -795,6 +927,7 @@ all_structs.append(retrieve_standard_post_result)
 retrieve_standard_post_result.thrift_spec = (
     (0, TType.STRUCT, 'success', [TPost, None], None, ),  # 0
     (1, TType.STRUCT, 'e', [TPostNotFoundException, None], None, ),  # 1
+    (2, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 2
 )
 
 
@@ -879,14 +1012,16 @@ class retrieve_expanded_post_result(object):
      - success
      - e1
      - e2
+     - overloaded
 
     """
 
 
-    def __init__(self, success=None, e1=None, e2=None,):
+    def __init__(self, success=None, e1=None, e2=None, overloaded=None,):
         self.success = success
         self.e1 = e1
         self.e2 = e2
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -915,6 +1050,12 @@ class retrieve_expanded_post_result(object):
                     self.e2.read(iprot)
                 else:
                     iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -937,6 +1078,10 @@ class retrieve_expanded_post_result(object):
             oprot.writeFieldBegin('e2', TType.STRUCT, 2)
             self.e2.write(oprot)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 3)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -958,6 +1103,188 @@ retrieve_expanded_post_result.thrift_spec = (
     (0, TType.STRUCT, 'success', [TPost, None], None, ),  # 0
     (1, TType.STRUCT, 'e1', [TPostNotFoundException, None], None, ),  # 1
     (2, TType.STRUCT, 'e2', [TAccountNotFoundException, None], None, ),  # 2
+    (3, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 3
+)
+
+
+class retrieve_expanded_posts_args(object):
+    """
+    Attributes:
+     - request_metadata
+     - post_ids
+
+    """
+
+
+    def __init__(self, request_metadata=None, post_ids=None,):
+        self.request_metadata = request_metadata
+        self.post_ids = post_ids
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRUCT:
+                    self.request_metadata = TRequestMetadata()
+                    self.request_metadata.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.LIST:
+                    self.post_ids = []
+                    (_etype49, _size46) = iprot.readListBegin()
+                    for _i50 in range(_size46):
+                        _elem51 = iprot.readI32()
+                        self.post_ids.append(_elem51)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('retrieve_expanded_posts_args')
+        if self.request_metadata is not None:
+            oprot.writeFieldBegin('request_metadata', TType.STRUCT, 1)
+            self.request_metadata.write(oprot)
+            oprot.writeFieldEnd()
+        if self.post_ids is not None:
+            oprot.writeFieldBegin('post_ids', TType.LIST, 2)
+            oprot.writeListBegin(TType.I32, len(self.post_ids))
+            for iter52 in self.post_ids:
+                oprot.writeI32(iter52)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(retrieve_expanded_posts_args)
+retrieve_expanded_posts_args.thrift_spec = (
+    None,  # 0
+    (1, TType.STRUCT, 'request_metadata', [TRequestMetadata, None], None, ),  # 1
+    (2, TType.LIST, 'post_ids', (TType.I32, None, False), None, ),  # 2
+)
+
+
+class retrieve_expanded_posts_result(object):
+    """
+    Attributes:
+     - success
+     - e
+     - overloaded
+
+    """
+
+
+    def __init__(self, success=None, e=None, overloaded=None,):
+        self.success = success
+        self.e = e
+        self.overloaded = overloaded
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 0:
+                if ftype == TType.MAP:
+                    self.success = {}
+                    (_ktype54, _vtype55, _size53) = iprot.readMapBegin()
+                    for _i57 in range(_size53):
+                        _key58 = iprot.readI32()
+                        _val59 = TPost()
+                        _val59.read(iprot)
+                        self.success[_key58] = _val59
+                    iprot.readMapEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
+                if ftype == TType.STRUCT:
+                    self.e = TAccountNotFoundException()
+                    self.e.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('retrieve_expanded_posts_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.MAP, 0)
+            oprot.writeMapBegin(TType.I32, TType.STRUCT, len(self.success))
+            for kiter60, viter61 in self.success.items():
+                oprot.writeI32(kiter60)
+                viter61.write(oprot)
+            oprot.writeMapEnd()
+            oprot.writeFieldEnd()
+        if self.e is not None:
+            oprot.writeFieldBegin('e', TType.STRUCT, 1)
+            self.e.write(oprot)
+            oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 2)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(retrieve_expanded_posts_result)
+retrieve_expanded_posts_result.thrift_spec = (
+    (0, TType.MAP, 'success', (TType.I32, None, TType.STRUCT, [TPost, None], False), None, ),  # 0
+    (1, TType.STRUCT, 'e', [TAccountNotFoundException, None], None, ),  # 1
+    (2, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 2
 )
 
 
@@ -1041,13 +1368,15 @@ class delete_post_result(object):
     Attributes:
      - e1
      - e2
+     - overloaded
 
     """
 
 
-    def __init__(self, e1=None, e2=None,):
+    def __init__(self, e1=None, e2=None, overloaded=None,):
         self.e1 = e1
         self.e2 = e2
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -1070,6 +1399,12 @@ class delete_post_result(object):
                     self.e2.read(iprot)
                 else:
                     iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -1088,6 +1423,10 @@ class delete_post_result(object):
             oprot.writeFieldBegin('e2', TType.STRUCT, 2)
             self.e2.write(oprot)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 3)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -1109,6 +1448,7 @@ delete_post_result.thrift_spec = (
     None,  # 0
     (1, TType.STRUCT, 'e1', [TPostNotFoundException, None], None, ),  # 1
     (2, TType.STRUCT, 'e2', [TPostNotAuthorizedException, None], None, ),  # 2
+    (3, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 3
 )
 
 
@@ -1217,13 +1557,15 @@ class list_posts_result(object):
     Attributes:
      - success
      - e
+     - overloaded
 
     """
 
 
-    def __init__(self, success=None, e=None,):
+    def __init__(self, success=None, e=None, overloaded=None,):
         self.success = success
         self.e = e
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -1237,11 +1579,11 @@ class list_posts_result(object):
             if fid == 0:
                 if ftype == TType.LIST:
                     self.success = []
-                    (_etype17, _size14) = iprot.readListBegin()
-                    for _i18 in range(_size14):
-                        _elem19 = TPost()
-                        _elem19.read(iprot)
-                        self.success.append(_elem19)
+                    (_etype65, _size62) = iprot.readListBegin()
+                    for _i66 in range(_size62):
+                        _elem67 = TPost()
+                        _elem67.read(iprot)
+                        self.success.append(_elem67)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -1251,6 +1593,12 @@ class list_posts_result(object):
                     self.e.read(iprot)
                 else:
                     iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -1264,14 +1612,18 @@ class list_posts_result(object):
         if self.success is not None:
             oprot.writeFieldBegin('success', TType.LIST, 0)
             oprot.writeListBegin(TType.STRUCT, len(self.success))
-            for iter20 in self.success:
-                iter20.write(oprot)
+            for iter68 in self.success:
+                iter68.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.e is not None:
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
             self.e.write(oprot)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 2)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -1292,6 +1644,7 @@ all_structs.append(list_posts_result)
 list_posts_result.thrift_spec = (
     (0, TType.LIST, 'success', (TType.STRUCT, [TPost, None], False), None, ),  # 0
     (1, TType.STRUCT, 'e', [TAccountNotFoundException, None], None, ),  # 1
+    (2, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 2
 )
 
 
@@ -1374,12 +1727,14 @@ class count_posts_by_author_result(object):
     """
     Attributes:
      - success
+     - overloaded
 
     """
 
 
-    def __init__(self, success=None,):
+    def __init__(self, success=None, overloaded=None,):
         self.success = success
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -1395,6 +1750,12 @@ class count_posts_by_author_result(object):
                     self.success = iprot.readI32()
                 else:
                     iprot.skip(ftype)
+            elif fid == 1:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -1409,6 +1770,10 @@ class count_posts_by_author_result(object):
             oprot.writeFieldBegin('success', TType.I32, 0)
             oprot.writeI32(self.success)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 1)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -1428,6 +1793,7 @@ class count_posts_by_author_result(object):
 all_structs.append(count_posts_by_author_result)
 count_posts_by_author_result.thrift_spec = (
     (0, TType.I32, 'success', None, None, ),  # 0
+    (1, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 1
 )
 fix_spec(all_structs)
 del all_structs
@@ -9,5 +9,63 @@ CREATE TABLE Posts(
   author_id INTEGER NOT NULL
 );
 
-CREATE INDEX idx_created_at ON Posts(created_at);
-CREATE INDEX idx_author_id ON Posts(author_id);
+-- Posts are listed in (created_at, id) order, so that the listing can resume
+-- from a cursor with an index seek.
+CREATE INDEX idx_created_at ON Posts(created_at, id);
+CREATE INDEX idx_author_id ON Posts(author_id, created_at, id);
+
+-- Number of posts written by each author, kept up to date by a trigger so that
+-- counting posts does not scan them.
+CREATE TABLE PostCounts(
+  author_id INTEGER PRIMARY KEY,
+  count INTEGER NOT NULL
+);
+
+CREATE FUNCTION update_post_counts() RETURNS TRIGGER AS $$
+BEGIN
+  IF TG_OP = 'INSERT' THEN
+    INSERT INTO PostCounts (author_id, count)
+    VALUES (NEW.author_id, 1)
+    ON CONFLICT (author_id) DO UPDATE SET count = PostCounts.count + 1;
+    RETURN NEW;
+  ELSE
+    UPDATE PostCounts
+    SET count = count - 1
+    WHERE author_id = OLD.author_id;
+    RETURN OLD;
+  END IF;
+END;
+$$ LANGUAGE plpgsql;
+
+CREATE TRIGGER trg_post_counts
+AFTER INSERT OR DELETE ON Posts
+FOR EACH ROW EXECUTE FUNCTION update_post_counts();
+
+-- Recompute counters from the Posts table, repairing any drift. Writes to Posts
+-- are blocked while it runs. Returns the number of counters repaired.
+CREATE FUNCTION reconcile_post_counts() RETURNS INTEGER AS $$
+DECLARE
+  n_repaired INTEGER;
+BEGIN
+  LOCK TABLE Posts IN SHARE MODE;
+  WITH actual AS (
+    SELECT author_id, COUNT(*) AS count
+    FROM Posts
+    GROUP BY author_id
+  ), repaired AS (
+    INSERT INTO PostCounts (author_id, count)
+    SELECT author_id, count FROM actual
+    ON CONFLICT (author_id) DO UPDATE SET count = EXCLUDED.count
+    WHERE PostCounts.count <> EXCLUDED.count
+    RETURNING 1
+  ), zeroed AS (
+    UPDATE PostCounts
+    SET count = 0
+    WHERE count <> 0 AND author_id NOT IN (SELECT author_id FROM actual)
+    RETURNING 1
+  )
+  SELECT (SELECT COUNT(*) FROM repaired) + (SELECT COUNT(*) FROM zeroed)
+  INTO n_repaired;
+  RETURN n_repaired;
+END;
+$$ LANGUAGE plpgsql;
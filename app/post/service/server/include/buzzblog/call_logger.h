@@ -0,0 +1,61 @@
+// Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
+// Systems
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include <spdlog/async.h>
+#include <spdlog/sinks/basic_file_sink.h>
+#include <spdlog/spdlog.h>
+
+
+// Create the logger of RPC calls, named "logger". Messages are formatted and
+// written to `filepath` by a background thread, so RPCs do not wait for the
+// file. At most `queue_size` messages are buffered: when the queue is full, the
+// oldest message is dropped, or the caller waits if `blocking` is set.
+inline std::shared_ptr<spdlog::logger> init_call_logger(
+    const std::string& filepath, int queue_size, bool blocking) {
+  spdlog::init_thread_pool(queue_size, 1);
+  std::shared_ptr<spdlog::logger> logger;
+  if (blocking)
+    logger = spdlog::basic_logger_mt<spdlog::async_factory>("logger",
+        filepath);
+  else
+    logger = spdlog::basic_logger_mt<spdlog::async_factory_nonblock>("logger",
+        filepath);
+  logger->set_pattern("[%H:%M:%S.%F] pid=%P tid=%t %v");
+  return logger;
+}
+
+// The logger of RPC calls, looked up in the spdlog registry only once. Returns
+// null if it was not created before the first call.
+inline spdlog::logger* call_logger() {
+  static std::shared_ptr<spdlog::logger> logger = spdlog::get("logger");
+  return logger.get();
+}
+
+// Create the logger of the calls processed by this server, named
+// "handler_logger" (see 'server_event_handler.h'). It shares the background
+// thread of the logger of RPC calls if that was created first, and otherwise
+// spdlog starts a default one.
+inline std::shared_ptr<spdlog::logger> init_handler_logger(
+    const std::string& filepath, bool blocking) {
+  std::shared_ptr<spdlog::logger> logger;
+  if (blocking)
+    logger = spdlog::basic_logger_mt<spdlog::async_factory>("handler_logger",
+        filepath);
+  else
+    logger = spdlog::basic_logger_mt<spdlog::async_factory_nonblock>(
+        "handler_logger", filepath);
+  logger->set_pattern("[%H:%M:%S.%F] pid=%P tid=%t %v");
+  return logger;
+}
+
+// The logger of the calls processed by this server, or null if it was not
+// created before the first call.
+inline spdlog::logger* handler_logger() {
+  static std::shared_ptr<spdlog::logger> logger = spdlog::get("handler_logger");
+  return logger.get();
+}
@@ -0,0 +1,38 @@
+// Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
+// Systems
+
+#pragma once
+
+#include <future>
+#include <utility>
+
+#include <buzzblog/executor.h>
+
+
+// The executor of the asynchronous RPCs of this process (see 'base_client.h'),
+// shared by every client, or null if RPCs are made synchronously.
+inline Executor*& client_executor() {
+  static Executor* executor = nullptr;
+  return executor;
+}
+
+// Create the executor of asynchronous RPCs, with `n_threads` threads, which
+// bound the RPCs in flight at once. It lives until the process exits.
+inline Executor* init_client_executor(int n_threads) {
+  client_executor() = new Executor(n_threads);
+  return client_executor();
+}
+
+// Run `task` on the executor of asynchronous RPCs, returning a future holding
+// its result or the exception it threw. Without an executor, `task` runs on
+// the calling thread before the future is returned.
+template <typename F>
+auto run_async(F&& task) -> std::future<decltype(task())> {
+  auto executor = client_executor();
+  if (executor)
+    return executor->submit(std::forward<F>(task));
+  std::packaged_task<decltype(task())()> packaged_task(std::forward<F>(task));
+  auto future = packaged_task.get_future();
+  packaged_task();
+  return future;
+}
@@ -0,0 +1,220 @@
+// Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
+// Systems
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <thrift/transport/TTransportException.h>
+
+#include <buzzblog/circuit_breaker.h>
+#include <buzzblog/load_balancer.h>
+#include <buzzblog/wire_format.h>
+
+
+// A bounded, thread-safe pool of long-lived connections to one server. Each
+// RPC checks out a client and returns it afterwards, so connections are not
+// opened and torn down on every call. At most `max_size` connections are open
+// at once, idle or in use: checkouts beyond that wait for a client to come
+// back, for at most `conn_timeout_ms`. At most `size` idle connections are
+// kept open, and connections that stay idle for longer than `max_idle_ms`, or
+// that the server closed while idle, are closed. Clients that hit a transport
+// error are discarded, and the next checkout reconnects.
+// A client goes back to the pool once its asynchronous RPCs have completed.
+// Clients report the calls they make to the load of the server (see
+// 'load_balancer.h') and to its circuit breaker (see 'circuit_breaker.h'), as
+// do failed connection attempts.
+template <typename TClient>
+class ClientPool {
+public:
+  // A client checked out from the pool. It goes back to the pool when the
+  // handle is destroyed.
+  using Client = std::unique_ptr<TClient, std::function<void(TClient*)>>;
+
+  // Pool usage since its creation.
+  struct Stats {
+    int max_size;               // maximum number of connections.
+    int n_idle;                 // number of idle connections.
+    int n_in_use;               // number of clients currently checked out.
+    int64_t n_acquisitions;     // number of checkouts.
+    int64_t n_connections;      // number of connections opened.
+    int64_t n_evictions;        // number of idle connections closed.
+    int64_t n_errors;           // number of clients discarded after errors.
+    int64_t n_timeouts;         // number of checkouts that gave up waiting.
+  };
+
+  ClientPool(const std::string& ip_address, int port, int size, int max_size,
+      int conn_timeout_ms, const WireFormat& wire_format = {},
+      const CircuitBreaker::Options& breaker_options = {},
+      int max_idle_ms = 10000)
+  : _ip_address(ip_address),
+    _port(port),
+    _max_size(std::max(max_size, 1)),
+    _size(std::min(size, _max_size)),
+    _conn_timeout_ms(conn_timeout_ms),
+    _wire_format(wire_format),
+    _max_idle(max_idle_ms),
+    _breaker(breaker_options),
+    _n_in_use(0),
+    _n_acquisitions(0),
+    _n_connections(0),
+    _n_evictions(0),
+    _n_errors(0),
+    _n_timeouts(0) {
+  }
+
+  ClientPool(const ClientPool&) = delete;
+  ClientPool& operator=(const ClientPool&) = delete;
+
+  const std::string& ip_address() const {
+    return _ip_address;
+  }
+
+  int port() const {
+    return _port;
+  }
+
+  const ServerLoad& load() const {
+    return _load;
+  }
+
+  const CircuitBreaker& breaker() const {
+    return _breaker;
+  }
+
+  // Check out a client, reusing an idle connection if there is one. If
+  // `max_size` connections are in use, blocks until one comes back, and throws
+  // a TTransportException if none does within the connection timeout. Waiting
+  // for a connection is not a failure of the server, so it does not count
+  // against its circuit breaker.
+  Client acquire() {
+    std::unique_ptr<TClient> client;
+    std::deque<std::unique_ptr<TClient>> evicted;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      auto available = [this] {
+        return !_idle.empty() || _n_in_use < _max_size;
+      };
+      if (!_cv.wait_for(lock, std::chrono::milliseconds(_conn_timeout_ms),
+          available)) {
+        _n_timeouts++;
+        throw apache::thrift::transport::TTransportException(
+            apache::thrift::transport::TTransportException::TIMED_OUT,
+            "No connection to " + _ip_address + ":" + std::to_string(_port) +
+            " available");
+      }
+      evict(&evicted);
+      // Reuse the most recently used connection, so that the others can
+      // expire. Connections the server closed while they were idle are
+      // discarded here rather than failing the next RPC, which would count
+      // against the server.
+      while (!client && !_idle.empty()) {
+        client = std::move(_idle.back().client);
+        _idle.pop_back();
+        if (client->peer_closed()) {
+          evicted.push_back(std::move(client));
+          _n_evictions++;
+        }
+      }
+      _n_in_use++;
+      _n_acquisitions++;
+    }
+
+    if (!client) {
+      try {
+        client = std::make_unique<TClient>(_ip_address, _port,
+            _conn_timeout_ms, _wire_format);
+        client->set_load(&_load);
+        client->set_breaker(&_breaker);
+      }
+      catch (...) {
+        // A server that cannot be reached counts as a failed call, and as a
+        // failed probe if its breaker is half-open.
+        _breaker.end_call(true, std::chrono::nanoseconds(0),
+            _breaker.start_call());
+        {
+          std::lock_guard<std::mutex> lock(_mutex);
+          _n_in_use--;
+        }
+        _cv.notify_one();
+        throw;
+      }
+      std::lock_guard<std::mutex> lock(_mutex);
+      _n_connections++;
+    }
+
+    return Client(client.release(), [this](TClient* client) {
+      release(client);
+    });
+  }
+
+  Stats stats() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return Stats{_max_size, int(_idle.size()), _n_in_use, _n_acquisitions,
+        _n_connections, _n_evictions, _n_errors, _n_timeouts};
+  }
+
+private:
+  struct IdleClient {
+    std::unique_ptr<TClient> client;
+    std::chrono::steady_clock::time_point last_used;
+  };
+
+  void release(TClient* client) {
+    std::unique_ptr<TClient> owned(client);
+    owned->wait_async();
+    std::deque<std::unique_ptr<TClient>> evicted;
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _n_in_use--;
+      if (!owned->is_reusable()) {
+        _n_errors++;
+      }
+      else if (int(_idle.size()) < _size) {
+        _idle.push_back(IdleClient{std::move(owned),
+            std::chrono::steady_clock::now()});
+        evict(&evicted);
+      }
+    }
+    // Either the connection is idle or its slot is free.
+    _cv.notify_one();
+  }
+
+  // Move expired idle connections into `evicted`, to be closed once the lock is
+  // released. The least recently used connections are at the front.
+  void evict(std::deque<std::unique_ptr<TClient>>* evicted) {
+    auto now = std::chrono::steady_clock::now();
+    while (!_idle.empty() && now - _idle.front().last_used > _max_idle) {
+      evicted->push_back(std::move(_idle.front().client));
+      _idle.pop_front();
+      _n_evictions++;
+    }
+  }
+
+  const std::string _ip_address;
+  const int _port;
+  const int _max_size;
+  const int _size;
+  const int _conn_timeout_ms;
+  const WireFormat _wire_format;
+  const std::chrono::milliseconds _max_idle;
+  ServerLoad _load;
+  CircuitBreaker _breaker;
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  std::deque<IdleClient> _idle;
+  int _n_in_use;
+  int64_t _n_acquisitions;
+  int64_t _n_connections;
+  int64_t _n_evictions;
+  int64_t _n_errors;
+  int64_t _n_timeouts;
+};
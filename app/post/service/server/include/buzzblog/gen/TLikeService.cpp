@@ -145,6 +145,14 @@ uint32_t TLikeService_like_post_result::read(::apache::thrift::protocol::TProtoc
           xfer += iprot->skip(ftype);
         }
         break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -171,6 +179,10 @@ uint32_t TLikeService_like_post_result::write(::apache::thrift::protocol::TProto
     xfer += oprot->writeFieldBegin("e", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->e.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 2);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -219,6 +231,14 @@ uint32_t TLikeService_like_post_presult::read(::apache::thrift::protocol::TProto
           xfer += iprot->skip(ftype);
         }
         break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -368,6 +388,14 @@ uint32_t TLikeService_retrieve_standard_like_result::read(::apache::thrift::prot
           xfer += iprot->skip(ftype);
         }
         break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -394,6 +422,10 @@ uint32_t TLikeService_retrieve_standard_like_result::write(::apache::thrift::pro
     xfer += oprot->writeFieldBegin("e", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->e.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 2);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -442,6 +474,14 @@ uint32_t TLikeService_retrieve_standard_like_presult::read(::apache::thrift::pro
           xfer += iprot->skip(ftype);
         }
         break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -607,6 +647,14 @@ uint32_t TLikeService_retrieve_expanded_like_result::read(::apache::thrift::prot
           xfer += iprot->skip(ftype);
         }
         break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -641,6 +689,10 @@ uint32_t TLikeService_retrieve_expanded_like_result::write(::apache::thrift::pro
     xfer += oprot->writeFieldBegin("e3", ::apache::thrift::protocol::T_STRUCT, 3);
     xfer += this->e3.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 4);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -705,6 +757,14 @@ uint32_t TLikeService_retrieve_expanded_like_presult::read(::apache::thrift::pro
           xfer += iprot->skip(ftype);
         }
         break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -854,6 +914,14 @@ uint32_t TLikeService_delete_like_result::read(::apache::thrift::protocol::TProt
           xfer += iprot->skip(ftype);
         }
         break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -880,6 +948,10 @@ uint32_t TLikeService_delete_like_result::write(::apache::thrift::protocol::TPro
     xfer += oprot->writeFieldBegin("e2", ::apache::thrift::protocol::T_STRUCT, 2);
     xfer += this->e2.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 3);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -928,6 +1000,14 @@ uint32_t TLikeService_delete_like_presult::read(::apache::thrift::protocol::TPro
           xfer += iprot->skip(ftype);
         }
         break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1097,14 +1177,14 @@ uint32_t TLikeService_list_likes_result::read(::apache::thrift::protocol::TProto
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size65;
-            ::apache::thrift::protocol::TType _etype68;
-            xfer += iprot->readListBegin(_etype68, _size65);
-            this->success.resize(_size65);
-            uint32_t _i69;
-            for (_i69 = 0; _i69 < _size65; ++_i69)
+            uint32_t _size91;
+            ::apache::thrift::protocol::TType _etype94;
+            xfer += iprot->readListBegin(_etype94, _size91);
+            this->success.resize(_size91);
+            uint32_t _i95;
+            for (_i95 = 0; _i95 < _size91; ++_i95)
             {
-              xfer += this->success[_i69].read(iprot);
+              xfer += this->success[_i95].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -1129,6 +1209,14 @@ uint32_t TLikeService_list_likes_result::read(::apache::thrift::protocol::TProto
           xfer += iprot->skip(ftype);
         }
         break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1151,10 +1239,10 @@ uint32_t TLikeService_list_likes_result::write(::apache::thrift::protocol::TProt
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->success.size()));
-      std::vector<TLike> ::const_iterator _iter70;
-      for (_iter70 = this->success.begin(); _iter70 != this->success.end(); ++_iter70)
+      std::vector<TLike> ::const_iterator _iter96;
+      for (_iter96 = this->success.begin(); _iter96 != this->success.end(); ++_iter96)
       {
-        xfer += (*_iter70).write(oprot);
+        xfer += (*_iter96).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -1167,6 +1255,10 @@ uint32_t TLikeService_list_likes_result::write(::apache::thrift::protocol::TProt
     xfer += oprot->writeFieldBegin("e2", ::apache::thrift::protocol::T_STRUCT, 2);
     xfer += this->e2.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 3);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -1203,14 +1295,14 @@ uint32_t TLikeService_list_likes_presult::read(::apache::thrift::protocol::TProt
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size71;
-            ::apache::thrift::protocol::TType _etype74;
-            xfer += iprot->readListBegin(_etype74, _size71);
-            (*(this->success)).resize(_size71);
-            uint32_t _i75;
-            for (_i75 = 0; _i75 < _size71; ++_i75)
+            uint32_t _size97;
+            ::apache::thrift::protocol::TType _etype100;
+            xfer += iprot->readListBegin(_etype100, _size97);
+            (*(this->success)).resize(_size97);
+            uint32_t _i101;
+            for (_i101 = 0; _i101 < _size97; ++_i101)
             {
-              xfer += (*(this->success))[_i75].read(iprot);
+              xfer += (*(this->success))[_i101].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -1235,6 +1327,14 @@ uint32_t TLikeService_list_likes_presult::read(::apache::thrift::protocol::TProt
           xfer += iprot->skip(ftype);
         }
         break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1376,6 +1476,14 @@ uint32_t TLikeService_count_likes_by_account_result::read(::apache::thrift::prot
           xfer += iprot->skip(ftype);
         }
         break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1398,6 +1506,10 @@ uint32_t TLikeService_count_likes_by_account_result::write(::apache::thrift::pro
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_I32, 0);
     xfer += oprot->writeI32(this->success);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -1438,6 +1550,14 @@ uint32_t TLikeService_count_likes_by_account_presult::read(::apache::thrift::pro
           xfer += iprot->skip(ftype);
         }
         break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1579,6 +1699,14 @@ uint32_t TLikeService_count_likes_of_post_result::read(::apache::thrift::protoco
           xfer += iprot->skip(ftype);
         }
         break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1601,6 +1729,10 @@ uint32_t TLikeService_count_likes_of_post_result::write(::apache::thrift::protoc
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_I32, 0);
     xfer += oprot->writeI32(this->success);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -1641,6 +1773,304 @@ uint32_t TLikeService_count_likes_of_post_presult::read(::apache::thrift::protoc
           xfer += iprot->skip(ftype);
         }
         break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
+TLikeService_count_likes_of_posts_args::~TLikeService_count_likes_of_posts_args() noexcept {
+}
+
+
+uint32_t TLikeService_count_likes_of_posts_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->request_metadata.read(iprot);
+          this->__isset.request_metadata = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->post_ids.clear();
+            uint32_t _size102;
+            ::apache::thrift::protocol::TType _etype105;
+            xfer += iprot->readListBegin(_etype105, _size102);
+            this->post_ids.resize(_size102);
+            uint32_t _i106;
+            for (_i106 = 0; _i106 < _size102; ++_i106)
+            {
+              xfer += iprot->readI32(this->post_ids[_i106]);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.post_ids = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t TLikeService_count_likes_of_posts_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("TLikeService_count_likes_of_posts_args");
+
+  xfer += oprot->writeFieldBegin("request_metadata", ::apache::thrift::protocol::T_STRUCT, 1);
+  xfer += this->request_metadata.write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("post_ids", ::apache::thrift::protocol::T_LIST, 2);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I32, static_cast<uint32_t>(this->post_ids.size()));
+    std::vector<int32_t> ::const_iterator _iter107;
+    for (_iter107 = this->post_ids.begin(); _iter107 != this->post_ids.end(); ++_iter107)
+    {
+      xfer += oprot->writeI32((*_iter107));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+TLikeService_count_likes_of_posts_pargs::~TLikeService_count_likes_of_posts_pargs() noexcept {
+}
+
+
+uint32_t TLikeService_count_likes_of_posts_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("TLikeService_count_likes_of_posts_pargs");
+
+  xfer += oprot->writeFieldBegin("request_metadata", ::apache::thrift::protocol::T_STRUCT, 1);
+  xfer += (*(this->request_metadata)).write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("post_ids", ::apache::thrift::protocol::T_LIST, 2);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I32, static_cast<uint32_t>((*(this->post_ids)).size()));
+    std::vector<int32_t> ::const_iterator _iter108;
+    for (_iter108 = (*(this->post_ids)).begin(); _iter108 != (*(this->post_ids)).end(); ++_iter108)
+    {
+      xfer += oprot->writeI32((*_iter108));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+TLikeService_count_likes_of_posts_result::~TLikeService_count_likes_of_posts_result() noexcept {
+}
+
+
+uint32_t TLikeService_count_likes_of_posts_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_MAP) {
+          {
+            this->success.clear();
+            uint32_t _size109;
+            ::apache::thrift::protocol::TType _ktype110;
+            ::apache::thrift::protocol::TType _vtype111;
+            xfer += iprot->readMapBegin(_ktype110, _vtype111, _size109);
+            uint32_t _i113;
+            for (_i113 = 0; _i113 < _size109; ++_i113)
+            {
+              int32_t _key114;
+              xfer += iprot->readI32(_key114);
+              int32_t& _val115 = this->success[_key114];
+              xfer += iprot->readI32(_val115);
+            }
+            xfer += iprot->readMapEnd();
+          }
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t TLikeService_count_likes_of_posts_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("TLikeService_count_likes_of_posts_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_MAP, 0);
+    {
+      xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_I32, ::apache::thrift::protocol::T_I32, static_cast<uint32_t>(this->success.size()));
+      std::map<int32_t, int32_t> ::const_iterator _iter116;
+      for (_iter116 = this->success.begin(); _iter116 != this->success.end(); ++_iter116)
+      {
+        xfer += oprot->writeI32(_iter116->first);
+        xfer += oprot->writeI32(_iter116->second);
+      }
+      xfer += oprot->writeMapEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+TLikeService_count_likes_of_posts_presult::~TLikeService_count_likes_of_posts_presult() noexcept {
+}
+
+
+uint32_t TLikeService_count_likes_of_posts_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_MAP) {
+          {
+            (*(this->success)).clear();
+            uint32_t _size117;
+            ::apache::thrift::protocol::TType _ktype118;
+            ::apache::thrift::protocol::TType _vtype119;
+            xfer += iprot->readMapBegin(_ktype118, _vtype119, _size117);
+            uint32_t _i121;
+            for (_i121 = 0; _i121 < _size117; ++_i121)
+            {
+              int32_t _key122;
+              xfer += iprot->readI32(_key122);
+              int32_t& _val123 = (*(this->success))[_key122];
+              xfer += iprot->readI32(_val123);
+            }
+            xfer += iprot->readMapEnd();
+          }
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1712,6 +2142,9 @@ void TLikeServiceClient::recv_like_post(TLike& _return)
   if (result.__isset.e) {
     throw result.e;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "like_post failed: unknown result");
 }
 
@@ -1774,6 +2207,9 @@ void TLikeServiceClient::recv_retrieve_standard_like(TLike& _return)
   if (result.__isset.e) {
     throw result.e;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "retrieve_standard_like failed: unknown result");
 }
 
@@ -1842,6 +2278,9 @@ void TLikeServiceClient::recv_retrieve_expanded_like(TLike& _return)
   if (result.__isset.e3) {
     throw result.e3;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "retrieve_expanded_like failed: unknown result");
 }
 
@@ -1902,6 +2341,9 @@ void TLikeServiceClient::recv_delete_like()
   if (result.__isset.e2) {
     throw result.e2;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   return;
 }
 
@@ -1969,6 +2411,9 @@ void TLikeServiceClient::recv_list_likes(std::vector<TLike> & _return)
   if (result.__isset.e2) {
     throw result.e2;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "list_likes failed: unknown result");
 }
 
@@ -2028,6 +2473,9 @@ int32_t TLikeServiceClient::recv_count_likes_by_account()
   if (result.__isset.success) {
     return _return;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "count_likes_by_account failed: unknown result");
 }
 
@@ -2087,9 +2535,74 @@ int32_t TLikeServiceClient::recv_count_likes_of_post()
   if (result.__isset.success) {
     return _return;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "count_likes_of_post failed: unknown result");
 }
 
+void TLikeServiceClient::count_likes_of_posts(std::map<int32_t, int32_t> & _return, const TRequestMetadata& request_metadata, const std::vector<int32_t> & post_ids)
+{
+  send_count_likes_of_posts(request_metadata, post_ids);
+  recv_count_likes_of_posts(_return);
+}
+
+void TLikeServiceClient::send_count_likes_of_posts(const TRequestMetadata& request_metadata, const std::vector<int32_t> & post_ids)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("count_likes_of_posts", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  TLikeService_count_likes_of_posts_pargs args;
+  args.request_metadata = &request_metadata;
+  args.post_ids = &post_ids;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void TLikeServiceClient::recv_count_likes_of_posts(std::map<int32_t, int32_t> & _return)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("count_likes_of_posts") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  TLikeService_count_likes_of_posts_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
+  }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "count_likes_of_posts failed: unknown result");
+}
+
 bool TLikeServiceProcessor::dispatchCall(::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, const std::string& fname, int32_t seqid, void* callContext) {
   ProcessMap::iterator pfn;
   pfn = processMap_.find(fname);
@@ -2137,6 +2650,9 @@ void TLikeServiceProcessor::process_like_post(int32_t seqid, ::apache::thrift::p
   } catch (TLikeAlreadyExistsException &e) {
     result.e = e;
     result.__isset.e = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TLikeService.like_post");
@@ -2194,6 +2710,9 @@ void TLikeServiceProcessor::process_retrieve_standard_like(int32_t seqid, ::apac
   } catch (TLikeNotFoundException &e) {
     result.e = e;
     result.__isset.e = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TLikeService.retrieve_standard_like");
@@ -2257,6 +2776,9 @@ void TLikeServiceProcessor::process_retrieve_expanded_like(int32_t seqid, ::apac
   } catch (TPostNotFoundException &e3) {
     result.e3 = e3;
     result.__isset.e3 = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TLikeService.retrieve_expanded_like");
@@ -2316,6 +2838,9 @@ void TLikeServiceProcessor::process_delete_like(int32_t seqid, ::apache::thrift:
   } catch (TLikeNotAuthorizedException &e2) {
     result.e2 = e2;
     result.__isset.e2 = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TLikeService.delete_like");
@@ -2376,6 +2901,9 @@ void TLikeServiceProcessor::process_list_likes(int32_t seqid, ::apache::thrift::
   } catch (TPostNotFoundException &e2) {
     result.e2 = e2;
     result.__isset.e2 = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TLikeService.list_likes");
@@ -2430,6 +2958,9 @@ void TLikeServiceProcessor::process_count_likes_by_account(int32_t seqid, ::apac
   try {
     result.success = iface_->count_likes_by_account(args.request_metadata, args.account_id);
     result.__isset.success = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TLikeService.count_likes_by_account");
@@ -2484,6 +3015,9 @@ void TLikeServiceProcessor::process_count_likes_of_post(int32_t seqid, ::apache:
   try {
     result.success = iface_->count_likes_of_post(args.request_metadata, args.post_id);
     result.__isset.success = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TLikeService.count_likes_of_post");
@@ -2513,6 +3047,63 @@ void TLikeServiceProcessor::process_count_likes_of_post(int32_t seqid, ::apache:
   }
 }
 
+void TLikeServiceProcessor::process_count_likes_of_posts(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("TLikeService.count_likes_of_posts", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "TLikeService.count_likes_of_posts");
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "TLikeService.count_likes_of_posts");
+  }
+
+  TLikeService_count_likes_of_posts_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "TLikeService.count_likes_of_posts", bytes);
+  }
+
+  TLikeService_count_likes_of_posts_result result;
+  try {
+    iface_->count_likes_of_posts(result.success, args.request_metadata, args.post_ids);
+    result.__isset.success = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "TLikeService.count_likes_of_posts");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("count_likes_of_posts", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "TLikeService.count_likes_of_posts");
+  }
+
+  oprot->writeMessageBegin("count_likes_of_posts", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "TLikeService.count_likes_of_posts", bytes);
+  }
+}
+
 ::std::shared_ptr< ::apache::thrift::TProcessor > TLikeServiceProcessorFactory::getProcessor(const ::apache::thrift::TConnectionInfo& connInfo) {
   ::apache::thrift::ReleaseHandler< TLikeServiceIfFactory > cleanup(handlerFactory_);
   ::std::shared_ptr< TLikeServiceIf > handler(handlerFactory_->getHandler(connInfo), cleanup);
@@ -2598,6 +3189,10 @@ void TLikeServiceConcurrentClient::recv_like_post(TLike& _return, const int32_t
         sentry.commit();
         throw result.e;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       // in a bad state, don't commit
       throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "like_post failed: unknown result");
     }
@@ -2687,6 +3282,10 @@ void TLikeServiceConcurrentClient::recv_retrieve_standard_like(TLike& _return, c
         sentry.commit();
         throw result.e;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       // in a bad state, don't commit
       throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "retrieve_standard_like failed: unknown result");
     }
@@ -2784,6 +3383,10 @@ void TLikeServiceConcurrentClient::recv_retrieve_expanded_like(TLike& _return, c
         sentry.commit();
         throw result.e3;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       // in a bad state, don't commit
       throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "retrieve_expanded_like failed: unknown result");
     }
@@ -2871,6 +3474,10 @@ void TLikeServiceConcurrentClient::recv_delete_like(const int32_t seqid)
         sentry.commit();
         throw result.e2;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       sentry.commit();
       return;
     }
@@ -2966,6 +3573,10 @@ void TLikeServiceConcurrentClient::recv_list_likes(std::vector<TLike> & _return,
         sentry.commit();
         throw result.e2;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       // in a bad state, don't commit
       throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "list_likes failed: unknown result");
     }
@@ -3051,6 +3662,10 @@ int32_t TLikeServiceConcurrentClient::recv_count_likes_by_account(const int32_t
         sentry.commit();
         return _return;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       // in a bad state, don't commit
       throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "count_likes_by_account failed: unknown result");
     }
@@ -3136,6 +3751,10 @@ int32_t TLikeServiceConcurrentClient::recv_count_likes_of_post(const int32_t seq
         sentry.commit();
         return _return;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       // in a bad state, don't commit
       throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "count_likes_of_post failed: unknown result");
     }
@@ -3147,5 +3766,94 @@ int32_t TLikeServiceConcurrentClient::recv_count_likes_of_post(const int32_t seq
   } // end while(true)
 }
 
+void TLikeServiceConcurrentClient::count_likes_of_posts(std::map<int32_t, int32_t> & _return, const TRequestMetadata& request_metadata, const std::vector<int32_t> & post_ids)
+{
+  int32_t seqid = send_count_likes_of_posts(request_metadata, post_ids);
+  recv_count_likes_of_posts(_return, seqid);
+}
+
+int32_t TLikeServiceConcurrentClient::send_count_likes_of_posts(const TRequestMetadata& request_metadata, const std::vector<int32_t> & post_ids)
+{
+  int32_t cseqid = this->sync_->generateSeqId();
+  ::apache::thrift::async::TConcurrentSendSentry sentry(this->sync_.get());
+  oprot_->writeMessageBegin("count_likes_of_posts", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  TLikeService_count_likes_of_posts_pargs args;
+  args.request_metadata = &request_metadata;
+  args.post_ids = &post_ids;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+
+  sentry.commit();
+  return cseqid;
+}
+
+void TLikeServiceConcurrentClient::recv_count_likes_of_posts(std::map<int32_t, int32_t> & _return, const int32_t seqid)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  // the read mutex gets dropped and reacquired as part of waitForWork()
+  // The destructor of this sentry wakes up other clients
+  ::apache::thrift::async::TConcurrentRecvSentry sentry(this->sync_.get(), seqid);
+
+  while(true) {
+    if(!this->sync_->getPending(fname, mtype, rseqid)) {
+      iprot_->readMessageBegin(fname, mtype, rseqid);
+    }
+    if(seqid == rseqid) {
+      if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+        ::apache::thrift::TApplicationException x;
+        x.read(iprot_);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+        sentry.commit();
+        throw x;
+      }
+      if (mtype != ::apache::thrift::protocol::T_REPLY) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+      }
+      if (fname.compare("count_likes_of_posts") != 0) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+
+        // in a bad state, don't commit
+        using ::apache::thrift::protocol::TProtocolException;
+        throw TProtocolException(TProtocolException::INVALID_DATA);
+      }
+      TLikeService_count_likes_of_posts_presult result;
+      result.success = &_return;
+      result.read(iprot_);
+      iprot_->readMessageEnd();
+      iprot_->getTransport()->readEnd();
+
+      if (result.__isset.success) {
+        // _return pointer has now been filled
+        sentry.commit();
+        return;
+      }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
+      // in a bad state, don't commit
+      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "count_likes_of_posts failed: unknown result");
+    }
+    // seqid != rseqid
+    this->sync_->updatePending(fname, mtype, rseqid);
+
+    // this will temporarily unlock the readMutex, and let other clients get work done
+    this->sync_->waitForWork(seqid);
+  } // end while(true)
+}
+
 } // namespace
 
@@ -145,6 +145,14 @@ uint32_t TPostService_create_post_result::read(::apache::thrift::protocol::TProt
           xfer += iprot->skip(ftype);
         }
         break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -171,6 +179,10 @@ uint32_t TPostService_create_post_result::write(::apache::thrift::protocol::TPro
     xfer += oprot->writeFieldBegin("e", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->e.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 2);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -219,6 +231,14 @@ uint32_t TPostService_create_post_presult::read(::apache::thrift::protocol::TPro
           xfer += iprot->skip(ftype);
         }
         break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -368,6 +388,14 @@ uint32_t TPostService_retrieve_standard_post_result::read(::apache::thrift::prot
           xfer += iprot->skip(ftype);
         }
         break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -394,6 +422,10 @@ uint32_t TPostService_retrieve_standard_post_result::write(::apache::thrift::pro
     xfer += oprot->writeFieldBegin("e", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->e.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 2);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -442,6 +474,14 @@ uint32_t TPostService_retrieve_standard_post_presult::read(::apache::thrift::pro
           xfer += iprot->skip(ftype);
         }
         break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -599,6 +639,14 @@ uint32_t TPostService_retrieve_expanded_post_result::read(::apache::thrift::prot
           xfer += iprot->skip(ftype);
         }
         break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -629,6 +677,10 @@ uint32_t TPostService_retrieve_expanded_post_result::write(::apache::thrift::pro
     xfer += oprot->writeFieldBegin("e2", ::apache::thrift::protocol::T_STRUCT, 2);
     xfer += this->e2.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 3);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -685,6 +737,324 @@ uint32_t TPostService_retrieve_expanded_post_presult::read(::apache::thrift::pro
           xfer += iprot->skip(ftype);
         }
         break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+
+TPostService_retrieve_expanded_posts_args::~TPostService_retrieve_expanded_posts_args() noexcept {
+}
+
+
+uint32_t TPostService_retrieve_expanded_posts_args::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->request_metadata.read(iprot);
+          this->__isset.request_metadata = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->post_ids.clear();
+            uint32_t _size124;
+            ::apache::thrift::protocol::TType _etype127;
+            xfer += iprot->readListBegin(_etype127, _size124);
+            this->post_ids.resize(_size124);
+            uint32_t _i128;
+            for (_i128 = 0; _i128 < _size124; ++_i128)
+            {
+              xfer += iprot->readI32(this->post_ids[_i128]);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.post_ids = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t TPostService_retrieve_expanded_posts_args::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("TPostService_retrieve_expanded_posts_args");
+
+  xfer += oprot->writeFieldBegin("request_metadata", ::apache::thrift::protocol::T_STRUCT, 1);
+  xfer += this->request_metadata.write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("post_ids", ::apache::thrift::protocol::T_LIST, 2);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I32, static_cast<uint32_t>(this->post_ids.size()));
+    std::vector<int32_t> ::const_iterator _iter129;
+    for (_iter129 = this->post_ids.begin(); _iter129 != this->post_ids.end(); ++_iter129)
+    {
+      xfer += oprot->writeI32((*_iter129));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+TPostService_retrieve_expanded_posts_pargs::~TPostService_retrieve_expanded_posts_pargs() noexcept {
+}
+
+
+uint32_t TPostService_retrieve_expanded_posts_pargs::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("TPostService_retrieve_expanded_posts_pargs");
+
+  xfer += oprot->writeFieldBegin("request_metadata", ::apache::thrift::protocol::T_STRUCT, 1);
+  xfer += (*(this->request_metadata)).write(oprot);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("post_ids", ::apache::thrift::protocol::T_LIST, 2);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_I32, static_cast<uint32_t>((*(this->post_ids)).size()));
+    std::vector<int32_t> ::const_iterator _iter130;
+    for (_iter130 = (*(this->post_ids)).begin(); _iter130 != (*(this->post_ids)).end(); ++_iter130)
+    {
+      xfer += oprot->writeI32((*_iter130));
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+TPostService_retrieve_expanded_posts_result::~TPostService_retrieve_expanded_posts_result() noexcept {
+}
+
+
+uint32_t TPostService_retrieve_expanded_posts_result::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_MAP) {
+          {
+            this->success.clear();
+            uint32_t _size131;
+            ::apache::thrift::protocol::TType _ktype132;
+            ::apache::thrift::protocol::TType _vtype133;
+            xfer += iprot->readMapBegin(_ktype132, _vtype133, _size131);
+            uint32_t _i135;
+            for (_i135 = 0; _i135 < _size131; ++_i135)
+            {
+              int32_t _key136;
+              xfer += iprot->readI32(_key136);
+              TPost& _val137 = this->success[_key136];
+              xfer += _val137.read(iprot);
+            }
+            xfer += iprot->readMapEnd();
+          }
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->e.read(iprot);
+          this->__isset.e = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t TPostService_retrieve_expanded_posts_result::write(::apache::thrift::protocol::TProtocol* oprot) const {
+
+  uint32_t xfer = 0;
+
+  xfer += oprot->writeStructBegin("TPostService_retrieve_expanded_posts_result");
+
+  if (this->__isset.success) {
+    xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_MAP, 0);
+    {
+      xfer += oprot->writeMapBegin(::apache::thrift::protocol::T_I32, ::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->success.size()));
+      std::map<int32_t, TPost> ::const_iterator _iter138;
+      for (_iter138 = this->success.begin(); _iter138 != this->success.end(); ++_iter138)
+      {
+        xfer += oprot->writeI32(_iter138->first);
+        xfer += _iter138->second.write(oprot);
+      }
+      xfer += oprot->writeMapEnd();
+    }
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.e) {
+    xfer += oprot->writeFieldBegin("e", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->e.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 2);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
+  }
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+
+TPostService_retrieve_expanded_posts_presult::~TPostService_retrieve_expanded_posts_presult() noexcept {
+}
+
+
+uint32_t TPostService_retrieve_expanded_posts_presult::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 0:
+        if (ftype == ::apache::thrift::protocol::T_MAP) {
+          {
+            (*(this->success)).clear();
+            uint32_t _size139;
+            ::apache::thrift::protocol::TType _ktype140;
+            ::apache::thrift::protocol::TType _vtype141;
+            xfer += iprot->readMapBegin(_ktype140, _vtype141, _size139);
+            uint32_t _i143;
+            for (_i143 = 0; _i143 < _size139; ++_i143)
+            {
+              int32_t _key144;
+              xfer += iprot->readI32(_key144);
+              TPost& _val145 = (*(this->success))[_key144];
+              xfer += _val145.read(iprot);
+            }
+            xfer += iprot->readMapEnd();
+          }
+          this->__isset.success = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->e.read(iprot);
+          this->__isset.e = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -834,6 +1204,14 @@ uint32_t TPostService_delete_post_result::read(::apache::thrift::protocol::TProt
           xfer += iprot->skip(ftype);
         }
         break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -860,6 +1238,10 @@ uint32_t TPostService_delete_post_result::write(::apache::thrift::protocol::TPro
     xfer += oprot->writeFieldBegin("e2", ::apache::thrift::protocol::T_STRUCT, 2);
     xfer += this->e2.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 3);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -908,6 +1290,14 @@ uint32_t TPostService_delete_post_presult::read(::apache::thrift::protocol::TPro
           xfer += iprot->skip(ftype);
         }
         break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1077,14 +1467,14 @@ uint32_t TPostService_list_posts_result::read(::apache::thrift::protocol::TProto
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->success.clear();
-            uint32_t _size76;
-            ::apache::thrift::protocol::TType _etype79;
-            xfer += iprot->readListBegin(_etype79, _size76);
-            this->success.resize(_size76);
-            uint32_t _i80;
-            for (_i80 = 0; _i80 < _size76; ++_i80)
+            uint32_t _size146;
+            ::apache::thrift::protocol::TType _etype149;
+            xfer += iprot->readListBegin(_etype149, _size146);
+            this->success.resize(_size146);
+            uint32_t _i150;
+            for (_i150 = 0; _i150 < _size146; ++_i150)
             {
-              xfer += this->success[_i80].read(iprot);
+              xfer += this->success[_i150].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -1101,6 +1491,14 @@ uint32_t TPostService_list_posts_result::read(::apache::thrift::protocol::TProto
           xfer += iprot->skip(ftype);
         }
         break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1123,10 +1521,10 @@ uint32_t TPostService_list_posts_result::write(::apache::thrift::protocol::TProt
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_LIST, 0);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->success.size()));
-      std::vector<TPost> ::const_iterator _iter81;
-      for (_iter81 = this->success.begin(); _iter81 != this->success.end(); ++_iter81)
+      std::vector<TPost> ::const_iterator _iter151;
+      for (_iter151 = this->success.begin(); _iter151 != this->success.end(); ++_iter151)
       {
-        xfer += (*_iter81).write(oprot);
+        xfer += (*_iter151).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -1135,6 +1533,10 @@ uint32_t TPostService_list_posts_result::write(::apache::thrift::protocol::TProt
     xfer += oprot->writeFieldBegin("e", ::apache::thrift::protocol::T_STRUCT, 1);
     xfer += this->e.write(oprot);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 2);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -1171,14 +1573,14 @@ uint32_t TPostService_list_posts_presult::read(::apache::thrift::protocol::TProt
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             (*(this->success)).clear();
-            uint32_t _size82;
-            ::apache::thrift::protocol::TType _etype85;
-            xfer += iprot->readListBegin(_etype85, _size82);
-            (*(this->success)).resize(_size82);
-            uint32_t _i86;
-            for (_i86 = 0; _i86 < _size82; ++_i86)
+            uint32_t _size152;
+            ::apache::thrift::protocol::TType _etype155;
+            xfer += iprot->readListBegin(_etype155, _size152);
+            (*(this->success)).resize(_size152);
+            uint32_t _i156;
+            for (_i156 = 0; _i156 < _size152; ++_i156)
             {
-              xfer += (*(this->success))[_i86].read(iprot);
+              xfer += (*(this->success))[_i156].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -1195,6 +1597,14 @@ uint32_t TPostService_list_posts_presult::read(::apache::thrift::protocol::TProt
           xfer += iprot->skip(ftype);
         }
         break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1336,6 +1746,14 @@ uint32_t TPostService_count_posts_by_author_result::read(::apache::thrift::proto
           xfer += iprot->skip(ftype);
         }
         break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1358,6 +1776,10 @@ uint32_t TPostService_count_posts_by_author_result::write(::apache::thrift::prot
     xfer += oprot->writeFieldBegin("success", ::apache::thrift::protocol::T_I32, 0);
     xfer += oprot->writeI32(this->success);
     xfer += oprot->writeFieldEnd();
+  } else if (this->__isset.overloaded) {
+    xfer += oprot->writeFieldBegin("overloaded", ::apache::thrift::protocol::T_STRUCT, 1);
+    xfer += this->overloaded.write(oprot);
+    xfer += oprot->writeFieldEnd();
   }
   xfer += oprot->writeFieldStop();
   xfer += oprot->writeStructEnd();
@@ -1398,6 +1820,14 @@ uint32_t TPostService_count_posts_by_author_presult::read(::apache::thrift::prot
           xfer += iprot->skip(ftype);
         }
         break;
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRUCT) {
+          xfer += this->overloaded.read(iprot);
+          this->__isset.overloaded = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
       default:
         xfer += iprot->skip(ftype);
         break;
@@ -1469,6 +1899,9 @@ void TPostServiceClient::recv_create_post(TPost& _return)
   if (result.__isset.e) {
     throw result.e;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "create_post failed: unknown result");
 }
 
@@ -1531,6 +1964,9 @@ void TPostServiceClient::recv_retrieve_standard_post(TPost& _return)
   if (result.__isset.e) {
     throw result.e;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "retrieve_standard_post failed: unknown result");
 }
 
@@ -1596,9 +2032,77 @@ void TPostServiceClient::recv_retrieve_expanded_post(TPost& _return)
   if (result.__isset.e2) {
     throw result.e2;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "retrieve_expanded_post failed: unknown result");
 }
 
+void TPostServiceClient::retrieve_expanded_posts(std::map<int32_t, TPost> & _return, const TRequestMetadata& request_metadata, const std::vector<int32_t> & post_ids)
+{
+  send_retrieve_expanded_posts(request_metadata, post_ids);
+  recv_retrieve_expanded_posts(_return);
+}
+
+void TPostServiceClient::send_retrieve_expanded_posts(const TRequestMetadata& request_metadata, const std::vector<int32_t> & post_ids)
+{
+  int32_t cseqid = 0;
+  oprot_->writeMessageBegin("retrieve_expanded_posts", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  TPostService_retrieve_expanded_posts_pargs args;
+  args.request_metadata = &request_metadata;
+  args.post_ids = &post_ids;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+}
+
+void TPostServiceClient::recv_retrieve_expanded_posts(std::map<int32_t, TPost> & _return)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  iprot_->readMessageBegin(fname, mtype, rseqid);
+  if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+    ::apache::thrift::TApplicationException x;
+    x.read(iprot_);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+    throw x;
+  }
+  if (mtype != ::apache::thrift::protocol::T_REPLY) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  if (fname.compare("retrieve_expanded_posts") != 0) {
+    iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+    iprot_->readMessageEnd();
+    iprot_->getTransport()->readEnd();
+  }
+  TPostService_retrieve_expanded_posts_presult result;
+  result.success = &_return;
+  result.read(iprot_);
+  iprot_->readMessageEnd();
+  iprot_->getTransport()->readEnd();
+
+  if (result.__isset.success) {
+    // _return pointer has now been filled
+    return;
+  }
+  if (result.__isset.e) {
+    throw result.e;
+  }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
+  throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "retrieve_expanded_posts failed: unknown result");
+}
+
 void TPostServiceClient::delete_post(const TRequestMetadata& request_metadata, const int32_t post_id)
 {
   send_delete_post(request_metadata, post_id);
@@ -1656,6 +2160,9 @@ void TPostServiceClient::recv_delete_post()
   if (result.__isset.e2) {
     throw result.e2;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   return;
 }
 
@@ -1720,6 +2227,9 @@ void TPostServiceClient::recv_list_posts(std::vector<TPost> & _return)
   if (result.__isset.e) {
     throw result.e;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "list_posts failed: unknown result");
 }
 
@@ -1779,6 +2289,9 @@ int32_t TPostServiceClient::recv_count_posts_by_author()
   if (result.__isset.success) {
     return _return;
   }
+  if (result.__isset.overloaded) {
+    throw result.overloaded;
+  }
   throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "count_posts_by_author failed: unknown result");
 }
 
@@ -1829,6 +2342,9 @@ void TPostServiceProcessor::process_create_post(int32_t seqid, ::apache::thrift:
   } catch (TPostInvalidAttributesException &e) {
     result.e = e;
     result.__isset.e = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TPostService.create_post");
@@ -1886,6 +2402,9 @@ void TPostServiceProcessor::process_retrieve_standard_post(int32_t seqid, ::apac
   } catch (TPostNotFoundException &e) {
     result.e = e;
     result.__isset.e = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TPostService.retrieve_standard_post");
@@ -1946,6 +2465,9 @@ void TPostServiceProcessor::process_retrieve_expanded_post(int32_t seqid, ::apac
   } catch (TAccountNotFoundException &e2) {
     result.e2 = e2;
     result.__isset.e2 = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TPostService.retrieve_expanded_post");
@@ -1975,6 +2497,66 @@ void TPostServiceProcessor::process_retrieve_expanded_post(int32_t seqid, ::apac
   }
 }
 
+void TPostServiceProcessor::process_retrieve_expanded_posts(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
+{
+  void* ctx = NULL;
+  if (this->eventHandler_.get() != NULL) {
+    ctx = this->eventHandler_->getContext("TPostService.retrieve_expanded_posts", callContext);
+  }
+  ::apache::thrift::TProcessorContextFreer freer(this->eventHandler_.get(), ctx, "TPostService.retrieve_expanded_posts");
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preRead(ctx, "TPostService.retrieve_expanded_posts");
+  }
+
+  TPostService_retrieve_expanded_posts_args args;
+  args.read(iprot);
+  iprot->readMessageEnd();
+  uint32_t bytes = iprot->getTransport()->readEnd();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postRead(ctx, "TPostService.retrieve_expanded_posts", bytes);
+  }
+
+  TPostService_retrieve_expanded_posts_result result;
+  try {
+    iface_->retrieve_expanded_posts(result.success, args.request_metadata, args.post_ids);
+    result.__isset.success = true;
+  } catch (TAccountNotFoundException &e) {
+    result.e = e;
+    result.__isset.e = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
+  } catch (const std::exception& e) {
+    if (this->eventHandler_.get() != NULL) {
+      this->eventHandler_->handlerError(ctx, "TPostService.retrieve_expanded_posts");
+    }
+
+    ::apache::thrift::TApplicationException x(e.what());
+    oprot->writeMessageBegin("retrieve_expanded_posts", ::apache::thrift::protocol::T_EXCEPTION, seqid);
+    x.write(oprot);
+    oprot->writeMessageEnd();
+    oprot->getTransport()->writeEnd();
+    oprot->getTransport()->flush();
+    return;
+  }
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->preWrite(ctx, "TPostService.retrieve_expanded_posts");
+  }
+
+  oprot->writeMessageBegin("retrieve_expanded_posts", ::apache::thrift::protocol::T_REPLY, seqid);
+  result.write(oprot);
+  oprot->writeMessageEnd();
+  bytes = oprot->getTransport()->writeEnd();
+  oprot->getTransport()->flush();
+
+  if (this->eventHandler_.get() != NULL) {
+    this->eventHandler_->postWrite(ctx, "TPostService.retrieve_expanded_posts", bytes);
+  }
+}
+
 void TPostServiceProcessor::process_delete_post(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext)
 {
   void* ctx = NULL;
@@ -2005,6 +2587,9 @@ void TPostServiceProcessor::process_delete_post(int32_t seqid, ::apache::thrift:
   } catch (TPostNotAuthorizedException &e2) {
     result.e2 = e2;
     result.__isset.e2 = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TPostService.delete_post");
@@ -2062,6 +2647,9 @@ void TPostServiceProcessor::process_list_posts(int32_t seqid, ::apache::thrift::
   } catch (TAccountNotFoundException &e) {
     result.e = e;
     result.__isset.e = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TPostService.list_posts");
@@ -2116,6 +2704,9 @@ void TPostServiceProcessor::process_count_posts_by_author(int32_t seqid, ::apach
   try {
     result.success = iface_->count_posts_by_author(args.request_metadata, args.author_id);
     result.__isset.success = true;
+  } catch (TServerOverloadedException &overloaded) {
+    result.overloaded = overloaded;
+    result.__isset.overloaded = true;
   } catch (const std::exception& e) {
     if (this->eventHandler_.get() != NULL) {
       this->eventHandler_->handlerError(ctx, "TPostService.count_posts_by_author");
@@ -2230,6 +2821,10 @@ void TPostServiceConcurrentClient::recv_create_post(TPost& _return, const int32_
         sentry.commit();
         throw result.e;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       // in a bad state, don't commit
       throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "create_post failed: unknown result");
     }
@@ -2319,6 +2914,10 @@ void TPostServiceConcurrentClient::recv_retrieve_standard_post(TPost& _return, c
         sentry.commit();
         throw result.e;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       // in a bad state, don't commit
       throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "retrieve_standard_post failed: unknown result");
     }
@@ -2412,6 +3011,10 @@ void TPostServiceConcurrentClient::recv_retrieve_expanded_post(TPost& _return, c
         sentry.commit();
         throw result.e2;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       // in a bad state, don't commit
       throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "retrieve_expanded_post failed: unknown result");
     }
@@ -2423,6 +3026,99 @@ void TPostServiceConcurrentClient::recv_retrieve_expanded_post(TPost& _return, c
   } // end while(true)
 }
 
+void TPostServiceConcurrentClient::retrieve_expanded_posts(std::map<int32_t, TPost> & _return, const TRequestMetadata& request_metadata, const std::vector<int32_t> & post_ids)
+{
+  int32_t seqid = send_retrieve_expanded_posts(request_metadata, post_ids);
+  recv_retrieve_expanded_posts(_return, seqid);
+}
+
+int32_t TPostServiceConcurrentClient::send_retrieve_expanded_posts(const TRequestMetadata& request_metadata, const std::vector<int32_t> & post_ids)
+{
+  int32_t cseqid = this->sync_->generateSeqId();
+  ::apache::thrift::async::TConcurrentSendSentry sentry(this->sync_.get());
+  oprot_->writeMessageBegin("retrieve_expanded_posts", ::apache::thrift::protocol::T_CALL, cseqid);
+
+  TPostService_retrieve_expanded_posts_pargs args;
+  args.request_metadata = &request_metadata;
+  args.post_ids = &post_ids;
+  args.write(oprot_);
+
+  oprot_->writeMessageEnd();
+  oprot_->getTransport()->writeEnd();
+  oprot_->getTransport()->flush();
+
+  sentry.commit();
+  return cseqid;
+}
+
+void TPostServiceConcurrentClient::recv_retrieve_expanded_posts(std::map<int32_t, TPost> & _return, const int32_t seqid)
+{
+
+  int32_t rseqid = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TMessageType mtype;
+
+  // the read mutex gets dropped and reacquired as part of waitForWork()
+  // The destructor of this sentry wakes up other clients
+  ::apache::thrift::async::TConcurrentRecvSentry sentry(this->sync_.get(), seqid);
+
+  while(true) {
+    if(!this->sync_->getPending(fname, mtype, rseqid)) {
+      iprot_->readMessageBegin(fname, mtype, rseqid);
+    }
+    if(seqid == rseqid) {
+      if (mtype == ::apache::thrift::protocol::T_EXCEPTION) {
+        ::apache::thrift::TApplicationException x;
+        x.read(iprot_);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+        sentry.commit();
+        throw x;
+      }
+      if (mtype != ::apache::thrift::protocol::T_REPLY) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+      }
+      if (fname.compare("retrieve_expanded_posts") != 0) {
+        iprot_->skip(::apache::thrift::protocol::T_STRUCT);
+        iprot_->readMessageEnd();
+        iprot_->getTransport()->readEnd();
+
+        // in a bad state, don't commit
+        using ::apache::thrift::protocol::TProtocolException;
+        throw TProtocolException(TProtocolException::INVALID_DATA);
+      }
+      TPostService_retrieve_expanded_posts_presult result;
+      result.success = &_return;
+      result.read(iprot_);
+      iprot_->readMessageEnd();
+      iprot_->getTransport()->readEnd();
+
+      if (result.__isset.success) {
+        // _return pointer has now been filled
+        sentry.commit();
+        return;
+      }
+      if (result.__isset.e) {
+        sentry.commit();
+        throw result.e;
+      }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
+      // in a bad state, don't commit
+      throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "retrieve_expanded_posts failed: unknown result");
+    }
+    // seqid != rseqid
+    this->sync_->updatePending(fname, mtype, rseqid);
+
+    // this will temporarily unlock the readMutex, and let other clients get work done
+    this->sync_->waitForWork(seqid);
+  } // end while(true)
+}
+
 void TPostServiceConcurrentClient::delete_post(const TRequestMetadata& request_metadata, const int32_t post_id)
 {
   int32_t seqid = send_delete_post(request_metadata, post_id);
@@ -2499,6 +3195,10 @@ void TPostServiceConcurrentClient::recv_delete_post(const int32_t seqid)
         sentry.commit();
         throw result.e2;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       sentry.commit();
       return;
     }
@@ -2590,6 +3290,10 @@ void TPostServiceConcurrentClient::recv_list_posts(std::vector<TPost> & _return,
         sentry.commit();
         throw result.e;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       // in a bad state, don't commit
       throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "list_posts failed: unknown result");
     }
@@ -2675,6 +3379,10 @@ int32_t TPostServiceConcurrentClient::recv_count_posts_by_author(const int32_t s
         sentry.commit();
         return _return;
       }
+      if (result.__isset.overloaded) {
+        sentry.commit();
+        throw result.overloaded;
+      }
       // in a bad state, don't commit
       throw ::apache::thrift::TApplicationException(::apache::thrift::TApplicationException::MISSING_RESULT, "count_posts_by_author failed: unknown result");
     }
@@ -28,6 +28,7 @@ class TUniquepairServiceIf {
   virtual void find(TUniquepair& _return, const TRequestMetadata& request_metadata, const std::string& domain, const int32_t first_elem, const int32_t second_elem) = 0;
   virtual void fetch(std::vector<TUniquepair> & _return, const TRequestMetadata& request_metadata, const TUniquepairQuery& query, const int32_t limit, const int32_t offset) = 0;
   virtual int32_t count(const TRequestMetadata& request_metadata, const TUniquepairQuery& query) = 0;
+  virtual void count_grouped(std::map<int32_t, int32_t> & _return, const TRequestMetadata& request_metadata, const std::string& domain, const std::vector<int32_t> & second_elems) = 0;
 };
 
 class TUniquepairServiceIfFactory {
@@ -76,6 +77,9 @@ class TUniquepairServiceNull : virtual public TUniquepairServiceIf {
     int32_t _return = 0;
     return _return;
   }
+  void count_grouped(std::map<int32_t, int32_t> & /* _return */, const TRequestMetadata& /* request_metadata */, const std::string& /* domain */, const std::vector<int32_t> & /* second_elems */) {
+    return;
+  }
 };
 
 typedef struct _TUniquepairService_get_args__isset {
@@ -135,9 +139,10 @@ class TUniquepairService_get_pargs {
 };
 
 typedef struct _TUniquepairService_get_result__isset {
-  _TUniquepairService_get_result__isset() : success(false), e(false) {}
+  _TUniquepairService_get_result__isset() : success(false), e(false), overloaded(false) {}
   bool success :1;
   bool e :1;
+  bool overloaded :1;
 } _TUniquepairService_get_result__isset;
 
 class TUniquepairService_get_result {
@@ -151,6 +156,7 @@ class TUniquepairService_get_result {
   virtual ~TUniquepairService_get_result() noexcept;
   TUniquepair success;
   TUniquepairNotFoundException e;
+  TServerOverloadedException overloaded;
 
   _TUniquepairService_get_result__isset __isset;
 
@@ -158,12 +164,16 @@ class TUniquepairService_get_result {
 
   void __set_e(const TUniquepairNotFoundException& val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TUniquepairService_get_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
     if (!(e == rhs.e))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TUniquepairService_get_result &rhs) const {
@@ -178,9 +188,10 @@ class TUniquepairService_get_result {
 };
 
 typedef struct _TUniquepairService_get_presult__isset {
-  _TUniquepairService_get_presult__isset() : success(false), e(false) {}
+  _TUniquepairService_get_presult__isset() : success(false), e(false), overloaded(false) {}
   bool success :1;
   bool e :1;
+  bool overloaded :1;
 } _TUniquepairService_get_presult__isset;
 
 class TUniquepairService_get_presult {
@@ -190,6 +201,7 @@ class TUniquepairService_get_presult {
   virtual ~TUniquepairService_get_presult() noexcept;
   TUniquepair* success;
   TUniquepairNotFoundException e;
+  TServerOverloadedException overloaded;
 
   _TUniquepairService_get_presult__isset __isset;
 
@@ -268,9 +280,10 @@ class TUniquepairService_add_pargs {
 };
 
 typedef struct _TUniquepairService_add_result__isset {
-  _TUniquepairService_add_result__isset() : success(false), e(false) {}
+  _TUniquepairService_add_result__isset() : success(false), e(false), overloaded(false) {}
   bool success :1;
   bool e :1;
+  bool overloaded :1;
 } _TUniquepairService_add_result__isset;
 
 class TUniquepairService_add_result {
@@ -284,6 +297,7 @@ class TUniquepairService_add_result {
   virtual ~TUniquepairService_add_result() noexcept;
   TUniquepair success;
   TUniquepairAlreadyExistsException e;
+  TServerOverloadedException overloaded;
 
   _TUniquepairService_add_result__isset __isset;
 
@@ -291,12 +305,16 @@ class TUniquepairService_add_result {
 
   void __set_e(const TUniquepairAlreadyExistsException& val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TUniquepairService_add_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
     if (!(e == rhs.e))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TUniquepairService_add_result &rhs) const {
@@ -311,9 +329,10 @@ class TUniquepairService_add_result {
 };
 
 typedef struct _TUniquepairService_add_presult__isset {
-  _TUniquepairService_add_presult__isset() : success(false), e(false) {}
+  _TUniquepairService_add_presult__isset() : success(false), e(false), overloaded(false) {}
   bool success :1;
   bool e :1;
+  bool overloaded :1;
 } _TUniquepairService_add_presult__isset;
 
 class TUniquepairService_add_presult {
@@ -323,6 +342,7 @@ class TUniquepairService_add_presult {
   virtual ~TUniquepairService_add_presult() noexcept;
   TUniquepair* success;
   TUniquepairAlreadyExistsException e;
+  TServerOverloadedException overloaded;
 
   _TUniquepairService_add_presult__isset __isset;
 
@@ -387,8 +407,9 @@ class TUniquepairService_remove_pargs {
 };
 
 typedef struct _TUniquepairService_remove_result__isset {
-  _TUniquepairService_remove_result__isset() : e(false) {}
+  _TUniquepairService_remove_result__isset() : e(false), overloaded(false) {}
   bool e :1;
+  bool overloaded :1;
 } _TUniquepairService_remove_result__isset;
 
 class TUniquepairService_remove_result {
@@ -401,15 +422,20 @@ class TUniquepairService_remove_result {
 
   virtual ~TUniquepairService_remove_result() noexcept;
   TUniquepairNotFoundException e;
+  TServerOverloadedException overloaded;
 
   _TUniquepairService_remove_result__isset __isset;
 
   void __set_e(const TUniquepairNotFoundException& val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TUniquepairService_remove_result & rhs) const
   {
     if (!(e == rhs.e))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TUniquepairService_remove_result &rhs) const {
@@ -424,8 +450,9 @@ class TUniquepairService_remove_result {
 };
 
 typedef struct _TUniquepairService_remove_presult__isset {
-  _TUniquepairService_remove_presult__isset() : e(false) {}
+  _TUniquepairService_remove_presult__isset() : e(false), overloaded(false) {}
   bool e :1;
+  bool overloaded :1;
 } _TUniquepairService_remove_presult__isset;
 
 class TUniquepairService_remove_presult {
@@ -434,6 +461,7 @@ class TUniquepairService_remove_presult {
 
   virtual ~TUniquepairService_remove_presult() noexcept;
   TUniquepairNotFoundException e;
+  TServerOverloadedException overloaded;
 
   _TUniquepairService_remove_presult__isset __isset;
 
@@ -512,9 +540,10 @@ class TUniquepairService_find_pargs {
 };
 
 typedef struct _TUniquepairService_find_result__isset {
-  _TUniquepairService_find_result__isset() : success(false), e(false) {}
+  _TUniquepairService_find_result__isset() : success(false), e(false), overloaded(false) {}
   bool success :1;
   bool e :1;
+  bool overloaded :1;
 } _TUniquepairService_find_result__isset;
 
 class TUniquepairService_find_result {
@@ -528,6 +557,7 @@ class TUniquepairService_find_result {
   virtual ~TUniquepairService_find_result() noexcept;
   TUniquepair success;
   TUniquepairNotFoundException e;
+  TServerOverloadedException overloaded;
 
   _TUniquepairService_find_result__isset __isset;
 
@@ -535,12 +565,16 @@ class TUniquepairService_find_result {
 
   void __set_e(const TUniquepairNotFoundException& val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TUniquepairService_find_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
     if (!(e == rhs.e))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TUniquepairService_find_result &rhs) const {
@@ -555,9 +589,10 @@ class TUniquepairService_find_result {
 };
 
 typedef struct _TUniquepairService_find_presult__isset {
-  _TUniquepairService_find_presult__isset() : success(false), e(false) {}
+  _TUniquepairService_find_presult__isset() : success(false), e(false), overloaded(false) {}
   bool success :1;
   bool e :1;
+  bool overloaded :1;
 } _TUniquepairService_find_presult__isset;
 
 class TUniquepairService_find_presult {
@@ -567,6 +602,7 @@ class TUniquepairService_find_presult {
   virtual ~TUniquepairService_find_presult() noexcept;
   TUniquepair* success;
   TUniquepairNotFoundException e;
+  TServerOverloadedException overloaded;
 
   _TUniquepairService_find_presult__isset __isset;
 
@@ -645,8 +681,9 @@ class TUniquepairService_fetch_pargs {
 };
 
 typedef struct _TUniquepairService_fetch_result__isset {
-  _TUniquepairService_fetch_result__isset() : success(false) {}
+  _TUniquepairService_fetch_result__isset() : success(false), overloaded(false) {}
   bool success :1;
+  bool overloaded :1;
 } _TUniquepairService_fetch_result__isset;
 
 class TUniquepairService_fetch_result {
@@ -659,15 +696,20 @@ class TUniquepairService_fetch_result {
 
   virtual ~TUniquepairService_fetch_result() noexcept;
   std::vector<TUniquepair>  success;
+  TServerOverloadedException overloaded;
 
   _TUniquepairService_fetch_result__isset __isset;
 
   void __set_success(const std::vector<TUniquepair> & val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TUniquepairService_fetch_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TUniquepairService_fetch_result &rhs) const {
@@ -682,8 +724,9 @@ class TUniquepairService_fetch_result {
 };
 
 typedef struct _TUniquepairService_fetch_presult__isset {
-  _TUniquepairService_fetch_presult__isset() : success(false) {}
+  _TUniquepairService_fetch_presult__isset() : success(false), overloaded(false) {}
   bool success :1;
+  bool overloaded :1;
 } _TUniquepairService_fetch_presult__isset;
 
 class TUniquepairService_fetch_presult {
@@ -692,6 +735,7 @@ class TUniquepairService_fetch_presult {
 
   virtual ~TUniquepairService_fetch_presult() noexcept;
   std::vector<TUniquepair> * success;
+  TServerOverloadedException overloaded;
 
   _TUniquepairService_fetch_presult__isset __isset;
 
@@ -756,8 +800,9 @@ class TUniquepairService_count_pargs {
 };
 
 typedef struct _TUniquepairService_count_result__isset {
-  _TUniquepairService_count_result__isset() : success(false) {}
+  _TUniquepairService_count_result__isset() : success(false), overloaded(false) {}
   bool success :1;
+  bool overloaded :1;
 } _TUniquepairService_count_result__isset;
 
 class TUniquepairService_count_result {
@@ -770,15 +815,20 @@ class TUniquepairService_count_result {
 
   virtual ~TUniquepairService_count_result() noexcept;
   int32_t success;
+  TServerOverloadedException overloaded;
 
   _TUniquepairService_count_result__isset __isset;
 
   void __set_success(const int32_t val);
 
+  void __set_overloaded(const TServerOverloadedException& val);
+
   bool operator == (const TUniquepairService_count_result & rhs) const
   {
     if (!(success == rhs.success))
       return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
     return true;
   }
   bool operator != (const TUniquepairService_count_result &rhs) const {
@@ -793,8 +843,9 @@ class TUniquepairService_count_result {
 };
 
 typedef struct _TUniquepairService_count_presult__isset {
-  _TUniquepairService_count_presult__isset() : success(false) {}
+  _TUniquepairService_count_presult__isset() : success(false), overloaded(false) {}
   bool success :1;
+  bool overloaded :1;
 } _TUniquepairService_count_presult__isset;
 
 class TUniquepairService_count_presult {
@@ -803,6 +854,7 @@ class TUniquepairService_count_presult {
 
   virtual ~TUniquepairService_count_presult() noexcept;
   int32_t* success;
+  TServerOverloadedException overloaded;
 
   _TUniquepairService_count_presult__isset __isset;
 
@@ -810,6 +862,132 @@ class TUniquepairService_count_presult {
 
 };
 
+typedef struct _TUniquepairService_count_grouped_args__isset {
+  _TUniquepairService_count_grouped_args__isset() : request_metadata(false), domain(false), second_elems(false) {}
+  bool request_metadata :1;
+  bool domain :1;
+  bool second_elems :1;
+} _TUniquepairService_count_grouped_args__isset;
+
+class TUniquepairService_count_grouped_args {
+ public:
+
+  TUniquepairService_count_grouped_args(const TUniquepairService_count_grouped_args&);
+  TUniquepairService_count_grouped_args& operator=(const TUniquepairService_count_grouped_args&);
+  TUniquepairService_count_grouped_args() : domain() {
+  }
+
+  virtual ~TUniquepairService_count_grouped_args() noexcept;
+  TRequestMetadata request_metadata;
+  std::string domain;
+  std::vector<int32_t>  second_elems;
+
+  _TUniquepairService_count_grouped_args__isset __isset;
+
+  void __set_request_metadata(const TRequestMetadata& val);
+
+  void __set_domain(const std::string& val);
+
+  void __set_second_elems(const std::vector<int32_t> & val);
+
+  bool operator == (const TUniquepairService_count_grouped_args & rhs) const
+  {
+    if (!(request_metadata == rhs.request_metadata))
+      return false;
+    if (!(domain == rhs.domain))
+      return false;
+    if (!(second_elems == rhs.second_elems))
+      return false;
+    return true;
+  }
+  bool operator != (const TUniquepairService_count_grouped_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const TUniquepairService_count_grouped_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class TUniquepairService_count_grouped_pargs {
+ public:
+
+
+  virtual ~TUniquepairService_count_grouped_pargs() noexcept;
+  const TRequestMetadata* request_metadata;
+  const std::string* domain;
+  const std::vector<int32_t> * second_elems;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _TUniquepairService_count_grouped_result__isset {
+  _TUniquepairService_count_grouped_result__isset() : success(false), overloaded(false) {}
+  bool success :1;
+  bool overloaded :1;
+} _TUniquepairService_count_grouped_result__isset;
+
+class TUniquepairService_count_grouped_result {
+ public:
+
+  TUniquepairService_count_grouped_result(const TUniquepairService_count_grouped_result&);
+  TUniquepairService_count_grouped_result& operator=(const TUniquepairService_count_grouped_result&);
+  TUniquepairService_count_grouped_result() {
+  }
+
+  virtual ~TUniquepairService_count_grouped_result() noexcept;
+  std::map<int32_t, int32_t>  success;
+  TServerOverloadedException overloaded;
+
+  _TUniquepairService_count_grouped_result__isset __isset;
+
+  void __set_success(const std::map<int32_t, int32_t> & val);
+
+  void __set_overloaded(const TServerOverloadedException& val);
+
+  bool operator == (const TUniquepairService_count_grouped_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    if (!(overloaded == rhs.overloaded))
+      return false;
+    return true;
+  }
+  bool operator != (const TUniquepairService_count_grouped_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const TUniquepairService_count_grouped_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _TUniquepairService_count_grouped_presult__isset {
+  _TUniquepairService_count_grouped_presult__isset() : success(false), overloaded(false) {}
+  bool success :1;
+  bool overloaded :1;
+} _TUniquepairService_count_grouped_presult__isset;
+
+class TUniquepairService_count_grouped_presult {
+ public:
+
+
+  virtual ~TUniquepairService_count_grouped_presult() noexcept;
+  std::map<int32_t, int32_t> * success;
+  TServerOverloadedException overloaded;
+
+  _TUniquepairService_count_grouped_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
 class TUniquepairServiceClient : virtual public TUniquepairServiceIf {
  public:
   TUniquepairServiceClient(std::shared_ptr< ::apache::thrift::protocol::TProtocol> prot) {
@@ -853,6 +1031,9 @@ class TUniquepairServiceClient : virtual public TUniquepairServiceIf {
   int32_t count(const TRequestMetadata& request_metadata, const TUniquepairQuery& query);
   void send_count(const TRequestMetadata& request_metadata, const TUniquepairQuery& query);
   int32_t recv_count();
+  void count_grouped(std::map<int32_t, int32_t> & _return, const TRequestMetadata& request_metadata, const std::string& domain, const std::vector<int32_t> & second_elems);
+  void send_count_grouped(const TRequestMetadata& request_metadata, const std::string& domain, const std::vector<int32_t> & second_elems);
+  void recv_count_grouped(std::map<int32_t, int32_t> & _return);
  protected:
   std::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
   std::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
@@ -874,6 +1055,7 @@ class TUniquepairServiceProcessor : public ::apache::thrift::TDispatchProcessor
   void process_find(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_fetch(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_count(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_count_grouped(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
  public:
   TUniquepairServiceProcessor(::std::shared_ptr<TUniquepairServiceIf> iface) :
     iface_(iface) {
@@ -883,6 +1065,7 @@ class TUniquepairServiceProcessor : public ::apache::thrift::TDispatchProcessor
     processMap_["find"] = &TUniquepairServiceProcessor::process_find;
     processMap_["fetch"] = &TUniquepairServiceProcessor::process_fetch;
     processMap_["count"] = &TUniquepairServiceProcessor::process_count;
+    processMap_["count_grouped"] = &TUniquepairServiceProcessor::process_count_grouped;
   }
 
   virtual ~TUniquepairServiceProcessor() {}
@@ -969,6 +1152,16 @@ class TUniquepairServiceMultiface : virtual public TUniquepairServiceIf {
     return ifaces_[i]->count(request_metadata, query);
   }
 
+  void count_grouped(std::map<int32_t, int32_t> & _return, const TRequestMetadata& request_metadata, const std::string& domain, const std::vector<int32_t> & second_elems) {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->count_grouped(_return, request_metadata, domain, second_elems);
+    }
+    ifaces_[i]->count_grouped(_return, request_metadata, domain, second_elems);
+    return;
+  }
+
 };
 
 // The 'concurrent' client is a thread safe client that correctly handles
@@ -1019,6 +1212,9 @@ class TUniquepairServiceConcurrentClient : virtual public TUniquepairServiceIf {
   int32_t count(const TRequestMetadata& request_metadata, const TUniquepairQuery& query);
   int32_t send_count(const TRequestMetadata& request_metadata, const TUniquepairQuery& query);
   int32_t recv_count(const int32_t seqid);
+  void count_grouped(std::map<int32_t, int32_t> & _return, const TRequestMetadata& request_metadata, const std::string& domain, const std::vector<int32_t> & second_elems);
+  int32_t send_count_grouped(const TRequestMetadata& request_metadata, const std::string& domain, const std::vector<int32_t> & second_elems);
+  void recv_count_grouped(std::map<int32_t, int32_t> & _return, const int32_t seqid);
  protected:
   std::shared_ptr< ::apache::thrift::protocol::TProtocol> piprot_;
   std::shared_ptr< ::apache::thrift::protocol::TProtocol> poprot_;
@@ -50,6 +50,11 @@ class TUniquepairServiceHandler : virtual public TUniquepairServiceIf {
     printf("count\n");
   }
 
+  void count_grouped(std::map<int32_t, int32_t> & _return, const TRequestMetadata& request_metadata, const std::string& domain, const std::vector<int32_t> & second_elems) {
+    // Your implementation goes here
+    printf("count_grouped\n");
+  }
+
 };
 
 int main(int argc, char **argv) {
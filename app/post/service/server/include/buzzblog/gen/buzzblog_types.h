@@ -23,6 +23,8 @@ namespace gen {
 
 class TRequestMetadata;
 
+class TCursor;
+
 class TAccount;
 
 class TFollow;
@@ -75,9 +77,15 @@ class TUniquepairNotFoundException;
 
 class TUniquepairAlreadyExistsException;
 
+class TServerOverloadedException;
+
 typedef struct _TRequestMetadata__isset {
-  _TRequestMetadata__isset() : requester_id(false) {}
+  _TRequestMetadata__isset() : requester_id(false), span_id(false), parent_span_id(false), sampled(false), deadline_ms(false) {}
   bool requester_id :1;
+  bool span_id :1;
+  bool parent_span_id :1;
+  bool sampled :1;
+  bool deadline_ms :1;
 } _TRequestMetadata__isset;
 
 class TRequestMetadata : public virtual ::apache::thrift::TBase {
@@ -85,12 +93,16 @@ class TRequestMetadata : public virtual ::apache::thrift::TBase {
 
   TRequestMetadata(const TRequestMetadata&);
   TRequestMetadata& operator=(const TRequestMetadata&);
-  TRequestMetadata() : id(), requester_id(0) {
+  TRequestMetadata() : id(), requester_id(0), span_id(0), parent_span_id(0), sampled(0), deadline_ms(0) {
   }
 
   virtual ~TRequestMetadata() noexcept;
   std::string id;
   int32_t requester_id;
+  int64_t span_id;
+  int64_t parent_span_id;
+  bool sampled;
+  int64_t deadline_ms;
 
   _TRequestMetadata__isset __isset;
 
@@ -98,6 +110,14 @@ class TRequestMetadata : public virtual ::apache::thrift::TBase {
 
   void __set_requester_id(const int32_t val);
 
+  void __set_span_id(const int64_t val);
+
+  void __set_parent_span_id(const int64_t val);
+
+  void __set_sampled(const bool val);
+
+  void __set_deadline_ms(const int64_t val);
+
   bool operator == (const TRequestMetadata & rhs) const
   {
     if (!(id == rhs.id))
@@ -106,6 +126,22 @@ class TRequestMetadata : public virtual ::apache::thrift::TBase {
       return false;
     else if (__isset.requester_id && !(requester_id == rhs.requester_id))
       return false;
+    if (__isset.span_id != rhs.__isset.span_id)
+      return false;
+    else if (__isset.span_id && !(span_id == rhs.span_id))
+      return false;
+    if (__isset.parent_span_id != rhs.__isset.parent_span_id)
+      return false;
+    else if (__isset.parent_span_id && !(parent_span_id == rhs.parent_span_id))
+      return false;
+    if (__isset.sampled != rhs.__isset.sampled)
+      return false;
+    else if (__isset.sampled && !(sampled == rhs.sampled))
+      return false;
+    if (__isset.deadline_ms != rhs.__isset.deadline_ms)
+      return false;
+    else if (__isset.deadline_ms && !(deadline_ms == rhs.deadline_ms))
+      return false;
     return true;
   }
   bool operator != (const TRequestMetadata &rhs) const {
@@ -124,6 +160,47 @@ void swap(TRequestMetadata &a, TRequestMetadata &b);
 
 std::ostream& operator<<(std::ostream& out, const TRequestMetadata& obj);
 
+
+class TCursor : public virtual ::apache::thrift::TBase {
+ public:
+
+  TCursor(const TCursor&);
+  TCursor& operator=(const TCursor&);
+  TCursor() : created_at(0), id(0) {
+  }
+
+  virtual ~TCursor() noexcept;
+  int32_t created_at;
+  int32_t id;
+
+  void __set_created_at(const int32_t val);
+
+  void __set_id(const int32_t val);
+
+  bool operator == (const TCursor & rhs) const
+  {
+    if (!(created_at == rhs.created_at))
+      return false;
+    if (!(id == rhs.id))
+      return false;
+    return true;
+  }
+  bool operator != (const TCursor &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const TCursor & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(TCursor &a, TCursor &b);
+
+std::ostream& operator<<(std::ostream& out, const TCursor& obj);
+
 typedef struct _TAccount__isset {
   _TAccount__isset() : follows_you(false), followed_by_you(false), n_followers(false), n_following(false), n_posts(false), n_likes(false) {}
   bool follows_you :1;
@@ -311,9 +388,10 @@ void swap(TFollow &a, TFollow &b);
 std::ostream& operator<<(std::ostream& out, const TFollow& obj);
 
 typedef struct _TFollowQuery__isset {
-  _TFollowQuery__isset() : follower_id(false), followee_id(false) {}
+  _TFollowQuery__isset() : follower_id(false), followee_id(false), cursor(false) {}
   bool follower_id :1;
   bool followee_id :1;
+  bool cursor :1;
 } _TFollowQuery__isset;
 
 class TFollowQuery : public virtual ::apache::thrift::TBase {
@@ -327,6 +405,7 @@ class TFollowQuery : public virtual ::apache::thrift::TBase {
   virtual ~TFollowQuery() noexcept;
   int32_t follower_id;
   int32_t followee_id;
+  TCursor cursor;
 
   _TFollowQuery__isset __isset;
 
@@ -334,6 +413,8 @@ class TFollowQuery : public virtual ::apache::thrift::TBase {
 
   void __set_followee_id(const int32_t val);
 
+  void __set_cursor(const TCursor& val);
+
   bool operator == (const TFollowQuery & rhs) const
   {
     if (__isset.follower_id != rhs.__isset.follower_id)
@@ -344,6 +425,10 @@ class TFollowQuery : public virtual ::apache::thrift::TBase {
       return false;
     else if (__isset.followee_id && !(followee_id == rhs.followee_id))
       return false;
+    if (__isset.cursor != rhs.__isset.cursor)
+      return false;
+    else if (__isset.cursor && !(cursor == rhs.cursor))
+      return false;
     return true;
   }
   bool operator != (const TFollowQuery &rhs) const {
@@ -440,8 +525,9 @@ void swap(TPost &a, TPost &b);
 std::ostream& operator<<(std::ostream& out, const TPost& obj);
 
 typedef struct _TPostQuery__isset {
-  _TPostQuery__isset() : author_id(false) {}
+  _TPostQuery__isset() : author_id(false), cursor(false) {}
   bool author_id :1;
+  bool cursor :1;
 } _TPostQuery__isset;
 
 class TPostQuery : public virtual ::apache::thrift::TBase {
@@ -454,17 +540,24 @@ class TPostQuery : public virtual ::apache::thrift::TBase {
 
   virtual ~TPostQuery() noexcept;
   int32_t author_id;
+  TCursor cursor;
 
   _TPostQuery__isset __isset;
 
   void __set_author_id(const int32_t val);
 
+  void __set_cursor(const TCursor& val);
+
   bool operator == (const TPostQuery & rhs) const
   {
     if (__isset.author_id != rhs.__isset.author_id)
       return false;
     else if (__isset.author_id && !(author_id == rhs.author_id))
       return false;
+    if (__isset.cursor != rhs.__isset.cursor)
+      return false;
+    else if (__isset.cursor && !(cursor == rhs.cursor))
+      return false;
     return true;
   }
   bool operator != (const TPostQuery &rhs) const {
@@ -545,9 +638,10 @@ void swap(TLike &a, TLike &b);
 std::ostream& operator<<(std::ostream& out, const TLike& obj);
 
 typedef struct _TLikeQuery__isset {
-  _TLikeQuery__isset() : account_id(false), post_id(false) {}
+  _TLikeQuery__isset() : account_id(false), post_id(false), cursor(false) {}
   bool account_id :1;
   bool post_id :1;
+  bool cursor :1;
 } _TLikeQuery__isset;
 
 class TLikeQuery : public virtual ::apache::thrift::TBase {
@@ -561,6 +655,7 @@ class TLikeQuery : public virtual ::apache::thrift::TBase {
   virtual ~TLikeQuery() noexcept;
   int32_t account_id;
   int32_t post_id;
+  TCursor cursor;
 
   _TLikeQuery__isset __isset;
 
@@ -568,6 +663,8 @@ class TLikeQuery : public virtual ::apache::thrift::TBase {
 
   void __set_post_id(const int32_t val);
 
+  void __set_cursor(const TCursor& val);
+
   bool operator == (const TLikeQuery & rhs) const
   {
     if (__isset.account_id != rhs.__isset.account_id)
@@ -578,6 +675,10 @@ class TLikeQuery : public virtual ::apache::thrift::TBase {
       return false;
     else if (__isset.post_id && !(post_id == rhs.post_id))
       return false;
+    if (__isset.cursor != rhs.__isset.cursor)
+      return false;
+    else if (__isset.cursor && !(cursor == rhs.cursor))
+      return false;
     return true;
   }
   bool operator != (const TLikeQuery &rhs) const {
@@ -653,9 +754,10 @@ void swap(TUniquepair &a, TUniquepair &b);
 std::ostream& operator<<(std::ostream& out, const TUniquepair& obj);
 
 typedef struct _TUniquepairQuery__isset {
-  _TUniquepairQuery__isset() : first_elem(false), second_elem(false) {}
+  _TUniquepairQuery__isset() : first_elem(false), second_elem(false), cursor(false) {}
   bool first_elem :1;
   bool second_elem :1;
+  bool cursor :1;
 } _TUniquepairQuery__isset;
 
 class TUniquepairQuery : public virtual ::apache::thrift::TBase {
@@ -670,6 +772,7 @@ class TUniquepairQuery : public virtual ::apache::thrift::TBase {
   std::string domain;
   int32_t first_elem;
   int32_t second_elem;
+  TCursor cursor;
 
   _TUniquepairQuery__isset __isset;
 
@@ -679,6 +782,8 @@ class TUniquepairQuery : public virtual ::apache::thrift::TBase {
 
   void __set_second_elem(const int32_t val);
 
+  void __set_cursor(const TCursor& val);
+
   bool operator == (const TUniquepairQuery & rhs) const
   {
     if (!(domain == rhs.domain))
@@ -691,6 +796,10 @@ class TUniquepairQuery : public virtual ::apache::thrift::TBase {
       return false;
     else if (__isset.second_elem && !(second_elem == rhs.second_elem))
       return false;
+    if (__isset.cursor != rhs.__isset.cursor)
+      return false;
+    else if (__isset.cursor && !(cursor == rhs.cursor))
+      return false;
     return true;
   }
   bool operator != (const TUniquepairQuery &rhs) const {
@@ -1270,6 +1379,39 @@ void swap(TUniquepairAlreadyExistsException &a, TUniquepairAlreadyExistsExceptio
 
 std::ostream& operator<<(std::ostream& out, const TUniquepairAlreadyExistsException& obj);
 
+
+class TServerOverloadedException : public ::apache::thrift::TException {
+ public:
+
+  TServerOverloadedException(const TServerOverloadedException&);
+  TServerOverloadedException& operator=(const TServerOverloadedException&);
+  TServerOverloadedException() {
+  }
+
+  virtual ~TServerOverloadedException() noexcept;
+
+  bool operator == (const TServerOverloadedException & /* rhs */) const
+  {
+    return true;
+  }
+  bool operator != (const TServerOverloadedException &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const TServerOverloadedException & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+  virtual void printTo(std::ostream& out) const;
+  mutable std::string thriftTExceptionMessageHolder_;
+  const char* what() const noexcept;
+};
+
+void swap(TServerOverloadedException &a, TServerOverloadedException &b);
+
+std::ostream& operator<<(std::ostream& out, const TServerOverloadedException& obj);
+
 } // namespace
 
 #endif
@@ -0,0 +1,187 @@
+// Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
+// Systems
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+// Load of one server, as seen by the clients connected to it from this
+// process: the number of calls in flight and a moving average of their
+// latency. The average decays towards the latest samples with a time constant
+// of `decay_ms`, and jumps to any latency above it right away (as in Finagle's
+// peak EWMA), so that a server that slows down is avoided quickly. It decays
+// towards zero while no calls complete, so that an avoided server is tried
+// again later.
+class ServerLoad {
+public:
+  explicit ServerLoad(int decay_ms = 1000)
+  : _decay_ns(decay_ms * 1e6),
+    _n_in_flight(0),
+    _ewma_ns(0),
+    _last_update(std::chrono::steady_clock::now()) {
+  }
+
+  ServerLoad(const ServerLoad&) = delete;
+  ServerLoad& operator=(const ServerLoad&) = delete;
+
+  void start_call() {
+    _n_in_flight.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void end_call(std::chrono::nanoseconds latency) {
+    _n_in_flight.fetch_sub(1, std::memory_order_relaxed);
+    auto now = std::chrono::steady_clock::now();
+    double sample_ns = latency.count();
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (sample_ns > _ewma_ns) {
+      _ewma_ns = sample_ns;
+    }
+    else {
+      double w = weight(now);
+      _ewma_ns = _ewma_ns * w + sample_ns * (1 - w);
+    }
+    _last_update = now;
+  }
+
+  int n_in_flight() const {
+    return _n_in_flight.load(std::memory_order_relaxed);
+  }
+
+  // Moving average of latencies, in seconds.
+  double ewma_latency() const {
+    auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _ewma_ns * weight(now) / 1e9;
+  }
+
+  // Expected time for a new call to complete: the average latency, scaled by
+  // the calls it would queue behind.
+  double cost() const {
+    return ewma_latency() * (n_in_flight() + 1);
+  }
+
+private:
+  double weight(std::chrono::steady_clock::time_point now) const {
+    return std::exp(-std::chrono::duration<double, std::nano>(
+        now - _last_update).count() / _decay_ns);
+  }
+
+  const double _decay_ns;
+  std::atomic<int> _n_in_flight;
+  mutable std::mutex _mutex;
+  double _ewma_ns;
+  std::chrono::steady_clock::time_point _last_update;
+};
+
+// Chooses the server of each call among those of a service, by policy:
+// - "random": uniformly at random.
+// - "p2c": the one with fewer calls in flight of two chosen at random (power
+//   of two choices).
+// - "least_outstanding": the one with the fewest calls in flight.
+// - "ewma": the one with the lower cost (see `ServerLoad::cost`) of two chosen
+//   at random.
+// Ties are broken at random. Servers are given as connection pools, which
+// expose their `load()` and their `breaker()`. Servers ejected by their circuit
+// breaker are skipped, unless all of them are, in which case the policy
+// chooses among all servers.
+class LoadBalancer {
+public:
+  explicit LoadBalancer(const std::string& policy = "p2c") {
+    if (policy == "random")
+      _policy = RANDOM;
+    else if (policy == "p2c")
+      _policy = P2C;
+    else if (policy == "least_outstanding")
+      _policy = LEAST_OUTSTANDING;
+    else if (policy == "ewma")
+      _policy = EWMA;
+    else
+      throw std::invalid_argument("Invalid load-balancing policy: " + policy);
+  }
+
+  // Index of the server to send the next call to, other than `exclude` if
+  // there is another one.
+  template <typename Pool>
+  int select(const std::vector<Pool>& servers, int exclude = -1) const {
+    int n_servers = servers.size();
+    if (n_servers == 1)
+      return 0;
+    auto& candidates = candidate_buffer();
+    candidates.clear();
+    for (int i = 0; i < n_servers; i++)
+      if (i != exclude && servers[i]->breaker().available())
+        candidates.push_back(i);
+    if (candidates.empty())
+      for (int i = 0; i < n_servers; i++)
+        if (i != exclude)
+          candidates.push_back(i);
+    int n = candidates.size();
+    auto index = [&candidates](int k) { return candidates[k]; };
+    auto load = [&](int k) -> const ServerLoad& {
+      return servers[index(k)]->load();
+    };
+    if (n == 1)
+      return index(0);
+    switch (_policy) {
+      case RANDOM:
+        return index(random(n));
+      case P2C: {
+        int i, j;
+        pick_two(n, &i, &j);
+        return index(load(j).n_in_flight() < load(i).n_in_flight() ? j : i);
+      }
+      case LEAST_OUTSTANDING: {
+        // Start at a random server, so that ties are broken at random.
+        int start = random(n);
+        int best = start;
+        for (int k = 1; k < n; k++) {
+          int i = (start + k) % n;
+          if (load(i).n_in_flight() < load(best).n_in_flight())
+            best = i;
+        }
+        return index(best);
+      }
+      case EWMA: {
+        int i, j;
+        pick_two(n, &i, &j);
+        return index(load(j).cost() < load(i).cost() ? j : i);
+      }
+    }
+    return index(0);
+  }
+
+private:
+  enum Policy { RANDOM, P2C, LEAST_OUTSTANDING, EWMA };
+
+  static int random(int n) {
+    return std::uniform_int_distribution<int>(0, n - 1)(generator());
+  }
+
+  // Two distinct servers chosen at random.
+  static void pick_two(int n, int* i, int* j) {
+    *i = random(n);
+    *j = std::uniform_int_distribution<int>(0, n - 2)(generator());
+    if (*j >= *i)
+      (*j)++;
+  }
+
+  static std::vector<int>& candidate_buffer() {
+    static thread_local std::vector<int> candidates;
+    return candidates;
+  }
+
+  static std::minstd_rand& generator() {
+    static thread_local std::minstd_rand generator(std::random_device{}());
+    return generator;
+  }
+
+  Policy _policy;
+};
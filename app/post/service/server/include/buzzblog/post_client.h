@@ -1,17 +1,14 @@
 // Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
 // Systems
 
-#include <chrono>
+#include <future>
+#include <map>
 #include <memory>
 #include <string>
-
-#include <spdlog/spdlog.h>
-#include <spdlog/sinks/basic_file_sink.h>
-#include <thrift/protocol/TBinaryProtocol.h>
-#include <thrift/transport/TSocket.h>
-#include <thrift/transport/TTransportUtils.h>
+#include <vector>
 
 #include <buzzblog/gen/TPostService.h>
+#include <buzzblog/base_client.h>
 
 
 using namespace apache::thrift;
@@ -22,114 +19,131 @@ using namespace gen;
 
 
 namespace post_service {
-  class Client {
-   private:
-    std::string _ip_address;
-    int _port;
-    std::shared_ptr<TSocket> _socket;
-    std::shared_ptr<TTransport> _transport;
-    std::shared_ptr<TProtocol> _protocol;
-    std::shared_ptr<TPostServiceClient> _client;
+  class Client : public BaseClient<TPostServiceClient> {
    public:
-    Client(const std::string& ip_address, int port, int conn_timeout_ms) {
-      _ip_address = ip_address;
-      _port = port;
-      _socket = std::make_shared<TSocket>(ip_address, port);
-      _socket->setConnTimeout(conn_timeout_ms);
-      _transport = std::make_shared<TBufferedTransport>(_socket);
-      _protocol = std::make_shared<TBinaryProtocol>(_transport);
-      _client = std::make_shared<TPostServiceClient>(_protocol);
-      _transport->open();
-    }
-
-    ~Client() {
-      close();
-    }
-
-    void close() {
-      if (_transport->isOpen())
-        _transport->close();
+    Client(const std::string& ip_address, int port, int conn_timeout_ms,
+        const WireFormat& wire_format = {})
+    : BaseClient(ip_address, port, conn_timeout_ms, wire_format) {
     }
 
     TPost create_post(const TRequestMetadata& request_metadata,
         const std::string& text) {
       TPost _return;
-      auto logger = spdlog::get("logger");
-      auto start_time = std::chrono::steady_clock::now();
-      _client->create_post(_return, request_metadata, text);
-      std::chrono::duration<double> latency = \
-          std::chrono::steady_clock::now() - start_time;
-      logger->info("request_id={} server={}:{} "
-          "function=post:create_post latency={}", request_metadata.id,
-          _ip_address, _port, latency.count());
+      call(request_metadata, "post:create_post",
+          [&](const TRequestMetadata& rpc_metadata) {
+        _client->create_post(_return, rpc_metadata, text);
+      });
       return _return;
     }
 
+    std::future<TPost> create_post_async(
+        const TRequestMetadata& request_metadata, const std::string& text) {
+      return call_async([=] {
+        return create_post(request_metadata, text);
+      });
+    }
+
     TPost retrieve_standard_post(const TRequestMetadata& request_metadata,
         const int32_t post_id) {
       TPost _return;
-      auto logger = spdlog::get("logger");
-      auto start_time = std::chrono::steady_clock::now();
-      _client->retrieve_standard_post(_return, request_metadata, post_id);
-      std::chrono::duration<double> latency = \
-          std::chrono::steady_clock::now() - start_time;
-      logger->info("request_id={} server={}:{} "
-          "function=post:retrieve_standard_post latency={}",
-          request_metadata.id, _ip_address, _port, latency.count());
+      call(request_metadata, "post:retrieve_standard_post",
+          [&](const TRequestMetadata& rpc_metadata) {
+        _client->retrieve_standard_post(_return, rpc_metadata, post_id);
+      });
       return _return;
     }
 
+    std::future<TPost> retrieve_standard_post_async(
+        const TRequestMetadata& request_metadata, const int32_t post_id) {
+      return call_async([=] {
+        return retrieve_standard_post(request_metadata, post_id);
+      });
+    }
+
     TPost retrieve_expanded_post(const TRequestMetadata& request_metadata,
         const int32_t post_id) {
       TPost _return;
-      auto logger = spdlog::get("logger");
-      auto start_time = std::chrono::steady_clock::now();
-      _client->retrieve_expanded_post(_return, request_metadata, post_id);
-      std::chrono::duration<double> latency = \
-          std::chrono::steady_clock::now() - start_time;
-      logger->info("request_id={} server={}:{} "
-          "function=post:retrieve_expanded_post latency={}",
-          request_metadata.id, _ip_address, _port, latency.count());
+      call(request_metadata, "post:retrieve_expanded_post",
+          [&](const TRequestMetadata& rpc_metadata) {
+        _client->retrieve_expanded_post(_return, rpc_metadata, post_id);
+      });
+      return _return;
+    }
+
+    std::future<TPost> retrieve_expanded_post_async(
+        const TRequestMetadata& request_metadata, const int32_t post_id) {
+      return call_async([=] {
+        return retrieve_expanded_post(request_metadata, post_id);
+      });
+    }
+
+    std::map<int32_t, TPost> retrieve_expanded_posts(
+        const TRequestMetadata& request_metadata,
+        const std::vector<int32_t>& post_ids) {
+      std::map<int32_t, TPost> _return;
+      call(request_metadata, "post:retrieve_expanded_posts",
+          [&](const TRequestMetadata& rpc_metadata) {
+        _client->retrieve_expanded_posts(_return, rpc_metadata, post_ids);
+      });
       return _return;
     }
 
+    std::future<std::map<int32_t, TPost>> retrieve_expanded_posts_async(
+        const TRequestMetadata& request_metadata,
+        const std::vector<int32_t>& post_ids) {
+      return call_async([=] {
+        return retrieve_expanded_posts(request_metadata, post_ids);
+      });
+    }
+
     void delete_post(const TRequestMetadata& request_metadata,
         const int32_t post_id) {
-      auto logger = spdlog::get("logger");
-      auto start_time = std::chrono::steady_clock::now();
-      _client->delete_post(request_metadata, post_id);
-      std::chrono::duration<double> latency = \
-          std::chrono::steady_clock::now() - start_time;
-      logger->info("request_id={} server={}:{} "
-          "function=post:delete_post latency={}", request_metadata.id,
-          _ip_address, _port, latency.count());
+      call(request_metadata, "post:delete_post",
+          [&](const TRequestMetadata& rpc_metadata) {
+        _client->delete_post(rpc_metadata, post_id);
+      });
+    }
+
+    std::future<void> delete_post_async(
+        const TRequestMetadata& request_metadata, const int32_t post_id) {
+      return call_async([=] {
+        return delete_post(request_metadata, post_id);
+      });
     }
 
     std::vector<TPost> list_posts(const TRequestMetadata& request_metadata,
         const TPostQuery& query, const int32_t limit, const int32_t offset) {
       std::vector<TPost> _return;
-      auto logger = spdlog::get("logger");
-      auto start_time = std::chrono::steady_clock::now();
-      _client->list_posts(_return, request_metadata, query, limit, offset);
-      std::chrono::duration<double> latency = \
-          std::chrono::steady_clock::now() - start_time;
-      logger->info("request_id={} server={}:{} "
-          "function=post:list_posts latency={}", request_metadata.id,
-          _ip_address, _port, latency.count());
+      call(request_metadata, "post:list_posts",
+          [&](const TRequestMetadata& rpc_metadata) {
+        _client->list_posts(_return, rpc_metadata, query, limit, offset);
+      });
       return _return;
     }
 
+    std::future<std::vector<TPost>> list_posts_async(
+        const TRequestMetadata& request_metadata, const TPostQuery& query,
+        const int32_t limit, const int32_t offset) {
+      return call_async([=] {
+        return list_posts(request_metadata, query, limit, offset);
+      });
+    }
+
     int32_t count_posts_by_author(const TRequestMetadata& request_metadata,
         const int32_t author_id) {
-      auto logger = spdlog::get("logger");
-      auto start_time = std::chrono::steady_clock::now();
-      auto ret = _client->count_posts_by_author(request_metadata, author_id);
-      std::chrono::duration<double> latency = \
-          std::chrono::steady_clock::now() - start_time;
-      logger->info("request_id={} server={}:{} "
-          "function=post:count_posts_by_author latency={}", request_metadata.id,
-          _ip_address, _port, latency.count());
+      int32_t ret;
+      call(request_metadata, "post:count_posts_by_author",
+          [&](const TRequestMetadata& rpc_metadata) {
+        ret = _client->count_posts_by_author(rpc_metadata, author_id);
+      });
       return ret;
     }
+
+    std::future<int32_t> count_posts_by_author_async(
+        const TRequestMetadata& request_metadata, const int32_t author_id) {
+      return call_async([=] {
+        return count_posts_by_author(request_metadata, author_id);
+      });
+    }
   };
 }
@@ -0,0 +1,216 @@
+// Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
+// Systems
+
+#pragma once
+
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+#include <thrift/TApplicationException.h>
+#include <thrift/TProcessor.h>
+
+#include <buzzblog/gen/buzzblog_types.h>
+#include <buzzblog/admission_controller.h>
+#include <buzzblog/call_logger.h>
+#include <buzzblog/deadline.h>
+#include <buzzblog/metrics.h>
+#include <buzzblog/span_collector.h>
+
+
+// Time how servers process each call, by method. Every call is split into:
+// - read: deserialization of the request (`buzzblog_server_read_seconds`);
+// - handler: execution of the handler (`buzzblog_handler_seconds`);
+// - write: serialization and sending of the reply
+//   (`buzzblog_server_write_seconds`);
+// and its total is recorded into `buzzblog_server_call_seconds`. Comparing the
+// total with the latency measured by the caller gives the time spent in the
+// network and in queues. If the handler logger exists, the breakdown of every
+// call is also logged with its request id, set by the handler with
+// `set_request_metadata`. If this process traces, a server span is also
+// collected for every sampled call (see 'span_collector.h'). If this server
+// has an admission controller, calls beyond its limit are shed there (see
+// 'admission_controller.h').
+//
+// Attach it to a processor with `setEventHandler`. Calls are processed by a
+// single thread from start to end, which is what lets handlers find the
+// context of their call.
+class ServerEventHandler : public apache::thrift::TProcessorEventHandler {
+public:
+  // Tag the call being processed by this thread with the metadata it
+  // carried. Calls whose deadline already passed are refused with a
+  // TApplicationException, so that no work is done for callers that gave up,
+  // and calls the admission controller does not admit are refused with a
+  // TServerOverloadedException.
+  static void set_request_metadata(
+      const gen::TRequestMetadata& request_metadata) {
+    auto context = current();
+    if (deadline_exceeded(request_metadata)) {
+      auto counter = context ? context->metrics->deadline_exceeded :
+          metrics().counter("buzzblog_deadline_exceeded_total", "");
+      counter->increment();
+      throw apache::thrift::TApplicationException(
+          apache::thrift::TApplicationException::INTERNAL_ERROR,
+          "Deadline exceeded");
+    }
+    if (!context)
+      return;
+    auto controller = admission_controller();
+    if (controller && !context->admitted) {
+      if (!controller->try_acquire()) {
+        context->metrics->shed->increment();
+        throw gen::TServerOverloadedException();
+      }
+      context->admitted = true;
+    }
+    context->request_id = request_metadata.id;
+    auto collector = span_collector();
+    if (collector && collector->sampled(request_metadata)) {
+      context->span_id = server_span_id(request_metadata);
+      context->parent_span_id = request_metadata.__isset.span_id ?
+          request_metadata.span_id : 0;
+    }
+  }
+
+  void* getContext(const char* fn_name, void* server_context) override {
+    (void) server_context;
+    auto now = std::chrono::steady_clock::now();
+    auto context = new Context{fn_name, method_metrics(fn_name), "", 0, 0, now,
+        now, now, now, now, false, false};
+    current() = context;
+    return context;
+  }
+
+  void preRead(void* ctx, const char* fn_name) override {
+    (void) fn_name;
+    static_cast<Context*>(ctx)->pre_read = std::chrono::steady_clock::now();
+  }
+
+  void postRead(void* ctx, const char* fn_name, uint32_t bytes) override {
+    (void) fn_name;
+    (void) bytes;
+    auto context = static_cast<Context*>(ctx);
+    context->post_read = context->pre_write = context->post_write =
+        std::chrono::steady_clock::now();
+  }
+
+  void preWrite(void* ctx, const char* fn_name) override {
+    (void) fn_name;
+    auto context = static_cast<Context*>(ctx);
+    context->pre_write = context->post_write =
+        std::chrono::steady_clock::now();
+  }
+
+  void postWrite(void* ctx, const char* fn_name, uint32_t bytes) override {
+    (void) fn_name;
+    (void) bytes;
+    static_cast<Context*>(ctx)->post_write = std::chrono::steady_clock::now();
+  }
+
+  // Called when a handler throws an exception that is not declared by its
+  // method. No reply is then written.
+  void handlerError(void* ctx, const char* fn_name) override {
+    (void) fn_name;
+    auto context = static_cast<Context*>(ctx);
+    context->pre_write = context->post_write =
+        std::chrono::steady_clock::now();
+    context->failed = true;
+  }
+
+  void freeContext(void* ctx, const char* fn_name) override {
+    (void) fn_name;
+    auto context = static_cast<Context*>(ctx);
+    current() = nullptr;
+    auto end = std::chrono::steady_clock::now();
+    if (context->admitted)
+      admission_controller()->release(end - context->start);
+    auto m = context->metrics;
+    m->read_seconds->record(context->post_read - context->pre_read);
+    m->handler_seconds->record(context->pre_write - context->post_read);
+    m->write_seconds->record(context->post_write - context->pre_write);
+    m->call_seconds->record(end - context->start);
+    if (context->failed)
+      m->handler_errors->increment();
+    if (context->span_id) {
+      auto span_end = std::chrono::system_clock::now();
+      span_collector()->record(Span{context->request_id, context->span_id,
+          context->parent_span_id, Span::SERVER, context->fn_name, "",
+          span_end - std::chrono::duration_cast<
+              std::chrono::system_clock::duration>(end - context->start),
+          span_end, context->failed ? "handler error" : ""});
+    }
+    auto logger = handler_logger();
+    if (logger)
+      logger->info("request_id={} method={} read={} handler={} write={} "
+          "total={}", context->request_id, m->method,
+          seconds(context->post_read - context->pre_read),
+          seconds(context->pre_write - context->post_read),
+          seconds(context->post_write - context->pre_write),
+          seconds(end - context->start));
+    delete context;
+  }
+
+private:
+  // Metrics of a method, resolved on its first call by each thread.
+  struct MethodMetrics {
+    std::string method;
+    Histogram* read_seconds;
+    Histogram* handler_seconds;
+    Histogram* write_seconds;
+    Histogram* call_seconds;
+    Counter* handler_errors;
+    Counter* deadline_exceeded;
+    Counter* shed;
+  };
+
+  struct Context {
+    const char* fn_name;
+    MethodMetrics* metrics;
+    std::string request_id;
+    uint64_t span_id;               // 0 if the call is not sampled.
+    uint64_t parent_span_id;
+    std::chrono::steady_clock::time_point start;
+    std::chrono::steady_clock::time_point pre_read;
+    std::chrono::steady_clock::time_point post_read;
+    std::chrono::steady_clock::time_point pre_write;
+    std::chrono::steady_clock::time_point post_write;
+    bool failed;
+    bool admitted;                  // whether the call holds admission.
+  };
+
+  static Context*& current() {
+    static thread_local Context* context = nullptr;
+    return context;
+  }
+
+  // Metrics of method `fn_name`, cached by address: method names are string
+  // literals of the generated processors.
+  static MethodMetrics* method_metrics(const char* fn_name) {
+    static thread_local std::unordered_map<const char*, MethodMetrics> cache;
+    auto it = cache.find(fn_name);
+    if (it != cache.end())
+      return &it->second;
+    auto name = method(fn_name);
+    auto labels = "method=\"" + name + "\"";
+    auto& m = metrics();
+    return &cache.emplace(fn_name, MethodMetrics{name,
+        m.histogram("buzzblog_server_read_seconds", labels),
+        m.histogram("buzzblog_handler_seconds", labels),
+        m.histogram("buzzblog_server_write_seconds", labels),
+        m.histogram("buzzblog_server_call_seconds", labels),
+        m.counter("buzzblog_handler_errors_total", labels),
+        m.counter("buzzblog_deadline_exceeded_total", labels),
+        m.counter("buzzblog_shed_total", labels)}).first->second;
+  }
+
+  // Strip the service name (e.g., "TAccountService.create_account").
+  static std::string method(const char* fn_name) {
+    const char* dot = strchr(fn_name, '.');
+    return dot ? dot + 1 : fn_name;
+  }
+
+  static double seconds(std::chrono::steady_clock::duration duration) {
+    return std::chrono::duration<double>(duration).count();
+  }
+};
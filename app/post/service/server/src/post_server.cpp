@@ -1,18 +1,24 @@
 // Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
 // Systems
 
+#include <map>
+#include <set>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 #include <cxxopts.hpp>
 #include <pqxx/pqxx>
-#include <spdlog/sinks/basic_file_sink.h>
-#include <thrift/protocol/TBinaryProtocol.h>
-#include <thrift/server/TThreadedServer.h>
-#include <thrift/transport/TBufferTransports.h>
-#include <thrift/transport/TServerSocket.h>
 
 #include <buzzblog/gen/TPostService.h>
+#include <buzzblog/admission_controller.h>
 #include <buzzblog/base_server.h>
+#include <buzzblog/call_logger.h>
+#include <buzzblog/call_tracer.h>
+#include <buzzblog/metrics_server.h>
+#include <buzzblog/server_event_handler.h>
+#include <buzzblog/span_collector.h>
+#include <buzzblog/thrift_server.h>
 
 
 using namespace apache::thrift;
@@ -29,12 +35,53 @@ private:
     return (text.size() > 0 && text.size() <= 200);
   }
 
-  std::string build_where_clause(const TPostQuery& query) {
-    std::ostringstream where_clause;
-    where_clause << "active = true";
-    if (query.__isset.author_id)
-      where_clause << " AND author_id = " << query.author_id;
-    return where_clause.str();
+  // Build posts (expanded mode) from query results. Authors and like counts of
+  // all posts are retrieved with one RPC each.
+  std::vector<TPost> build_expanded_posts(
+      const TRequestMetadata& request_metadata, const pqxx::result& db_res) {
+    std::vector<TPost> posts;
+    if (db_res.empty())
+      return posts;
+
+    std::vector<int32_t> author_ids;
+    std::vector<int32_t> post_ids;
+    for (auto row : db_res) {
+      author_ids.push_back(row["author_id"].as<int>());
+      post_ids.push_back(row["id"].as<int>());
+    }
+
+    // Retrieve like activity concurrently.
+    auto n_likes_of_posts = async_like_call("like:count_likes_of_posts",
+        [=](like_service::Client& client) {
+          return client.count_likes_of_posts(request_metadata, post_ids);
+        });
+
+    // Retrieve authors meanwhile.
+    auto authors = hedged_account_call("account:retrieve_standard_accounts",
+        [=](account_service::Client& client) {
+          return client.retrieve_standard_accounts(request_metadata,
+              author_ids);
+        });
+    auto n_likes = n_likes_of_posts.get();
+
+    // Build posts.
+    for (auto row : db_res) {
+      auto author = authors.find(row["author_id"].as<int>());
+      if (author == authors.end())
+        throw TAccountNotFoundException();
+
+      // Build post (expanded mode).
+      TPost post;
+      post.id = row["id"].as<int>();
+      post.created_at = row["created_at"].as<int>();
+      post.active = row["active"].as<bool>();
+      post.text = row["text"].as<std::string>();
+      post.author_id = row["author_id"].as<int>();
+      post.__set_author(author->second);
+      post.__set_n_likes(n_likes[post.id]);
+      posts.push_back(post);
+    }
+    return posts;
   }
 
 public:
@@ -43,28 +90,73 @@ public:
       const std::string& postgres_dbname)
   : BaseServer(backend_filepath, postgres_user, postgres_password,
       postgres_dbname) {
+    // Prepare statements.
+    post_db_pool->prepare("create_post",
+        "INSERT INTO Posts (text, author_id, created_at) "
+        "VALUES ($1, $2, extract(epoch from now())) "
+        "RETURNING id, created_at");
+    post_db_pool->prepare("retrieve_standard_post",
+        "SELECT created_at, active, text, author_id "
+        "FROM Posts "
+        "WHERE id = $1");
+    post_db_pool->prepare("retrieve_standard_posts",
+        "SELECT id, created_at, active, text, author_id "
+        "FROM Posts "
+        "WHERE id = ANY($1::integer[])");
+    post_db_pool->prepare("delete_post",
+        "UPDATE Posts "
+        "SET active = FALSE "
+        "WHERE id = $1");
+    // Posts are listed from the most recent one, skipping an offset, or after
+    // a (created_at, id) cursor, which the indexes on those columns seek to
+    // directly without scanning the posts before it.
+    post_db_pool->prepare("list_posts",
+        "SELECT id, created_at, active, text, author_id "
+        "FROM Posts "
+        "WHERE active = true "
+        "ORDER BY created_at DESC, id DESC "
+        "LIMIT $1 "
+        "OFFSET $2");
+    post_db_pool->prepare("list_posts_after_cursor",
+        "SELECT id, created_at, active, text, author_id "
+        "FROM Posts "
+        "WHERE active = true AND (created_at, id) < ($1, $2) "
+        "ORDER BY created_at DESC, id DESC "
+        "LIMIT $3");
+    post_db_pool->prepare("list_posts_by_author",
+        "SELECT id, created_at, active, text, author_id "
+        "FROM Posts "
+        "WHERE active = true AND author_id = $1 "
+        "ORDER BY created_at DESC, id DESC "
+        "LIMIT $2 "
+        "OFFSET $3");
+    post_db_pool->prepare("list_posts_by_author_after_cursor",
+        "SELECT id, created_at, active, text, author_id "
+        "FROM Posts "
+        "WHERE active = true AND author_id = $1 AND "
+        "    (created_at, id) < ($2, $3) "
+        "ORDER BY created_at DESC, id DESC "
+        "LIMIT $4");
+    // Post counts are maintained by a trigger (see 'post_schema.sql').
+    post_db_pool->prepare("count_posts_by_author",
+        "SELECT count "
+        "FROM PostCounts "
+        "WHERE author_id = $1");
   }
 
   void create_post(TPost& _return, const TRequestMetadata& request_metadata,
       const std::string& text) {
+    ServerEventHandler::set_request_metadata(request_metadata);
     // Validate attributes.
     if (!validate_attributes(text))
       throw TPostInvalidAttributesException();
 
-    // Build query string.
-    char query_str[1024];
-    const char *query_fmt = \
-        "INSERT INTO Posts (text, author_id, created_at) "
-        "VALUES ('%s', %d, extract(epoch from now())) "
-        "RETURNING id, created_at";
-    sprintf(query_str, query_fmt, text.c_str(), request_metadata.requester_id);
-
     // Execute query.
-    pqxx::connection conn(post_db_conn_str);
-    pqxx::work txn(conn);
-    pqxx::result db_res(txn.exec(query_str));
+    auto conn = post_db_pool->acquire();
+    pqxx::work txn(*conn);
+    pqxx::result db_res(exec_prepared(txn, "create_post", text,
+        request_metadata.requester_id));
     txn.commit();
-    conn.disconnect();
 
     // Build account (standard mode).
     _return.id = db_res[0][0].as<int>();
@@ -76,20 +168,12 @@ public:
 
   void retrieve_standard_post(TPost& _return,
       const TRequestMetadata& request_metadata, const int32_t post_id) {
-    // Build query string.
-    char query_str[1024];
-    const char *query_fmt = \
-        "SELECT created_at, active, text, author_id "
-        "FROM Posts "
-        "WHERE id = %d";
-    sprintf(query_str, query_fmt, post_id);
-
+    ServerEventHandler::set_request_metadata(request_metadata);
     // Execute query.
-    pqxx::connection conn(post_db_conn_str);
-    pqxx::work txn(conn);
-    pqxx::result db_res(txn.exec(query_str));
+    auto conn = post_db_pool->acquire();
+    pqxx::work txn(*conn);
+    pqxx::result db_res(exec_prepared(txn, "retrieve_standard_post", post_id));
     txn.commit();
-    conn.disconnect();
 
     // Check if post exists.
     if (db_res.begin() == db_res.end())
@@ -105,27 +189,57 @@ public:
 
   void retrieve_expanded_post(TPost& _return,
       const TRequestMetadata& request_metadata, const int32_t post_id) {
-    // Retrieve standard post.
+    ServerEventHandler::set_request_metadata(request_metadata);
+    // Retrieve like activity, which only needs the post id, concurrently.
+    auto n_likes = async_like_call("like:count_likes_of_post",
+        [=](like_service::Client& client) {
+          return client.count_likes_of_post(request_metadata, post_id);
+        });
+
+    // Retrieve standard post meanwhile.
     retrieve_standard_post(_return, request_metadata, post_id);
 
     // Retrieve author.
-    auto account_client = get_account_client();
-    auto author = account_client->retrieve_standard_account(request_metadata,
-        _return.author_id);
-    account_client->close();
-
-    // Retrieve like activity.
-    auto like_client = get_like_client();
-    auto n_likes = like_client->count_likes_of_post(request_metadata, post_id);
-    like_client->close();
+    auto author_id = _return.author_id;
+    auto author = hedged_account_call("account:retrieve_standard_account",
+        [=](account_service::Client& client) {
+          return client.retrieve_standard_account(request_metadata,
+              author_id);
+        });
 
     // Build post (expanded mode).
     _return.__set_author(author);
-    _return.__set_n_likes(n_likes);
+    _return.__set_n_likes(n_likes.get());
+  }
+
+  void retrieve_expanded_posts(std::map<int32_t, TPost>& _return,
+      const TRequestMetadata& request_metadata,
+      const std::vector<int32_t>& post_ids) {
+    ServerEventHandler::set_request_metadata(request_metadata);
+    // Deduplicate ids.
+    std::set<int32_t> unique_ids(post_ids.begin(), post_ids.end());
+    if (unique_ids.empty())
+      return;
+
+    // Execute query. The connection goes back to the pool before the posts
+    // are expanded.
+    pqxx::result db_res;
+    {
+      auto conn = post_db_pool->acquire();
+      pqxx::work txn(*conn);
+      db_res = exec_prepared(txn, "retrieve_standard_posts",
+          to_pg_array(unique_ids));
+      txn.commit();
+    }
+
+    // Build posts (expanded mode).
+    for (auto& post : build_expanded_posts(request_metadata, db_res))
+      _return[post.id] = post;
   }
 
   void delete_post(const TRequestMetadata& request_metadata,
       const int32_t post_id) {
+    ServerEventHandler::set_request_metadata(request_metadata);
     {
       // Retrieve standard post.
       TPost post;
@@ -136,88 +250,55 @@ public:
         throw TPostNotAuthorizedException();
     }
 
-    // Build query string.
-    char query_str[1024];
-    const char *query_fmt = \
-        "UPDATE Posts "
-        "SET active = FALSE "
-        "WHERE id = %d";
-    sprintf(query_str, query_fmt, post_id);
-
     // Execute query.
-    pqxx::connection conn(post_db_conn_str);
-    pqxx::work txn(conn);
-    pqxx::result db_res(txn.exec(query_str));
+    auto conn = post_db_pool->acquire();
+    pqxx::work txn(*conn);
+    pqxx::result db_res(exec_prepared(txn, "delete_post", post_id));
     txn.commit();
-    conn.disconnect();
   }
 
   void list_posts(std::vector<TPost>& _return,
       const TRequestMetadata& request_metadata, const TPostQuery& query,
       const int32_t limit, const int32_t offset) {
-    // Build query string.
-    char query_str[1024];
-    const char *query_fmt = \
-        "SELECT id, created_at, active, text, author_id "
-        "FROM Posts "
-        "WHERE %s "
-        "ORDER BY created_at DESC "
-        "LIMIT %d "
-        "OFFSET %d";
-    sprintf(query_str, query_fmt, build_where_clause(query).c_str(), limit,
-        offset);
-
-    // Execute query.
-    pqxx::connection conn(post_db_conn_str);
-    pqxx::work txn(conn);
-    pqxx::result db_res(txn.exec(query_str));
-    txn.commit();
-    conn.disconnect();
-
-    // Build posts.
-    auto account_client = get_account_client();
-    auto like_client = get_like_client();
-    for (auto row : db_res) {
-      // Retrieve author.
-      auto author = account_client->retrieve_standard_account(request_metadata,
-          row["author_id"].as<int>());
-
-      // Retrieve like activity.
-      auto n_likes = like_client->count_likes_of_post(request_metadata,
-          row["id"].as<int>());
-
-      // Build post (expanded mode).
-      TPost post;
-      post.id = row["id"].as<int>();
-      post.created_at = row["created_at"].as<int>();
-      post.active = row["active"].as<bool>();
-      post.text = row["text"].as<std::string>();
-      post.author_id = row["author_id"].as<int>();
-      post.__set_author(author);
-      post.__set_n_likes(n_likes);
-      _return.push_back(post);
+    ServerEventHandler::set_request_metadata(request_metadata);
+    // Execute query. With a cursor, posts are listed after it and `offset` is
+    // ignored. The connection goes back to the pool before the posts are
+    // expanded.
+    pqxx::result db_res;
+    {
+      auto conn = post_db_pool->acquire();
+      pqxx::work txn(*conn);
+      if (query.__isset.cursor && query.__isset.author_id)
+        db_res = exec_prepared(txn, "list_posts_by_author_after_cursor",
+            query.author_id, query.cursor.created_at, query.cursor.id, limit);
+      else if (query.__isset.cursor)
+        db_res = exec_prepared(txn, "list_posts_after_cursor",
+            query.cursor.created_at, query.cursor.id, limit);
+      else if (query.__isset.author_id)
+        db_res = exec_prepared(txn, "list_posts_by_author", query.author_id,
+            limit, offset);
+      else
+        db_res = exec_prepared(txn, "list_posts", limit, offset);
+      txn.commit();
     }
-    account_client->close();
-    like_client->close();
+
+    // Build posts (expanded mode).
+    _return = build_expanded_posts(request_metadata, db_res);
   }
 
   int32_t count_posts_by_author(const TRequestMetadata& request_metadata,
       const int32_t author_id) {
-    // Build query string.
-    char query_str[1024];
-    const char *query_fmt = \
-        "SELECT COUNT(*) "
-        "FROM Posts "
-        "WHERE author_id = %d";
-    sprintf(query_str, query_fmt, author_id);
-
+    ServerEventHandler::set_request_metadata(request_metadata);
     // Execute query.
-    pqxx::connection conn(post_db_conn_str);
-    pqxx::work txn(conn);
-    pqxx::result db_res(txn.exec(query_str));
+    auto conn = post_db_pool->acquire();
+    pqxx::work txn(*conn);
+    pqxx::result db_res(exec_prepared(txn, "count_posts_by_author",
+        author_id));
     txn.commit();
-    conn.disconnect();
 
+    // Authors who never posted have no counter.
+    if (db_res.begin() == db_res.end())
+      return 0;
     return db_res[0][0].as<int>();
   }
 };
@@ -230,6 +311,21 @@ int main(int argc, char** argv) {
       ("host", "", cxxopts::value<std::string>()->default_value("0.0.0.0"))
       ("port", "", cxxopts::value<int>())
       ("threads", "", cxxopts::value<int>())
+      ("server_mode", "", cxxopts::value<std::string>()->default_value(
+          "nonblocking"))
+      ("io_threads", "", cxxopts::value<int>()->default_value("2"))
+      ("client_threads", "", cxxopts::value<int>()->default_value("32"))
+      ("log_queue_size", "", cxxopts::value<int>()->default_value("8192"))
+      ("log_blocking", "", cxxopts::value<bool>()->default_value("false"))
+      ("handler_log", "", cxxopts::value<bool>()->default_value("false"))
+      ("trace_format", "", cxxopts::value<std::string>()->default_value(
+          "text"))
+      ("trace_file_size_mb", "", cxxopts::value<int>()->default_value("64"))
+      ("trace_max_files", "", cxxopts::value<int>()->default_value("8"))
+      ("metrics_port", "", cxxopts::value<int>()->default_value("0"))
+      ("span_sample_rate", "", cxxopts::value<double>()->default_value("0"))
+      ("admission_limit", "", cxxopts::value<int>()->default_value("0"))
+      ("admission_max_limit", "", cxxopts::value<int>()->default_value("1000"))
       ("backend_filepath", "", cxxopts::value<std::string>()->default_value(
           "/etc/opt/BuzzBlogApp/backend.yml"))
       ("postgres_user", "", cxxopts::value<std::string>()->default_value(
@@ -244,27 +340,62 @@ int main(int argc, char** argv) {
   std::string host = result["host"].as<std::string>();
   int port = result["port"].as<int>();
   int threads = result["threads"].as<int>();
+  std::string server_mode = result["server_mode"].as<std::string>();
+  int io_threads = result["io_threads"].as<int>();
+  int client_threads = result["client_threads"].as<int>();
+  int log_queue_size = result["log_queue_size"].as<int>();
+  bool log_blocking = result["log_blocking"].as<bool>();
+  bool handler_log = result["handler_log"].as<bool>();
+  std::string trace_format = result["trace_format"].as<std::string>();
+  int trace_file_size_mb = result["trace_file_size_mb"].as<int>();
+  int trace_max_files = result["trace_max_files"].as<int>();
+  int metrics_port = result["metrics_port"].as<int>();
+  double span_sample_rate = result["span_sample_rate"].as<double>();
+  int admission_limit = result["admission_limit"].as<int>();
+  int admission_max_limit = result["admission_max_limit"].as<int>();
   std::string backend_filepath = result["backend_filepath"].as<std::string>();
   std::string postgres_user = result["postgres_user"].as<std::string>();
   std::string postgres_password = result["postgres_password"].as<std::string>();
   std::string postgres_dbname = result["postgres_dbname"].as<std::string>();
 
-  // Initialize logger.
-  auto logger = spdlog::basic_logger_mt("logger", "/tmp/calls.log");
-  logger->set_pattern("[%H:%M:%S.%F] pid=%P tid=%t %v");
+  // Initialize loggers. The phases of handled calls are only logged on
+  // request.
+  if (trace_format == "text")
+    init_call_logger("/tmp/calls.log", log_queue_size, log_blocking);
+  else if (trace_format == "binary")
+    init_call_tracer("/tmp/calls.bin", size_t(trace_file_size_mb) << 20,
+        trace_max_files);
+  else
+    throw std::invalid_argument("Invalid trace format: " + trace_format);
+  if (handler_log)
+    init_handler_logger("/tmp/handlers.log", log_blocking);
+
+  // Initialize span collector.
+  if (span_sample_rate > 0)
+    init_span_collector("/tmp/spans.json", "post", span_sample_rate);
+
+  // Initialize admission controller.
+  if (admission_limit > 0)
+    init_admission_controller(admission_limit, admission_max_limit);
+
+  // Initialize executor of asynchronous RPCs.
+  if (client_threads > 0)
+    init_client_executor(client_threads);
+
+  // Serve metrics.
+  if (metrics_port)
+    start_metrics_server(metrics_port);
 
   // Create server.
-  TThreadedServer server(
-      std::make_shared<TPostServiceProcessor>(
-          std::make_shared<TPostServiceHandler>(backend_filepath,
-              postgres_user, postgres_password, postgres_dbname)),
-      std::make_shared<TServerSocket>(host, port),
-      std::make_shared<TBufferedTransportFactory>(),
-      std::make_shared<TBinaryProtocolFactory>());
-  server.setConcurrentClientLimit(threads);
+  auto processor = std::make_shared<TPostServiceProcessor>(
+      std::make_shared<TPostServiceHandler>(backend_filepath,
+          postgres_user, postgres_password, postgres_dbname));
+  processor->setEventHandler(std::make_shared<ServerEventHandler>());
+  auto server = make_server(server_mode, processor, host, port, threads,
+      io_threads);
 
   // Serve requests.
-  server.serve();
+  server->serve();
 
   return 0;
 }
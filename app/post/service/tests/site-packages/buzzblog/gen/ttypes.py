@@ -21,13 +21,21 @@ class TRequestMetadata(object):
     Attributes:
      - id
      - requester_id
+     - span_id
+     - parent_span_id
+     - sampled
+     - deadline_ms
 
     """
 
 
-    def __init__(self, id=None, requester_id=None,):
+    def __init__(self, id=None, requester_id=None, span_id=None, parent_span_id=None, sampled=None, deadline_ms=None,):
         self.id = id
         self.requester_id = requester_id
+        self.span_id = span_id
+        self.parent_span_id = parent_span_id
+        self.sampled = sampled
+        self.deadline_ms = deadline_ms
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -48,6 +56,26 @@ class TRequestMetadata(object):
                     self.requester_id = iprot.readI32()
                 else:
                     iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.I64:
+                    self.span_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.I64:
+                    self.parent_span_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 5:
+                if ftype == TType.BOOL:
+                    self.sampled = iprot.readBool()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 6:
+                if ftype == TType.I64:
+                    self.deadline_ms = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -66,10 +94,98 @@ class TRequestMetadata(object):
             oprot.writeFieldBegin('requester_id', TType.I32, 2)
             oprot.writeI32(self.requester_id)
             oprot.writeFieldEnd()
+        if self.span_id is not None:
+            oprot.writeFieldBegin('span_id', TType.I64, 3)
+            oprot.writeI64(self.span_id)
+            oprot.writeFieldEnd()
+        if self.parent_span_id is not None:
+            oprot.writeFieldBegin('parent_span_id', TType.I64, 4)
+            oprot.writeI64(self.parent_span_id)
+            oprot.writeFieldEnd()
+        if self.sampled is not None:
+            oprot.writeFieldBegin('sampled', TType.BOOL, 5)
+            oprot.writeBool(self.sampled)
+            oprot.writeFieldEnd()
+        if self.deadline_ms is not None:
+            oprot.writeFieldBegin('deadline_ms', TType.I64, 6)
+            oprot.writeI64(self.deadline_ms)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        if self.id is None:
+            raise TProtocolException(message='Required field id is unset!')
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+
+
+class TCursor(object):
+    """
+    Attributes:
+     - created_at
+     - id
+
+    """
+
+
+    def __init__(self, created_at=None, id=None,):
+        self.created_at = created_at
+        self.id = id
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.I32:
+                    self.created_at = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.I32:
+                    self.id = iprot.readI32()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('TCursor')
+        if self.created_at is not None:
+            oprot.writeFieldBegin('created_at', TType.I32, 1)
+            oprot.writeI32(self.created_at)
+            oprot.writeFieldEnd()
+        if self.id is not None:
+            oprot.writeFieldBegin('id', TType.I32, 2)
+            oprot.writeI32(self.id)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
     def validate(self):
+        if self.created_at is None:
+            raise TProtocolException(message='Required field created_at is unset!')
         if self.id is None:
             raise TProtocolException(message='Required field id is unset!')
         return
@@ -403,13 +519,15 @@ class TFollowQuery(object):
     Attributes:
      - follower_id
      - followee_id
+     - cursor
 
     """
 
 
-    def __init__(self, follower_id=None, followee_id=None,):
+    def __init__(self, follower_id=None, followee_id=None, cursor=None,):
         self.follower_id = follower_id
         self.followee_id = followee_id
+        self.cursor = cursor
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -430,6 +548,12 @@ class TFollowQuery(object):
                     self.followee_id = iprot.readI32()
                 else:
                     iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.STRUCT:
+                    self.cursor = TCursor()
+                    self.cursor.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -448,6 +572,10 @@ class TFollowQuery(object):
             oprot.writeFieldBegin('followee_id', TType.I32, 2)
             oprot.writeI32(self.followee_id)
             oprot.writeFieldEnd()
+        if self.cursor is not None:
+            oprot.writeFieldBegin('cursor', TType.STRUCT, 3)
+            self.cursor.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -604,12 +732,14 @@ class TPostQuery(object):
     """
     Attributes:
      - author_id
+     - cursor
 
     """
 
 
-    def __init__(self, author_id=None,):
+    def __init__(self, author_id=None, cursor=None,):
         self.author_id = author_id
+        self.cursor = cursor
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -625,6 +755,12 @@ class TPostQuery(object):
                     self.author_id = iprot.readI32()
                 else:
                     iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRUCT:
+                    self.cursor = TCursor()
+                    self.cursor.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -639,6 +775,10 @@ class TPostQuery(object):
             oprot.writeFieldBegin('author_id', TType.I32, 1)
             oprot.writeI32(self.author_id)
             oprot.writeFieldEnd()
+        if self.cursor is not None:
+            oprot.writeFieldBegin('cursor', TType.STRUCT, 2)
+            self.cursor.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -788,13 +928,15 @@ class TLikeQuery(object):
     Attributes:
      - account_id
      - post_id
+     - cursor
 
     """
 
 
-    def __init__(self, account_id=None, post_id=None,):
+    def __init__(self, account_id=None, post_id=None, cursor=None,):
         self.account_id = account_id
         self.post_id = post_id
+        self.cursor = cursor
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -815,6 +957,12 @@ class TLikeQuery(object):
                     self.post_id = iprot.readI32()
                 else:
                     iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.STRUCT:
+                    self.cursor = TCursor()
+                    self.cursor.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -833,6 +981,10 @@ class TLikeQuery(object):
             oprot.writeFieldBegin('post_id', TType.I32, 2)
             oprot.writeI32(self.post_id)
             oprot.writeFieldEnd()
+        if self.cursor is not None:
+            oprot.writeFieldBegin('cursor', TType.STRUCT, 3)
+            self.cursor.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -968,14 +1120,16 @@ class TUniquepairQuery(object):
      - domain
      - first_elem
      - second_elem
+     - cursor
 
     """
 
 
-    def __init__(self, domain=None, first_elem=None, second_elem=None,):
+    def __init__(self, domain=None, first_elem=None, second_elem=None, cursor=None,):
         self.domain = domain
         self.first_elem = first_elem
         self.second_elem = second_elem
+        self.cursor = cursor
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -1001,6 +1155,12 @@ class TUniquepairQuery(object):
                     self.second_elem = iprot.readI32()
                 else:
                     iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.STRUCT:
+                    self.cursor = TCursor()
+                    self.cursor.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -1023,6 +1183,10 @@ class TUniquepairQuery(object):
             oprot.writeFieldBegin('second_elem', TType.I32, 3)
             oprot.writeI32(self.second_elem)
             oprot.writeFieldEnd()
+        if self.cursor is not None:
+            oprot.writeFieldBegin('cursor', TType.STRUCT, 4)
+            self.cursor.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -1772,11 +1936,64 @@ class TUniquepairAlreadyExistsException(TException):
 
     def __ne__(self, other):
         return not (self == other)
+
+
+class TServerOverloadedException(TException):
+
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('TServerOverloadedException')
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __str__(self):
+        return repr(self)
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
 all_structs.append(TRequestMetadata)
 TRequestMetadata.thrift_spec = (
     None,  # 0
     (1, TType.STRING, 'id', 'UTF8', None, ),  # 1
     (2, TType.I32, 'requester_id', None, None, ),  # 2
+    (3, TType.I64, 'span_id', None, None, ),  # 3
+    (4, TType.I64, 'parent_span_id', None, None, ),  # 4
+    (5, TType.BOOL, 'sampled', None, None, ),  # 5
+    (6, TType.I64, 'deadline_ms', None, None, ),  # 6
+)
+all_structs.append(TCursor)
+TCursor.thrift_spec = (
+    None,  # 0
+    (1, TType.I32, 'created_at', None, None, ),  # 1
+    (2, TType.I32, 'id', None, None, ),  # 2
 )
 all_structs.append(TAccount)
 TAccount.thrift_spec = (
@@ -1809,6 +2026,7 @@ TFollowQuery.thrift_spec = (
     None,  # 0
     (1, TType.I32, 'follower_id', None, None, ),  # 1
     (2, TType.I32, 'followee_id', None, None, ),  # 2
+    (3, TType.STRUCT, 'cursor', [TCursor, None], None, ),  # 3
 )
 all_structs.append(TPost)
 TPost.thrift_spec = (
@@ -1825,6 +2043,7 @@ all_structs.append(TPostQuery)
 TPostQuery.thrift_spec = (
     None,  # 0
     (1, TType.I32, 'author_id', None, None, ),  # 1
+    (2, TType.STRUCT, 'cursor', [TCursor, None], None, ),  # 2
 )
 all_structs.append(TLike)
 TLike.thrift_spec = (
@@ -1841,6 +2060,7 @@ TLikeQuery.thrift_spec = (
     None,  # 0
     (1, TType.I32, 'account_id', None, None, ),  # 1
     (2, TType.I32, 'post_id', None, None, ),  # 2
+    (3, TType.STRUCT, 'cursor', [TCursor, None], None, ),  # 3
 )
 all_structs.append(TUniquepair)
 TUniquepair.thrift_spec = (
@@ -1857,6 +2077,7 @@ TUniquepairQuery.thrift_spec = (
     (1, TType.STRING, 'domain', 'UTF8', None, ),  # 1
     (2, TType.I32, 'first_elem', None, None, ),  # 2
     (3, TType.I32, 'second_elem', None, None, ),  # 3
+    (4, TType.STRUCT, 'cursor', [TCursor, None], None, ),  # 4
 )
 all_structs.append(TAccountInvalidCredentialsException)
 TAccountInvalidCredentialsException.thrift_spec = (
@@ -1909,5 +2130,8 @@ TUniquepairNotFoundException.thrift_spec = (
 all_structs.append(TUniquepairAlreadyExistsException)
 TUniquepairAlreadyExistsException.thrift_spec = (
 )
+all_structs.append(TServerOverloadedException)
+TServerOverloadedException.thrift_spec = (
+)
 fix_spec(all_structs)
 del all_structs
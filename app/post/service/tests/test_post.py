@@ -1,6 +1,8 @@
 # Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
 # Systems
 
+import random
+import subprocess
 import time
 import unittest
 
@@ -10,6 +12,21 @@ from buzzblog.post_client import Client as PostClient
 
 IP_ADDRESS = "localhost"
 PORT = 9093
+DATABASE_HOST = "localhost"
+DATABASE_PORT = 5434
+
+
+def query_database(query):
+  """Run `query` on the post database and return its output."""
+  return subprocess.check_output(["psql", "-U", "postgres", "-h",
+      DATABASE_HOST, "-p", str(DATABASE_PORT), "-tA", "-c", query]).decode(
+      ).strip()
+
+
+def count_rows(author_id):
+  """Count the posts of `author_id` in the Posts table."""
+  return int(query_database(
+      "SELECT COUNT(*) FROM Posts WHERE author_id = %d" % author_id))
 
 
 class TestService(unittest.TestCase):
@@ -44,8 +61,48 @@ class TestService(unittest.TestCase):
     pass
 
   def test_count_posts_by_author(self):
-    # TODO
-    pass
+    with PostClient(IP_ADDRESS, PORT) as client:
+      author_id = random.randint(2 ** 20, 2 ** 30)
+      # Check that the author has no posts.
+      self.assertEqual(0, count_rows(author_id))
+      self.assertEqual(0, client.count_posts_by_author(
+          TRequestMetadata(id="1", requester_id=author_id), author_id))
+      # Create 3 posts and check that they are counted.
+      posts = []
+      for i in range(3):
+        posts.append(client.create_post(
+            TRequestMetadata(id="2", requester_id=author_id), "Test message"))
+      self.assertEqual(3, count_rows(author_id))
+      self.assertEqual(3, client.count_posts_by_author(
+          TRequestMetadata(id="3", requester_id=author_id), author_id))
+      # Delete a post from the database and check that it is not counted
+      # anymore.
+      query_database("DELETE FROM Posts WHERE id = %d" % posts[0].id)
+      self.assertEqual(2, count_rows(author_id))
+      self.assertEqual(2, client.count_posts_by_author(
+          TRequestMetadata(id="4", requester_id=author_id), author_id))
+
+  def test_reconcile_post_counts(self):
+    with PostClient(IP_ADDRESS, PORT) as client:
+      author_id = random.randint(2 ** 20, 2 ** 30)
+      # Create 2 posts.
+      for i in range(2):
+        client.create_post(TRequestMetadata(id="1", requester_id=author_id),
+            "Test message")
+      # Make the counter of the author drift.
+      query_database("UPDATE PostCounts SET count = count + 5 "
+          "WHERE author_id = %d" % author_id)
+      self.assertEqual(7, client.count_posts_by_author(
+          TRequestMetadata(id="2", requester_id=author_id), author_id))
+      # Reconcile counters and check that the counter matches the rows again.
+      self.assertGreaterEqual(int(query_database(
+          "SELECT reconcile_post_counts()")), 1)
+      self.assertEqual(2, count_rows(author_id))
+      self.assertEqual(2, client.count_posts_by_author(
+          TRequestMetadata(id="3", requester_id=author_id), author_id))
+      # Check that counters that match are left alone.
+      self.assertEqual(0, int(query_database(
+          "SELECT reconcile_post_counts()")))
 
 
 if __name__ == "__main__":
@@ -10,7 +10,80 @@ CREATE TABLE Uniquepairs(
   UNIQUE(domain, first_elem, second_elem)
 );
 
-CREATE INDEX idx_created_at ON Uniquepairs(created_at);
-CREATE INDEX idx_first_elem ON Uniquepairs(domain, first_elem);
-CREATE INDEX idx_second_elem ON Uniquepairs(domain, second_elem);
+-- Unique pairs are fetched in (created_at, id) order, so that fetching can
+-- resume from a cursor with an index seek.
+CREATE INDEX idx_created_at ON Uniquepairs(domain, created_at, id);
+CREATE INDEX idx_first_elem ON Uniquepairs(domain, first_elem, created_at, id);
+CREATE INDEX idx_second_elem ON Uniquepairs(domain, second_elem, created_at, id);
 CREATE INDEX idx_first_and_second_elem ON Uniquepairs(domain, first_elem, second_elem);
+
+-- Number of unique pairs of each domain with a given first element (kind 'f')
+-- or second element (kind 's'), kept up to date by a trigger so that counting
+-- unique pairs does not scan them.
+CREATE TABLE UniquepairCounts(
+  domain VARCHAR(32) NOT NULL,
+  kind CHAR(1) NOT NULL,
+  elem INTEGER NOT NULL,
+  count INTEGER NOT NULL,
+  PRIMARY KEY(domain, kind, elem)
+);
+
+CREATE FUNCTION update_uniquepair_counts() RETURNS TRIGGER AS $$
+BEGIN
+  IF TG_OP = 'INSERT' THEN
+    INSERT INTO UniquepairCounts (domain, kind, elem, count)
+    VALUES (NEW.domain, 'f', NEW.first_elem, 1),
+        (NEW.domain, 's', NEW.second_elem, 1)
+    ON CONFLICT (domain, kind, elem) DO UPDATE
+    SET count = UniquepairCounts.count + 1;
+    RETURN NEW;
+  ELSE
+    UPDATE UniquepairCounts
+    SET count = count - 1
+    WHERE domain = OLD.domain AND
+        ((kind = 'f' AND elem = OLD.first_elem) OR
+         (kind = 's' AND elem = OLD.second_elem));
+    RETURN OLD;
+  END IF;
+END;
+$$ LANGUAGE plpgsql;
+
+CREATE TRIGGER trg_uniquepair_counts
+AFTER INSERT OR DELETE ON Uniquepairs
+FOR EACH ROW EXECUTE FUNCTION update_uniquepair_counts();
+
+-- Recompute counters from the Uniquepairs table, repairing any drift. Writes to
+-- Uniquepairs are blocked while it runs. Returns the number of counters
+-- repaired.
+CREATE FUNCTION reconcile_uniquepair_counts() RETURNS INTEGER AS $$
+DECLARE
+  n_repaired INTEGER;
+BEGIN
+  LOCK TABLE Uniquepairs IN SHARE MODE;
+  WITH actual AS (
+    SELECT domain, 'f'::CHAR(1) AS kind, first_elem AS elem, COUNT(*) AS count
+    FROM Uniquepairs
+    GROUP BY domain, first_elem
+    UNION ALL
+    SELECT domain, 's'::CHAR(1) AS kind, second_elem AS elem, COUNT(*) AS count
+    FROM Uniquepairs
+    GROUP BY domain, second_elem
+  ), repaired AS (
+    INSERT INTO UniquepairCounts (domain, kind, elem, count)
+    SELECT domain, kind, elem, count FROM actual
+    ON CONFLICT (domain, kind, elem) DO UPDATE SET count = EXCLUDED.count
+    WHERE UniquepairCounts.count <> EXCLUDED.count
+    RETURNING 1
+  ), zeroed AS (
+    UPDATE UniquepairCounts c
+    SET count = 0
+    WHERE c.count <> 0 AND NOT EXISTS (
+        SELECT 1 FROM actual a
+        WHERE a.domain = c.domain AND a.kind = c.kind AND a.elem = c.elem)
+    RETURNING 1
+  )
+  SELECT (SELECT COUNT(*) FROM repaired) + (SELECT COUNT(*) FROM zeroed)
+  INTO n_repaired;
+  RETURN n_repaired;
+END;
+$$ LANGUAGE plpgsql;
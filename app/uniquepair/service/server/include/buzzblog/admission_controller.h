@@ -0,0 +1,162 @@
+// Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
+// Systems
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <mutex>
+
+#include <buzzblog/metrics.h>
+
+
+// Bounds the number of calls a server processes at once, shedding the others
+// instead of letting them queue. The limit adapts to the latency of calls, as
+// in the gradient algorithm of Netflix's concurrency-limits: every window of
+// at least `WINDOW_MS` and `MIN_SAMPLES` calls, the average latency of the
+// window is compared with a long-term average. While they match, the server
+// is not queueing, and the limit grows by about its square root; as latency
+// rises above the long-term average, the limit shrinks in proportion (by at
+// most half per window). The long-term average follows the latency slowly,
+// and quickly once it drops, so that a server recovers its limit after a
+// burst. Windows in which the server used less than half of its limit do not
+// change it, since their latency says nothing about a higher one.
+class AdmissionController {
+public:
+  static const int WINDOW_MS = 100;
+  static const int MIN_SAMPLES = 10;
+
+  AdmissionController(int initial_limit, int min_limit, int max_limit)
+  : _min_limit(min_limit),
+    _max_limit(max_limit),
+    _limit(initial_limit),
+    _estimated_limit(initial_limit),
+    _long_latency_ns(0),
+    _n_in_flight(0),
+    _window_start_ns(now_ns()),
+    _window_sum_ns(0),
+    _window_count(0),
+    _window_max_in_flight(0) {
+  }
+
+  AdmissionController(const AdmissionController&) = delete;
+  AdmissionController& operator=(const AdmissionController&) = delete;
+
+  // Admit a call if the server is under its limit. Admitted calls must be
+  // released when they end.
+  bool try_acquire() {
+    int n_in_flight = _n_in_flight.fetch_add(1, std::memory_order_relaxed) + 1;
+    if (n_in_flight > _limit.load(std::memory_order_relaxed)) {
+      _n_in_flight.fetch_sub(1, std::memory_order_relaxed);
+      return false;
+    }
+    auto max_in_flight = _window_max_in_flight.load(std::memory_order_relaxed);
+    while (n_in_flight > max_in_flight &&
+        !_window_max_in_flight.compare_exchange_weak(max_in_flight,
+            n_in_flight, std::memory_order_relaxed)) {
+    }
+    return true;
+  }
+
+  void release(std::chrono::nanoseconds latency) {
+    _n_in_flight.fetch_sub(1, std::memory_order_relaxed);
+    _window_sum_ns.fetch_add(latency.count(), std::memory_order_relaxed);
+    auto count = _window_count.fetch_add(1, std::memory_order_relaxed) + 1;
+    auto now = now_ns();
+    // One thread closes the window while the others keep recording.
+    if (count < MIN_SAMPLES ||
+        now - _window_start_ns.load(std::memory_order_relaxed) <
+            int64_t(WINDOW_MS) * 1000000 ||
+        !_mutex.try_lock())
+      return;
+    std::lock_guard<std::mutex> lock(_mutex, std::adopt_lock);
+    _window_start_ns.store(now, std::memory_order_relaxed);
+    double sum_ns = _window_sum_ns.exchange(0, std::memory_order_relaxed);
+    count = _window_count.exchange(0, std::memory_order_relaxed);
+    int max_in_flight = _window_max_in_flight.exchange(0,
+        std::memory_order_relaxed);
+    if (count > 0)
+      update(sum_ns / count, max_in_flight);
+  }
+
+  int limit() const {
+    return _limit.load(std::memory_order_relaxed);
+  }
+
+  int n_in_flight() const {
+    return _n_in_flight.load(std::memory_order_relaxed);
+  }
+
+private:
+  // Latency may rise this much above the long-term average before the limit
+  // shrinks.
+  static constexpr double TOLERANCE = 1.5;
+  // Weights of the new sample in the long-term average of latencies, and of the
+  // new estimate in the limit.
+  static constexpr double LONG_WEIGHT = 1.0 / 300;
+  static constexpr double SMOOTHING = 0.2;
+
+  // Adapt the limit to a window of calls. Must be called with the lock held.
+  void update(double latency_ns, int max_in_flight) {
+    if (_long_latency_ns == 0)
+      _long_latency_ns = latency_ns;
+    else
+      _long_latency_ns += (latency_ns - _long_latency_ns) * LONG_WEIGHT;
+    // Once latency drops well below the long-term average, the queue that
+    // raised it is gone: let the average catch up.
+    if (_long_latency_ns > 2 * latency_ns)
+      _long_latency_ns *= 0.9;
+    if (max_in_flight < _estimated_limit / 2)
+      return;
+    double gradient = std::max(0.5,
+        std::min(1.0, TOLERANCE * _long_latency_ns / latency_ns));
+    double new_limit = _estimated_limit * gradient +
+        std::sqrt(_estimated_limit);
+    _estimated_limit = std::max(double(_min_limit), std::min(
+        double(_max_limit),
+        _estimated_limit * (1 - SMOOTHING) + new_limit * SMOOTHING));
+    _limit.store(int(_estimated_limit), std::memory_order_relaxed);
+  }
+
+  static int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  const int _min_limit;
+  const int _max_limit;
+  std::atomic<int> _limit;
+  std::mutex _mutex;
+  double _estimated_limit;
+  double _long_latency_ns;
+  std::atomic<int> _n_in_flight;
+  std::atomic<int64_t> _window_start_ns;
+  std::atomic<int64_t> _window_sum_ns;
+  std::atomic<int64_t> _window_count;
+  std::atomic<int> _window_max_in_flight;
+};
+
+// The admission controller of this server, or null if it admits every call.
+inline AdmissionController*& admission_controller() {
+  static AdmissionController* controller = nullptr;
+  return controller;
+}
+
+// Create the admission controller of this server, starting at a limit of
+// `initial_limit` calls, which then adapts between 1 and `max_limit`. It lives
+// until the process exits.
+inline AdmissionController* init_admission_controller(int initial_limit,
+    int max_limit) {
+  admission_controller() = new AdmissionController(initial_limit, 1,
+      max_limit);
+  auto controller = admission_controller();
+  auto& m = metrics();
+  m.add_callback("gauge", "buzzblog_admission_limit", "",
+      [controller] { return controller->limit(); });
+  m.add_callback("gauge", "buzzblog_admission_in_flight", "",
+      [controller] { return controller->n_in_flight(); });
+  return controller;
+}
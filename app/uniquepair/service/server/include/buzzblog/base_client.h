@@ -0,0 +1,334 @@
+// Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
+// Systems
+
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <sys/socket.h>
+
+#include <thrift/protocol/TBinaryProtocol.h>
+#include <thrift/protocol/TProtocolException.h>
+#include <thrift/transport/TSocket.h>
+#include <thrift/transport/TTransportException.h>
+#include <thrift/transport/TTransportUtils.h>
+
+#include <buzzblog/gen/buzzblog_types.h>
+#include <buzzblog/call_logger.h>
+#include <buzzblog/call_tracer.h>
+#include <buzzblog/circuit_breaker.h>
+#include <buzzblog/client_executor.h>
+#include <buzzblog/deadline.h>
+#include <buzzblog/load_balancer.h>
+#include <buzzblog/metrics.h>
+#include <buzzblog/span_collector.h>
+#include <buzzblog/wire_format.h>
+
+
+using namespace apache::thrift;
+using namespace apache::thrift::protocol;
+using namespace apache::thrift::transport;
+
+using namespace gen;
+
+
+// Common channel and instrumentation logic of the service clients. A client
+// owns one connection to a server, which may be reused across many RPCs, in
+// the given wire format (see 'wire_format.h'). Every RPC has a blocking and an
+// asynchronous variant (e.g., `retrieve_standard_account` and
+// `retrieve_standard_account_async`).
+template <typename TThriftClient>
+class BaseClient {
+protected:
+  BaseClient(const std::string& ip_address, int port, int conn_timeout_ms,
+      const WireFormat& wire_format)
+  : _ip_address(ip_address),
+    _port(port),
+    _server(ip_address + ":" + std::to_string(port)),
+    _broken(false),
+    _timeouts_set(false),
+    _load(nullptr),
+    _breaker(nullptr),
+    _n_async(0) {
+    _socket = std::make_shared<TSocket>(ip_address, port);
+    _socket->setConnTimeout(conn_timeout_ms);
+    _transport = make_transport(wire_format, _socket);
+    _protocol = make_protocol(wire_format, _transport);
+    _client = std::make_shared<TThriftClient>(_protocol);
+    _transport->open();
+  }
+
+  // Make an RPC and log its latency. `rpc` is passed the metadata to send,
+  // which carries the client span of the call if this process traces (see
+  // 'span_collector.h'). Transport and protocol errors leave the connection in
+  // an unknown state, so the client is marked as broken.
+  template <typename F>
+  void call(const TRequestMetadata& request_metadata, const char* function,
+      F&& rpc) {
+    // Asynchronous RPCs may share the connection with the caller.
+    std::lock_guard<std::mutex> lock(_call_mutex);
+    set_timeouts(request_metadata, function);
+    // Requests that are not sampled skip the copy of their metadata once the
+    // decision was made upstream.
+    auto collector = span_collector();
+    if (!collector ||
+        (request_metadata.__isset.sampled && !request_metadata.sampled)) {
+      timed_call(request_metadata, function, [&] { rpc(request_metadata); });
+      return;
+    }
+    TRequestMetadata rpc_metadata = request_metadata;
+    rpc_metadata.__set_sampled(collector->sampled(request_metadata));
+    if (!rpc_metadata.sampled) {
+      timed_call(request_metadata, function, [&] { rpc(rpc_metadata); });
+      return;
+    }
+    rpc_metadata.__set_span_id(new_span_id());
+    rpc_metadata.__set_parent_span_id(server_span_id(request_metadata));
+    Span span{request_metadata.id, uint64_t(rpc_metadata.span_id),
+        uint64_t(rpc_metadata.parent_span_id), Span::CLIENT, function, _server,
+        std::chrono::system_clock::now(), {}, ""};
+    try {
+      timed_call(request_metadata, function, [&] { rpc(rpc_metadata); });
+    }
+    catch (const TException& e) {
+      span.end = std::chrono::system_clock::now();
+      span.error = e.what();
+      collector->record(std::move(span));
+      throw;
+    }
+    span.end = std::chrono::system_clock::now();
+    collector->record(std::move(span));
+  }
+
+  // Run `rpc`, which makes an RPC with this client, on the executor of
+  // asynchronous RPCs (see 'client_executor.h'), returning a future of its
+  // result. `rpc` must capture its arguments by value. RPCs share the
+  // connection, so they are made one at a time, and the client waits for those
+  // in flight before it is closed or goes back to its pool.
+  template <typename F>
+  auto call_async(F rpc) -> std::future<decltype(rpc())> {
+    {
+      std::lock_guard<std::mutex> lock(_async_mutex);
+      _n_async++;
+    }
+    try {
+      return run_async([this, rpc] {
+        InFlight in_flight(this);
+        return rpc();
+      });
+    }
+    catch (...) {
+      // The RPC could not be scheduled, so it will never be in flight.
+      end_async();
+      throw;
+    }
+  }
+
+  // Make an RPC, recording its latency and errors. Transport and protocol
+  // errors are failures of the server; exceptions declared by functions are
+  // replies.
+  template <typename F>
+  void timed_call(const TRequestMetadata& request_metadata,
+      const char* function, F&& rpc) {
+    auto start_time = std::chrono::steady_clock::now();
+    if (_load)
+      _load->start_call();
+    bool probe = _breaker && _breaker->start_call();
+    try {
+      rpc();
+    }
+    catch (const TTransportException& e) {
+      _broken = true;
+      // Socket timeouts are cut to the time left before the deadline (see
+      // `set_timeouts`), so a timeout past the deadline says that the caller
+      // ran out of time, not that the server failed.
+      if (e.getType() == TTransportException::TIMED_OUT &&
+          deadline_exceeded(request_metadata)) {
+        metrics().counter("buzzblog_rpc_deadline_exceeded_total",
+            labels(function))->increment();
+        cancel_call(start_time, probe);
+        throw;
+      }
+      metrics().counter("buzzblog_rpc_errors_total", labels(function))->
+          increment();
+      end_call(start_time, true, probe);
+      throw;
+    }
+    catch (const TProtocolException& e) {
+      _broken = true;
+      metrics().counter("buzzblog_rpc_errors_total", labels(function))->
+          increment();
+      end_call(start_time, true, probe);
+      throw;
+    }
+    catch (...) {
+      end_call(start_time, false, probe);
+      throw;
+    }
+    auto latency = end_call(start_time, false, probe);
+    // A client is used by one thread at a time, so it can keep its own cache
+    // of histograms, by function.
+    auto& histogram = _histograms[function];
+    if (!histogram)
+      histogram = metrics().histogram("buzzblog_rpc_seconds",
+          labels(function));
+    histogram->record(latency);
+    auto tracer = call_tracer();
+    if (tracer) {
+      tracer->record(request_metadata.id, function, _server, latency);
+      return;
+    }
+    auto logger = call_logger();
+    if (logger)
+      logger->info("request_id={} server={}:{} function={} latency={}",
+          request_metadata.id, _ip_address, _port, function,
+          std::chrono::duration<double>(latency).count());
+  }
+
+  // Bound the time the socket waits for the server by the time left before
+  // the deadline of the request, so that a slow server does not hold the
+  // caller past it. Calls whose deadline already passed are not made.
+  void set_timeouts(const TRequestMetadata& request_metadata,
+      const char* function) {
+    if (!request_metadata.__isset.deadline_ms) {
+      if (_timeouts_set) {
+        _socket->setRecvTimeout(0);
+        _socket->setSendTimeout(0);
+        _timeouts_set = false;
+      }
+      return;
+    }
+    auto budget_ms = time_left(request_metadata).count();
+    if (budget_ms <= 0) {
+      metrics().counter("buzzblog_rpc_deadline_exceeded_total",
+          labels(function))->increment();
+      throw TTransportException(TTransportException::TIMED_OUT,
+          "Deadline exceeded before calling " + std::string(function));
+    }
+    int timeout_ms = int(std::min<int64_t>(budget_ms, INT_MAX));
+    _socket->setRecvTimeout(timeout_ms);
+    _socket->setSendTimeout(timeout_ms);
+    _timeouts_set = true;
+  }
+
+  // Report the end of a call to the load of the server and to its circuit
+  // breaker, returning its latency.
+  std::chrono::nanoseconds end_call(
+      std::chrono::steady_clock::time_point start_time, bool failed,
+      bool probe) {
+    auto latency = std::chrono::steady_clock::now() - start_time;
+    if (_load)
+      _load->end_call(latency);
+    if (_breaker)
+      _breaker->end_call(failed, latency, probe);
+    return latency;
+  }
+
+  // Report the end of a call whose outcome does not reflect on the server to
+  // its load, but not to its circuit breaker.
+  void cancel_call(std::chrono::steady_clock::time_point start_time,
+      bool probe) {
+    if (_load)
+      _load->end_call(std::chrono::steady_clock::now() - start_time);
+    if (_breaker)
+      _breaker->cancel_call(probe);
+  }
+
+  // Count an asynchronous RPC out of those in flight.
+  void end_async() {
+    std::lock_guard<std::mutex> lock(_async_mutex);
+    _n_async--;
+    _async_cv.notify_all();
+  }
+
+  // Marks an asynchronous RPC as in flight during its lifetime.
+  class InFlight {
+  public:
+    explicit InFlight(BaseClient* client)
+    : _client(client) {
+    }
+
+    ~InFlight() {
+      _client->end_async();
+    }
+
+  private:
+    BaseClient* _client;
+  };
+
+  std::string labels(const char* function) const {
+    return "function=\"" + std::string(function) + "\",server=\"" + _server +
+        "\"";
+  }
+
+  std::string _ip_address;
+  int _port;
+  std::string _server;
+  bool _broken;
+  bool _timeouts_set;
+  ServerLoad* _load;
+  CircuitBreaker* _breaker;
+  std::unordered_map<const char*, Histogram*> _histograms;
+  std::shared_ptr<TSocket> _socket;
+  std::shared_ptr<TTransport> _transport;
+  std::shared_ptr<TProtocol> _protocol;
+  std::shared_ptr<TThriftClient> _client;
+  std::mutex _call_mutex;
+  std::mutex _async_mutex;
+  std::condition_variable _async_cv;
+  int _n_async;
+
+public:
+  BaseClient(const BaseClient&) = delete;
+  BaseClient& operator=(const BaseClient&) = delete;
+
+  virtual ~BaseClient() {
+    wait_async();
+    close();
+  }
+
+  void close() {
+    if (_transport->isOpen())
+      _transport->close();
+  }
+
+  // Report calls to `load` from now on.
+  void set_load(ServerLoad* load) {
+    _load = load;
+  }
+
+  // Report the outcome of calls to `breaker` from now on.
+  void set_breaker(CircuitBreaker* breaker) {
+    _breaker = breaker;
+  }
+
+  // Wait for the asynchronous RPCs in flight to complete.
+  void wait_async() {
+    std::unique_lock<std::mutex> lock(_async_mutex);
+    _async_cv.wait(lock, [this] { return _n_async == 0; });
+  }
+
+  // Whether the connection can be reused for another RPC.
+  bool is_reusable() const {
+    return !_broken && _transport->isOpen();
+  }
+
+  // Whether the server closed the connection, or sent bytes no RPC is waiting
+  // for, either of which makes it unusable. Checked without blocking, so that
+  // idle connections can be checked before they are reused.
+  bool peer_closed() const {
+    char byte;
+    auto n = recv(_socket->getSocketFD(), &byte, 1, MSG_PEEK | MSG_DONTWAIT);
+    return !(n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK));
+  }
+};
@@ -35,6 +35,11 @@ class TAccountServiceHandler : virtual public TAccountServiceIf {
     printf("retrieve_standard_account\n");
   }
 
+  void retrieve_standard_accounts(std::map<int32_t, TAccount> & _return, const TRequestMetadata& request_metadata, const std::vector<int32_t> & account_ids) {
+    // Your implementation goes here
+    printf("retrieve_standard_accounts\n");
+  }
+
   void retrieve_expanded_account(TAccount& _return, const TRequestMetadata& request_metadata, const int32_t account_id) {
     // Your implementation goes here
     printf("retrieve_expanded_account\n");
@@ -55,6 +55,11 @@ class TLikeServiceHandler : virtual public TLikeServiceIf {
     printf("count_likes_of_post\n");
   }
 
+  void count_likes_of_posts(std::map<int32_t, int32_t> & _return, const TRequestMetadata& request_metadata, const std::vector<int32_t> & post_ids) {
+    // Your implementation goes here
+    printf("count_likes_of_posts\n");
+  }
+
 };
 
 int main(int argc, char **argv) {
@@ -1,17 +1,14 @@
 // Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
 // Systems
 
-#include <chrono>
+#include <future>
+#include <map>
 #include <memory>
 #include <string>
-
-#include <spdlog/spdlog.h>
-#include <spdlog/sinks/basic_file_sink.h>
-#include <thrift/protocol/TBinaryProtocol.h>
-#include <thrift/transport/TSocket.h>
-#include <thrift/transport/TTransportUtils.h>
+#include <vector>
 
 #include <buzzblog/gen/TUniquepairService.h>
+#include <buzzblog/base_client.h>
 
 
 using namespace apache::thrift;
@@ -22,117 +19,139 @@ using namespace gen;
 
 
 namespace uniquepair_service {
-  class Client {
-   private:
-    std::string _ip_address;
-    int _port;
-    std::shared_ptr<TSocket> _socket;
-    std::shared_ptr<TTransport> _transport;
-    std::shared_ptr<TProtocol> _protocol;
-    std::shared_ptr<TUniquepairServiceClient> _client;
+  class Client : public BaseClient<TUniquepairServiceClient> {
    public:
-    Client(const std::string& ip_address, int port, int conn_timeout_ms) {
-      _ip_address = ip_address;
-      _port = port;
-      _socket = std::make_shared<TSocket>(ip_address, port);
-      _socket->setConnTimeout(conn_timeout_ms);
-      _transport = std::make_shared<TBufferedTransport>(_socket);
-      _protocol = std::make_shared<TBinaryProtocol>(_transport);
-      _client = std::make_shared<TUniquepairServiceClient>(_protocol);
-      _transport->open();
-    }
-
-    ~Client() {
-      close();
-    }
-
-    void close() {
-      if (_transport->isOpen())
-        _transport->close();
+    Client(const std::string& ip_address, int port, int conn_timeout_ms,
+        const WireFormat& wire_format = {})
+    : BaseClient(ip_address, port, conn_timeout_ms, wire_format) {
     }
 
     TUniquepair get(const TRequestMetadata& request_metadata,
         const int32_t uniquepair_id) {
       TUniquepair _return;
-      auto logger = spdlog::get("logger");
-      auto start_time = std::chrono::steady_clock::now();
-      _client->get(_return, request_metadata, uniquepair_id);
-      std::chrono::duration<double> latency = \
-          std::chrono::steady_clock::now() - start_time;
-      logger->info("request_id={} server={}:{} "
-          "function=uniquepair:get latency={}", request_metadata.id,
-          _ip_address, _port, latency.count());
+      call(request_metadata, "uniquepair:get",
+          [&](const TRequestMetadata& rpc_metadata) {
+        _client->get(_return, rpc_metadata, uniquepair_id);
+      });
       return _return;
     }
 
+    std::future<TUniquepair> get_async(const TRequestMetadata& request_metadata,
+        const int32_t uniquepair_id) {
+      return call_async([=] {
+        return get(request_metadata, uniquepair_id);
+      });
+    }
+
     TUniquepair add(const TRequestMetadata& request_metadata,
         const std::string& domain, const int32_t first_elem,
         const int32_t second_elem) {
       TUniquepair _return;
-      auto logger = spdlog::get("logger");
-      auto start_time = std::chrono::steady_clock::now();
-      _client->add(_return, request_metadata, domain, first_elem, second_elem);
-      std::chrono::duration<double> latency = \
-          std::chrono::steady_clock::now() - start_time;
-      logger->info("request_id={} server={}:{} "
-          "function=uniquepair:add latency={}", request_metadata.id,
-          _ip_address, _port, latency.count());
+      call(request_metadata, "uniquepair:add",
+          [&](const TRequestMetadata& rpc_metadata) {
+        _client->add(_return, rpc_metadata, domain, first_elem,
+            second_elem);
+      });
       return _return;
     }
 
+    std::future<TUniquepair> add_async(const TRequestMetadata& request_metadata,
+        const std::string& domain, const int32_t first_elem,
+        const int32_t second_elem) {
+      return call_async([=] {
+        return add(request_metadata, domain, first_elem, second_elem);
+      });
+    }
+
     void remove(const TRequestMetadata& request_metadata,
         const int32_t uniquepair_id) {
-      auto logger = spdlog::get("logger");
-      auto start_time = std::chrono::steady_clock::now();
-      _client->remove(request_metadata, uniquepair_id);
-      std::chrono::duration<double> latency = \
-          std::chrono::steady_clock::now() - start_time;
-      logger->info("request_id={} server={}:{} "
-          "function=uniquepair:remove latency={}", request_metadata.id,
-          _ip_address, _port, latency.count());
+      call(request_metadata, "uniquepair:remove",
+          [&](const TRequestMetadata& rpc_metadata) {
+        _client->remove(rpc_metadata, uniquepair_id);
+      });
+    }
+
+    std::future<void> remove_async(const TRequestMetadata& request_metadata,
+        const int32_t uniquepair_id) {
+      return call_async([=] {
+        return remove(request_metadata, uniquepair_id);
+      });
     }
 
     TUniquepair find(const TRequestMetadata& request_metadata,
         const std::string& domain, const int32_t first_elem,
         const int32_t second_elem) {
       TUniquepair _return;
-      auto logger = spdlog::get("logger");
-      auto start_time = std::chrono::steady_clock::now();
-      _client->find(_return, request_metadata, domain, first_elem, second_elem);
-      std::chrono::duration<double> latency = \
-          std::chrono::steady_clock::now() - start_time;
-      logger->info("request_id={} server={}:{} "
-          "function=uniquepair:find latency={}", request_metadata.id,
-          _ip_address, _port, latency.count());
+      call(request_metadata, "uniquepair:find",
+          [&](const TRequestMetadata& rpc_metadata) {
+        _client->find(_return, rpc_metadata, domain, first_elem,
+            second_elem);
+      });
       return _return;
     }
 
+    std::future<TUniquepair> find_async(
+        const TRequestMetadata& request_metadata, const std::string& domain,
+        const int32_t first_elem, const int32_t second_elem) {
+      return call_async([=] {
+        return find(request_metadata, domain, first_elem, second_elem);
+      });
+    }
+
     std::vector<TUniquepair> fetch(const TRequestMetadata& request_metadata,
         const TUniquepairQuery& query, const int32_t limit,
         const int32_t offset) {
       std::vector<TUniquepair> _return;
-      auto logger = spdlog::get("logger");
-      auto start_time = std::chrono::steady_clock::now();
-      _client->fetch(_return, request_metadata, query, limit, offset);
-      std::chrono::duration<double> latency = \
-          std::chrono::steady_clock::now() - start_time;
-      logger->info("request_id={} server={}:{} "
-          "function=uniquepair:fetch latency={}", request_metadata.id,
-          _ip_address, _port, latency.count());
+      call(request_metadata, "uniquepair:fetch",
+          [&](const TRequestMetadata& rpc_metadata) {
+        _client->fetch(_return, rpc_metadata, query, limit, offset);
+      });
       return _return;
     }
 
+    std::future<std::vector<TUniquepair>> fetch_async(
+        const TRequestMetadata& request_metadata, const TUniquepairQuery& query,
+        const int32_t limit, const int32_t offset) {
+      return call_async([=] {
+        return fetch(request_metadata, query, limit, offset);
+      });
+    }
+
     int32_t count(const TRequestMetadata& request_metadata,
         const TUniquepairQuery& query) {
-      auto logger = spdlog::get("logger");
-      auto start_time = std::chrono::steady_clock::now();
-      auto ret = _client->count(request_metadata, query);
-      std::chrono::duration<double> latency = \
-          std::chrono::steady_clock::now() - start_time;
-      logger->info("request_id={} server={}:{} "
-          "function=uniquepair:count latency={}", request_metadata.id,
-          _ip_address, _port, latency.count());
+      int32_t ret;
+      call(request_metadata, "uniquepair:count",
+          [&](const TRequestMetadata& rpc_metadata) {
+        ret = _client->count(rpc_metadata, query);
+      });
       return ret;
     }
+
+    std::future<int32_t> count_async(const TRequestMetadata& request_metadata,
+        const TUniquepairQuery& query) {
+      return call_async([=] {
+        return count(request_metadata, query);
+      });
+    }
+
+    std::map<int32_t, int32_t> count_grouped(
+        const TRequestMetadata& request_metadata, const std::string& domain,
+        const std::vector<int32_t>& second_elems) {
+      std::map<int32_t, int32_t> _return;
+      call(request_metadata, "uniquepair:count_grouped",
+          [&](const TRequestMetadata& rpc_metadata) {
+        _client->count_grouped(_return, rpc_metadata, domain,
+            second_elems);
+      });
+      return _return;
+    }
+
+    std::future<std::map<int32_t, int32_t>> count_grouped_async(
+        const TRequestMetadata& request_metadata, const std::string& domain,
+        const std::vector<int32_t>& second_elems) {
+      return call_async([=] {
+        return count_grouped(request_metadata, domain, second_elems);
+      });
+    }
   };
 }
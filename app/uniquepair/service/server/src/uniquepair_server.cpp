@@ -1,19 +1,24 @@
 // Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
 // Systems
 
-#include <sstream>
+#include <map>
+#include <set>
+#include <stdexcept>
 #include <string>
+#include <vector>
 
 #include <cxxopts.hpp>
 #include <pqxx/pqxx>
-#include <spdlog/sinks/basic_file_sink.h>
-#include <thrift/protocol/TBinaryProtocol.h>
-#include <thrift/server/TThreadedServer.h>
-#include <thrift/transport/TBufferTransports.h>
-#include <thrift/transport/TServerSocket.h>
 
 #include <buzzblog/gen/TUniquepairService.h>
+#include <buzzblog/admission_controller.h>
 #include <buzzblog/base_server.h>
+#include <buzzblog/call_logger.h>
+#include <buzzblog/call_tracer.h>
+#include <buzzblog/metrics_server.h>
+#include <buzzblog/server_event_handler.h>
+#include <buzzblog/span_collector.h>
+#include <buzzblog/thrift_server.h>
 
 
 using namespace apache::thrift;
@@ -26,41 +31,121 @@ using namespace gen;
 
 class TUniquepairServiceHandler : public BaseServer,
     public TUniquepairServiceIf {
-private:
-  std::string build_where_clause(const TUniquepairQuery& query) {
-    std::ostringstream where_clause;
-    where_clause << "domain = '" << query.domain << "'";
-    if (query.__isset.first_elem)
-      where_clause << " AND first_elem = " << query.first_elem;
-    if (query.__isset.second_elem)
-      where_clause << " AND second_elem = " << query.second_elem;
-    return where_clause.str();
-  }
-
 public:
   TUniquepairServiceHandler(const std::string& backend_filepath,
       const std::string& postgres_user, const std::string& postgres_password,
       const std::string& postgres_dbname)
   : BaseServer(backend_filepath, postgres_user, postgres_password,
       postgres_dbname) {
+    // Prepare statements.
+    uniquepair_db_pool->prepare("get",
+        "SELECT created_at, domain, first_elem, second_elem "
+        "FROM Uniquepairs "
+        "WHERE id = $1");
+    uniquepair_db_pool->prepare("add",
+        "INSERT INTO Uniquepairs (domain, first_elem, second_elem, created_at) "
+        "VALUES ($1, $2, $3, extract(epoch from now())) "
+        "RETURNING id, created_at");
+    uniquepair_db_pool->prepare("remove",
+        "DELETE FROM Uniquepairs "
+        "WHERE id = $1 "
+        "RETURNING id");
+    uniquepair_db_pool->prepare("find",
+        "SELECT id, created_at "
+        "FROM Uniquepairs "
+        "WHERE domain = $1 AND first_elem = $2 AND second_elem = $3");
+    // Queries filtering unique pairs by their elements have one statement per
+    // combination of elements being filtered. Results are fetched from the most
+    // recent unique pair, skipping an offset, or after a (created_at, id)
+    // cursor, which the indexes on those columns seek to directly without
+    // scanning the unique pairs before it.
+    uniquepair_db_pool->prepare("fetch",
+        "SELECT id, created_at, first_elem, second_elem "
+        "FROM Uniquepairs "
+        "WHERE domain = $1 "
+        "ORDER BY created_at DESC, id DESC "
+        "LIMIT $2 "
+        "OFFSET $3");
+    uniquepair_db_pool->prepare("fetch_after_cursor",
+        "SELECT id, created_at, first_elem, second_elem "
+        "FROM Uniquepairs "
+        "WHERE domain = $1 AND (created_at, id) < ($2, $3) "
+        "ORDER BY created_at DESC, id DESC "
+        "LIMIT $4");
+    uniquepair_db_pool->prepare("fetch_by_first_elem",
+        "SELECT id, created_at, first_elem, second_elem "
+        "FROM Uniquepairs "
+        "WHERE domain = $1 AND first_elem = $2 "
+        "ORDER BY created_at DESC, id DESC "
+        "LIMIT $3 "
+        "OFFSET $4");
+    uniquepair_db_pool->prepare("fetch_by_first_elem_after_cursor",
+        "SELECT id, created_at, first_elem, second_elem "
+        "FROM Uniquepairs "
+        "WHERE domain = $1 AND first_elem = $2 AND "
+        "    (created_at, id) < ($3, $4) "
+        "ORDER BY created_at DESC, id DESC "
+        "LIMIT $5");
+    uniquepair_db_pool->prepare("fetch_by_second_elem",
+        "SELECT id, created_at, first_elem, second_elem "
+        "FROM Uniquepairs "
+        "WHERE domain = $1 AND second_elem = $2 "
+        "ORDER BY created_at DESC, id DESC "
+        "LIMIT $3 "
+        "OFFSET $4");
+    uniquepair_db_pool->prepare("fetch_by_second_elem_after_cursor",
+        "SELECT id, created_at, first_elem, second_elem "
+        "FROM Uniquepairs "
+        "WHERE domain = $1 AND second_elem = $2 AND "
+        "    (created_at, id) < ($3, $4) "
+        "ORDER BY created_at DESC, id DESC "
+        "LIMIT $5");
+    uniquepair_db_pool->prepare("fetch_by_first_and_second_elem",
+        "SELECT id, created_at, first_elem, second_elem "
+        "FROM Uniquepairs "
+        "WHERE domain = $1 AND first_elem = $2 AND second_elem = $3 "
+        "ORDER BY created_at DESC, id DESC "
+        "LIMIT $4 "
+        "OFFSET $5");
+    uniquepair_db_pool->prepare("fetch_by_first_and_second_elem_after_cursor",
+        "SELECT id, created_at, first_elem, second_elem "
+        "FROM Uniquepairs "
+        "WHERE domain = $1 AND first_elem = $2 AND second_elem = $3 AND "
+        "    (created_at, id) < ($4, $5) "
+        "ORDER BY created_at DESC, id DESC "
+        "LIMIT $6");
+    uniquepair_db_pool->prepare("count",
+        "SELECT COUNT(*) "
+        "FROM Uniquepairs "
+        "WHERE domain = $1");
+    // Counts by first or second element are read from counters maintained by
+    // triggers (see 'uniquepair_schema.sql').
+    uniquepair_db_pool->prepare("count_by_first_elem",
+        "SELECT count "
+        "FROM UniquepairCounts "
+        "WHERE domain = $1 AND kind = 'f' AND elem = $2");
+    uniquepair_db_pool->prepare("count_by_second_elem",
+        "SELECT count "
+        "FROM UniquepairCounts "
+        "WHERE domain = $1 AND kind = 's' AND elem = $2");
+    uniquepair_db_pool->prepare("count_by_first_and_second_elem",
+        "SELECT COUNT(*) "
+        "FROM Uniquepairs "
+        "WHERE domain = $1 AND first_elem = $2 AND second_elem = $3");
+    uniquepair_db_pool->prepare("count_grouped",
+        "SELECT elem, count "
+        "FROM UniquepairCounts "
+        "WHERE domain = $1 AND kind = 's' AND elem = ANY($2::integer[])");
   }
 
   void get(TUniquepair& _return, const TRequestMetadata& request_metadata,
       const int32_t uniquepair_id) {
-    // Build query string.
-    char query_str[1024];
-    const char *query_fmt = \
-        "SELECT created_at, domain, first_elem, second_elem "
-        "FROM Uniquepairs "
-        "WHERE id = %d";
-    sprintf(query_str, query_fmt, uniquepair_id);
-
+    ServerEventHandler::set_request_metadata(request_metadata);
     // Execute query.
-    pqxx::connection conn(uniquepair_db_conn_str);
-    pqxx::work txn(conn);
-    pqxx::result db_res(txn.exec(query_str));
+    auto conn = uniquepair_db_pool->acquire();
+    pqxx::work txn(*conn);
+    pqxx::result db_res(exec_prepared(txn, "get", uniquepair_id));
     txn.commit();
-    conn.disconnect();
 
     // Check if unique pair exists.
     if (db_res.begin() == db_res.end())
@@ -77,26 +162,18 @@ public:
   void add(TUniquepair& _return, const TRequestMetadata& request_metadata,
       const std::string& domain, const int32_t first_elem,
       const int32_t second_elem) {
-    // Build query string.
-    char query_str[1024];
-    const char *query_fmt = \
-        "INSERT INTO Uniquepairs (domain, first_elem, second_elem, created_at) "
-        "VALUES ('%s', %d, %d, extract(epoch from now())) "
-        "RETURNING id, created_at";
-    sprintf(query_str, query_fmt, domain.c_str(), first_elem, second_elem);
-
+    ServerEventHandler::set_request_metadata(request_metadata);
     // Execute query.
-    pqxx::connection conn(uniquepair_db_conn_str);
-    pqxx::work txn(conn);
+    auto conn = uniquepair_db_pool->acquire();
+    pqxx::work txn(*conn);
     pqxx::result db_res;
     try {
-      db_res = txn.exec(query_str);
+      db_res = exec_prepared(txn, "add", domain, first_elem, second_elem);
     }
     catch (pqxx::sql_error& e) {
       throw TUniquepairAlreadyExistsException();
     }
     txn.commit();
-    conn.disconnect();
 
     // Build unique pair.
     _return.id = db_res[0][0].as<int>();
@@ -108,20 +185,12 @@ public:
 
   void remove(const TRequestMetadata& request_metadata,
       const int32_t uniquepair_id) {
-    // Build query string.
-    char query_str[1024];
-    const char *query_fmt = \
-        "DELETE FROM Uniquepairs "
-        "WHERE id = %d "
-        "RETURNING id";
-    sprintf(query_str, query_fmt, uniquepair_id);
-
+    ServerEventHandler::set_request_metadata(request_metadata);
     // Execute query.
-    pqxx::connection conn(uniquepair_db_conn_str);
-    pqxx::work txn(conn);
-    pqxx::result db_res(txn.exec(query_str));
+    auto conn = uniquepair_db_pool->acquire();
+    pqxx::work txn(*conn);
+    pqxx::result db_res(exec_prepared(txn, "remove", uniquepair_id));
     txn.commit();
-    conn.disconnect();
 
     // Check if unique pair exists.
     if (db_res.begin() == db_res.end())
@@ -131,20 +200,13 @@ public:
   void find(TUniquepair& _return, const TRequestMetadata& request_metadata,
       const std::string& domain, const int32_t first_elem,
       const int32_t second_elem) {
-    // Build query string.
-    char query_str[1024];
-    const char *query_fmt = \
-        "SELECT id, created_at "
-        "FROM Uniquepairs "
-        "WHERE domain = '%s' AND first_elem = %d AND second_elem = %d";
-    sprintf(query_str, query_fmt, domain.c_str(), first_elem, second_elem);
-
+    ServerEventHandler::set_request_metadata(request_metadata);
     // Execute query.
-    pqxx::connection conn(uniquepair_db_conn_str);
-    pqxx::work txn(conn);
-    pqxx::result db_res(txn.exec(query_str));
+    auto conn = uniquepair_db_pool->acquire();
+    pqxx::work txn(*conn);
+    pqxx::result db_res(exec_prepared(txn, "find", domain, first_elem,
+        second_elem));
     txn.commit();
-    conn.disconnect();
 
     // Check if unique pair exists.
     if (db_res.begin() == db_res.end())
@@ -161,24 +223,43 @@ public:
   void fetch(std::vector<TUniquepair>& _return,
       const TRequestMetadata& request_metadata, const TUniquepairQuery& query,
       const int32_t limit, const int32_t offset) {
-    // Build query string.
-    char query_str[1024];
-    const char *query_fmt = \
-        "SELECT id, created_at, first_elem, second_elem "
-        "FROM Uniquepairs "
-        "WHERE %s "
-        "ORDER BY created_at DESC "
-        "LIMIT %d "
-        "OFFSET %d";
-    sprintf(query_str, query_fmt, build_where_clause(query).c_str(), limit,
-        offset);
-
-    // Execute query.
-    pqxx::connection conn(uniquepair_db_conn_str);
-    pqxx::work txn(conn);
-    pqxx::result db_res(txn.exec(query_str));
+    ServerEventHandler::set_request_metadata(request_metadata);
+    // Execute query. With a cursor, unique pairs are fetched after it and
+    // `offset` is ignored.
+    auto conn = uniquepair_db_pool->acquire();
+    pqxx::work txn(*conn);
+    pqxx::result db_res;
+    if (query.__isset.cursor) {
+      auto& cursor = query.cursor;
+      if (query.__isset.first_elem && query.__isset.second_elem)
+        db_res = exec_prepared(txn,
+            "fetch_by_first_and_second_elem_after_cursor", query.domain,
+            query.first_elem, query.second_elem, cursor.created_at, cursor.id,
+            limit);
+      else if (query.__isset.first_elem)
+        db_res = exec_prepared(txn, "fetch_by_first_elem_after_cursor",
+            query.domain, query.first_elem, cursor.created_at, cursor.id,
+            limit);
+      else if (query.__isset.second_elem)
+        db_res = exec_prepared(txn, "fetch_by_second_elem_after_cursor",
+            query.domain, query.second_elem, cursor.created_at, cursor.id,
+            limit);
+      else
+        db_res = exec_prepared(txn, "fetch_after_cursor", query.domain,
+            cursor.created_at, cursor.id, limit);
+    }
+    else if (query.__isset.first_elem && query.__isset.second_elem)
+      db_res = exec_prepared(txn, "fetch_by_first_and_second_elem",
+          query.domain, query.first_elem, query.second_elem, limit, offset);
+    else if (query.__isset.first_elem)
+      db_res = exec_prepared(txn, "fetch_by_first_elem", query.domain,
+          query.first_elem, limit, offset);
+    else if (query.__isset.second_elem)
+      db_res = exec_prepared(txn, "fetch_by_second_elem", query.domain,
+          query.second_elem, limit, offset);
+    else
+      db_res = exec_prepared(txn, "fetch", query.domain, limit, offset);
     txn.commit();
-    conn.disconnect();
 
     // Build unique pairs.
     for (auto row : db_res) {
@@ -195,23 +276,51 @@ public:
 
   int32_t count(const TRequestMetadata& request_metadata,
       const TUniquepairQuery& query) {
-    // Build query string.
-    char query_str[1024];
-    const char *query_fmt = \
-        "SELECT COUNT(*) "
-        "FROM Uniquepairs "
-        "WHERE %s";
-    sprintf(query_str, query_fmt, build_where_clause(query).c_str());
-
+    ServerEventHandler::set_request_metadata(request_metadata);
     // Execute query.
-    pqxx::connection conn(uniquepair_db_conn_str);
-    pqxx::work txn(conn);
-    pqxx::result db_res(txn.exec(query_str));
+    auto conn = uniquepair_db_pool->acquire();
+    pqxx::work txn(*conn);
+    pqxx::result db_res;
+    if (query.__isset.first_elem && query.__isset.second_elem)
+      db_res = exec_prepared(txn, "count_by_first_and_second_elem",
+          query.domain, query.first_elem, query.second_elem);
+    else if (query.__isset.first_elem)
+      db_res = exec_prepared(txn, "count_by_first_elem", query.domain,
+          query.first_elem);
+    else if (query.__isset.second_elem)
+      db_res = exec_prepared(txn, "count_by_second_elem", query.domain,
+          query.second_elem);
+    else
+      db_res = exec_prepared(txn, "count", query.domain);
     txn.commit();
-    conn.disconnect();
 
+    // Elements that never had unique pairs have no counter.
+    if (db_res.begin() == db_res.end())
+      return 0;
     return db_res[0][0].as<int>();
   }
+
+  void count_grouped(std::map<int32_t, int32_t>& _return,
+      const TRequestMetadata& request_metadata, const std::string& domain,
+      const std::vector<int32_t>& second_elems) {
+    ServerEventHandler::set_request_metadata(request_metadata);
+    // Deduplicate elements. Those without unique pairs are counted as zero.
+    std::set<int32_t> unique_elems(second_elems.begin(), second_elems.end());
+    if (unique_elems.empty())
+      return;
+    for (auto elem : unique_elems)
+      _return[elem] = 0;
+
+    // Execute query.
+    auto conn = uniquepair_db_pool->acquire();
+    pqxx::work txn(*conn);
+    pqxx::result db_res(exec_prepared(txn, "count_grouped", domain,
+        to_pg_array(unique_elems)));
+    txn.commit();
+
+    for (auto row : db_res)
+      _return[row[0].as<int>()] = row[1].as<int>();
+  }
 };
 
 
@@ -222,6 +331,20 @@ int main(int argc, char** argv) {
       ("host", "", cxxopts::value<std::string>()->default_value("0.0.0.0"))
       ("port", "", cxxopts::value<int>())
       ("threads", "", cxxopts::value<int>())
+      ("server_mode", "", cxxopts::value<std::string>()->default_value(
+          "nonblocking"))
+      ("io_threads", "", cxxopts::value<int>()->default_value("2"))
+      ("log_queue_size", "", cxxopts::value<int>()->default_value("8192"))
+      ("log_blocking", "", cxxopts::value<bool>()->default_value("false"))
+      ("handler_log", "", cxxopts::value<bool>()->default_value("false"))
+      ("trace_format", "", cxxopts::value<std::string>()->default_value(
+          "text"))
+      ("trace_file_size_mb", "", cxxopts::value<int>()->default_value("64"))
+      ("trace_max_files", "", cxxopts::value<int>()->default_value("8"))
+      ("metrics_port", "", cxxopts::value<int>()->default_value("0"))
+      ("span_sample_rate", "", cxxopts::value<double>()->default_value("0"))
+      ("admission_limit", "", cxxopts::value<int>()->default_value("0"))
+      ("admission_max_limit", "", cxxopts::value<int>()->default_value("1000"))
       ("backend_filepath", "", cxxopts::value<std::string>()->default_value(
           "/etc/opt/BuzzBlogApp/backend.yml"))
       ("postgres_user", "", cxxopts::value<std::string>()->default_value(
@@ -236,27 +359,57 @@ int main(int argc, char** argv) {
   std::string host = result["host"].as<std::string>();
   int port = result["port"].as<int>();
   int threads = result["threads"].as<int>();
+  std::string server_mode = result["server_mode"].as<std::string>();
+  int io_threads = result["io_threads"].as<int>();
+  int log_queue_size = result["log_queue_size"].as<int>();
+  bool log_blocking = result["log_blocking"].as<bool>();
+  bool handler_log = result["handler_log"].as<bool>();
+  std::string trace_format = result["trace_format"].as<std::string>();
+  int trace_file_size_mb = result["trace_file_size_mb"].as<int>();
+  int trace_max_files = result["trace_max_files"].as<int>();
+  int metrics_port = result["metrics_port"].as<int>();
+  double span_sample_rate = result["span_sample_rate"].as<double>();
+  int admission_limit = result["admission_limit"].as<int>();
+  int admission_max_limit = result["admission_max_limit"].as<int>();
   std::string backend_filepath = result["backend_filepath"].as<std::string>();
   std::string postgres_user = result["postgres_user"].as<std::string>();
   std::string postgres_password = result["postgres_password"].as<std::string>();
   std::string postgres_dbname = result["postgres_dbname"].as<std::string>();
 
-  // Initialize logger.
-  auto logger = spdlog::basic_logger_mt("logger", "/tmp/calls.log");
-  logger->set_pattern("[%H:%M:%S.%F] pid=%P tid=%t %v");
+  // Initialize loggers. The phases of handled calls are only logged on
+  // request.
+  if (trace_format == "text")
+    init_call_logger("/tmp/calls.log", log_queue_size, log_blocking);
+  else if (trace_format == "binary")
+    init_call_tracer("/tmp/calls.bin", size_t(trace_file_size_mb) << 20,
+        trace_max_files);
+  else
+    throw std::invalid_argument("Invalid trace format: " + trace_format);
+  if (handler_log)
+    init_handler_logger("/tmp/handlers.log", log_blocking);
+
+  // Initialize span collector.
+  if (span_sample_rate > 0)
+    init_span_collector("/tmp/spans.json", "uniquepair", span_sample_rate);
+
+  // Initialize admission controller.
+  if (admission_limit > 0)
+    init_admission_controller(admission_limit, admission_max_limit);
+
+  // Serve metrics.
+  if (metrics_port)
+    start_metrics_server(metrics_port);
 
   // Create server.
-  TThreadedServer server(
-      std::make_shared<TUniquepairServiceProcessor>(
-          std::make_shared<TUniquepairServiceHandler>(backend_filepath,
-              postgres_user, postgres_password, postgres_dbname)),
-      std::make_shared<TServerSocket>(host, port),
-      std::make_shared<TBufferedTransportFactory>(),
-      std::make_shared<TBinaryProtocolFactory>());
-  server.setConcurrentClientLimit(threads);
+  auto processor = std::make_shared<TUniquepairServiceProcessor>(
+      std::make_shared<TUniquepairServiceHandler>(backend_filepath,
+          postgres_user, postgres_password, postgres_dbname));
+  processor->setEventHandler(std::make_shared<ServerEventHandler>());
+  auto server = make_server(server_mode, processor, host, port, threads,
+      io_threads);
 
   // Serve requests.
-  server.serve();
+  server->serve();
 
   return 0;
 }
@@ -84,6 +84,15 @@ class Iface(object):
         """
         pass
 
+    def count_likes_of_posts(self, request_metadata, post_ids):
+        """
+        Parameters:
+         - request_metadata
+         - post_ids
+
+        """
+        pass
+
 
 class Client(Iface):
     def __init__(self, iprot, oprot=None):
@@ -126,6 +135,8 @@ class Client(Iface):
             return result.success
         if result.e is not None:
             raise result.e
+        if result.overloaded is not None:
+            raise result.overloaded
         raise TApplicationException(TApplicationException.MISSING_RESULT, "like_post failed: unknown result")
 
     def retrieve_standard_like(self, request_metadata, like_id):
@@ -162,6 +173,8 @@ class Client(Iface):
             return result.success
         if result.e is not None:
             raise result.e
+        if result.overloaded is not None:
+            raise result.overloaded
         raise TApplicationException(TApplicationException.MISSING_RESULT, "retrieve_standard_like failed: unknown result")
 
     def retrieve_expanded_like(self, request_metadata, like_id):
@@ -202,6 +215,8 @@ class Client(Iface):
             raise result.e2
         if result.e3 is not None:
             raise result.e3
+        if result.overloaded is not None:
+            raise result.overloaded
         raise TApplicationException(TApplicationException.MISSING_RESULT, "retrieve_expanded_like failed: unknown result")
 
     def delete_like(self, request_metadata, like_id):
@@ -238,6 +253,8 @@ class Client(Iface):
             raise result.e1
         if result.e2 is not None:
             raise result.e2
+        if result.overloaded is not None:
+            raise result.overloaded
         return
 
     def list_likes(self, request_metadata, query, limit, offset):
@@ -280,6 +297,8 @@ class Client(Iface):
             raise result.e1
         if result.e2 is not None:
             raise result.e2
+        if result.overloaded is not None:
+            raise result.overloaded
         raise TApplicationException(TApplicationException.MISSING_RESULT, "list_likes failed: unknown result")
 
     def count_likes_by_account(self, request_metadata, account_id):
@@ -314,6 +333,8 @@ class Client(Iface):
         iprot.readMessageEnd()
         if result.success is not None:
             return result.success
+        if result.overloaded is not None:
+            raise result.overloaded
         raise TApplicationException(TApplicationException.MISSING_RESULT, "count_likes_by_account failed: unknown result")
 
     def count_likes_of_post(self, request_metadata, post_id):
@@ -348,8 +369,46 @@ class Client(Iface):
         iprot.readMessageEnd()
         if result.success is not None:
             return result.success
+        if result.overloaded is not None:
+            raise result.overloaded
         raise TApplicationException(TApplicationException.MISSING_RESULT, "count_likes_of_post failed: unknown result")
 
+    def count_likes_of_posts(self, request_metadata, post_ids):
+        """
+        Parameters:
+         - request_metadata
+         - post_ids
+
+        """
+        self.send_count_likes_of_posts(request_metadata, post_ids)
+        return self.recv_count_likes_of_posts()
+
+    def send_count_likes_of_posts(self, request_metadata, post_ids):
+        self._oprot.writeMessageBegin('count_likes_of_posts', TMessageType.CALL, self._seqid)
+        args = count_likes_of_posts_args()
+        args.request_metadata = request_metadata
+        args.post_ids = post_ids
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_count_likes_of_posts(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = count_likes_of_posts_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.success is not None:
+            return result.success
+        if result.overloaded is not None:
+            raise result.overloaded
+        raise TApplicationException(TApplicationException.MISSING_RESULT, "count_likes_of_posts failed: unknown result")
+
 
 class Processor(Iface, TProcessor):
     def __init__(self, handler):
@@ -362,6 +421,7 @@ class Processor(Iface, TProcessor):
         self._processMap["list_likes"] = Processor.process_list_likes
         self._processMap["count_likes_by_account"] = Processor.process_count_likes_by_account
         self._processMap["count_likes_of_post"] = Processor.process_count_likes_of_post
+        self._processMap["count_likes_of_posts"] = Processor.process_count_likes_of_posts
         self._on_message_begin = None
 
     def on_message_begin(self, func):
@@ -397,6 +457,9 @@ class Processor(Iface, TProcessor):
         except TLikeAlreadyExistsException as e:
             msg_type = TMessageType.REPLY
             result.e = e
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -423,6 +486,9 @@ class Processor(Iface, TProcessor):
         except TLikeNotFoundException as e:
             msg_type = TMessageType.REPLY
             result.e = e
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -455,6 +521,9 @@ class Processor(Iface, TProcessor):
         except TPostNotFoundException as e3:
             msg_type = TMessageType.REPLY
             result.e3 = e3
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -484,6 +553,9 @@ class Processor(Iface, TProcessor):
         except TLikeNotAuthorizedException as e2:
             msg_type = TMessageType.REPLY
             result.e2 = e2
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -513,6 +585,9 @@ class Processor(Iface, TProcessor):
         except TPostNotFoundException as e2:
             msg_type = TMessageType.REPLY
             result.e2 = e2
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -536,6 +611,9 @@ class Processor(Iface, TProcessor):
             msg_type = TMessageType.REPLY
         except TTransport.TTransportException:
             raise
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -559,6 +637,9 @@ class Processor(Iface, TProcessor):
             msg_type = TMessageType.REPLY
         except TTransport.TTransportException:
             raise
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -572,6 +653,32 @@ class Processor(Iface, TProcessor):
         oprot.writeMessageEnd()
         oprot.trans.flush()
 
+    def process_count_likes_of_posts(self, seqid, iprot, oprot):
+        args = count_likes_of_posts_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = count_likes_of_posts_result()
+        try:
+            result.success = self._handler.count_likes_of_posts(args.request_metadata, args.post_ids)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("count_likes_of_posts", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
 # HELPER FUNCTIONS AND STRUCTURES
 
 
@@ -655,13 +762,15 @@ class like_post_result(object):
     Attributes:
      - success
      - e
+     - overloaded
 
     """
 
 
-    def __init__(self, success=None, e=None,):
+    def __init__(self, success=None, e=None, overloaded=None,):
         self.success = success
         self.e = e
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -684,6 +793,12 @@ class like_post_result(object):
                     self.e.read(iprot)
                 else:
                     iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -702,6 +817,10 @@ class like_post_result(object):
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
             self.e.write(oprot)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 2)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -722,6 +841,7 @@ all_structs.append(like_post_result)
 like_post_result.thrift_spec = (
     (0, TType.STRUCT, 'success', [TLike, None], None, ),  # 0
     (1, TType.STRUCT, 'e', [TLikeAlreadyExistsException, None], None, ),  # 1
+    (2, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 2
 )
 
 
@@ -805,13 +925,15 @@ class retrieve_standard_like_result(object):
     Attributes:
      - success
      - e
+     - overloaded
 
     """
 
 
-    def __init__(self, success=None, e=None,):
+    def __init__(self, success=None, e=None, overloaded=None,):
         self.success = success
         self.e = e
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -834,6 +956,12 @@ class retrieve_standard_like_result(object):
                     self.e.read(iprot)
                 else:
                     iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -852,6 +980,10 @@ class retrieve_standard_like_result(object):
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
             self.e.write(oprot)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 2)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -872,6 +1004,7 @@ all_structs.append(retrieve_standard_like_result)
 retrieve_standard_like_result.thrift_spec = (
     (0, TType.STRUCT, 'success', [TLike, None], None, ),  # 0
     (1, TType.STRUCT, 'e', [TLikeNotFoundException, None], None, ),  # 1
+    (2, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 2
 )
 
 
@@ -957,15 +1090,17 @@ class retrieve_expanded_like_result(object):
      - e1
      - e2
      - e3
+     - overloaded
 
     """
 
 
-    def __init__(self, success=None, e1=None, e2=None, e3=None,):
+    def __init__(self, success=None, e1=None, e2=None, e3=None, overloaded=None,):
         self.success = success
         self.e1 = e1
         self.e2 = e2
         self.e3 = e3
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -1000,6 +1135,12 @@ class retrieve_expanded_like_result(object):
                     self.e3.read(iprot)
                 else:
                     iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -1026,6 +1167,10 @@ class retrieve_expanded_like_result(object):
             oprot.writeFieldBegin('e3', TType.STRUCT, 3)
             self.e3.write(oprot)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 4)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -1048,6 +1193,7 @@ retrieve_expanded_like_result.thrift_spec = (
     (1, TType.STRUCT, 'e1', [TLikeNotFoundException, None], None, ),  # 1
     (2, TType.STRUCT, 'e2', [TAccountNotFoundException, None], None, ),  # 2
     (3, TType.STRUCT, 'e3', [TPostNotFoundException, None], None, ),  # 3
+    (4, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 4
 )
 
 
@@ -1131,13 +1277,15 @@ class delete_like_result(object):
     Attributes:
      - e1
      - e2
+     - overloaded
 
     """
 
 
-    def __init__(self, e1=None, e2=None,):
+    def __init__(self, e1=None, e2=None, overloaded=None,):
         self.e1 = e1
         self.e2 = e2
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -1160,6 +1308,12 @@ class delete_like_result(object):
                     self.e2.read(iprot)
                 else:
                     iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -1178,6 +1332,10 @@ class delete_like_result(object):
             oprot.writeFieldBegin('e2', TType.STRUCT, 2)
             self.e2.write(oprot)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 3)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -1199,6 +1357,7 @@ delete_like_result.thrift_spec = (
     None,  # 0
     (1, TType.STRUCT, 'e1', [TLikeNotFoundException, None], None, ),  # 1
     (2, TType.STRUCT, 'e2', [TLikeNotAuthorizedException, None], None, ),  # 2
+    (3, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 3
 )
 
 
@@ -1308,14 +1467,16 @@ class list_likes_result(object):
      - success
      - e1
      - e2
+     - overloaded
 
     """
 
 
-    def __init__(self, success=None, e1=None, e2=None,):
+    def __init__(self, success=None, e1=None, e2=None, overloaded=None,):
         self.success = success
         self.e1 = e1
         self.e2 = e2
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -1329,11 +1490,11 @@ class list_likes_result(object):
             if fid == 0:
                 if ftype == TType.LIST:
                     self.success = []
-                    (_etype10, _size7) = iprot.readListBegin()
-                    for _i11 in range(_size7):
-                        _elem12 = TLike()
-                        _elem12.read(iprot)
-                        self.success.append(_elem12)
+                    (_etype26, _size23) = iprot.readListBegin()
+                    for _i27 in range(_size23):
+                        _elem28 = TLike()
+                        _elem28.read(iprot)
+                        self.success.append(_elem28)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -1349,6 +1510,12 @@ class list_likes_result(object):
                     self.e2.read(iprot)
                 else:
                     iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -1362,8 +1529,8 @@ class list_likes_result(object):
         if self.success is not None:
             oprot.writeFieldBegin('success', TType.LIST, 0)
             oprot.writeListBegin(TType.STRUCT, len(self.success))
-            for iter13 in self.success:
-                iter13.write(oprot)
+            for iter29 in self.success:
+                iter29.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.e1 is not None:
@@ -1374,6 +1541,10 @@ class list_likes_result(object):
             oprot.writeFieldBegin('e2', TType.STRUCT, 2)
             self.e2.write(oprot)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 3)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -1395,6 +1566,7 @@ list_likes_result.thrift_spec = (
     (0, TType.LIST, 'success', (TType.STRUCT, [TLike, None], False), None, ),  # 0
     (1, TType.STRUCT, 'e1', [TAccountNotFoundException, None], None, ),  # 1
     (2, TType.STRUCT, 'e2', [TPostNotFoundException, None], None, ),  # 2
+    (3, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 3
 )
 
 
@@ -1477,12 +1649,14 @@ class count_likes_by_account_result(object):
     """
     Attributes:
      - success
+     - overloaded
 
     """
 
 
-    def __init__(self, success=None,):
+    def __init__(self, success=None, overloaded=None,):
         self.success = success
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -1498,6 +1672,12 @@ class count_likes_by_account_result(object):
                     self.success = iprot.readI32()
                 else:
                     iprot.skip(ftype)
+            elif fid == 1:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -1512,6 +1692,10 @@ class count_likes_by_account_result(object):
             oprot.writeFieldBegin('success', TType.I32, 0)
             oprot.writeI32(self.success)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 1)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -1531,6 +1715,7 @@ class count_likes_by_account_result(object):
 all_structs.append(count_likes_by_account_result)
 count_likes_by_account_result.thrift_spec = (
     (0, TType.I32, 'success', None, None, ),  # 0
+    (1, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 1
 )
 
 
@@ -1613,12 +1798,14 @@ class count_likes_of_post_result(object):
     """
     Attributes:
      - success
+     - overloaded
 
     """
 
 
-    def __init__(self, success=None,):
+    def __init__(self, success=None, overloaded=None,):
         self.success = success
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -1634,6 +1821,12 @@ class count_likes_of_post_result(object):
                     self.success = iprot.readI32()
                 else:
                     iprot.skip(ftype)
+            elif fid == 1:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -1648,6 +1841,10 @@ class count_likes_of_post_result(object):
             oprot.writeFieldBegin('success', TType.I32, 0)
             oprot.writeI32(self.success)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 1)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -1667,6 +1864,174 @@ class count_likes_of_post_result(object):
 all_structs.append(count_likes_of_post_result)
 count_likes_of_post_result.thrift_spec = (
     (0, TType.I32, 'success', None, None, ),  # 0
+    (1, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 1
+)
+
+
+class count_likes_of_posts_args(object):
+    """
+    Attributes:
+     - request_metadata
+     - post_ids
+
+    """
+
+
+    def __init__(self, request_metadata=None, post_ids=None,):
+        self.request_metadata = request_metadata
+        self.post_ids = post_ids
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRUCT:
+                    self.request_metadata = TRequestMetadata()
+                    self.request_metadata.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.LIST:
+                    self.post_ids = []
+                    (_etype33, _size30) = iprot.readListBegin()
+                    for _i34 in range(_size30):
+                        _elem35 = iprot.readI32()
+                        self.post_ids.append(_elem35)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('count_likes_of_posts_args')
+        if self.request_metadata is not None:
+            oprot.writeFieldBegin('request_metadata', TType.STRUCT, 1)
+            self.request_metadata.write(oprot)
+            oprot.writeFieldEnd()
+        if self.post_ids is not None:
+            oprot.writeFieldBegin('post_ids', TType.LIST, 2)
+            oprot.writeListBegin(TType.I32, len(self.post_ids))
+            for iter36 in self.post_ids:
+                oprot.writeI32(iter36)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(count_likes_of_posts_args)
+count_likes_of_posts_args.thrift_spec = (
+    None,  # 0
+    (1, TType.STRUCT, 'request_metadata', [TRequestMetadata, None], None, ),  # 1
+    (2, TType.LIST, 'post_ids', (TType.I32, None, False), None, ),  # 2
+)
+
+
+class count_likes_of_posts_result(object):
+    """
+    Attributes:
+     - success
+     - overloaded
+
+    """
+
+
+    def __init__(self, success=None, overloaded=None,):
+        self.success = success
+        self.overloaded = overloaded
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 0:
+                if ftype == TType.MAP:
+                    self.success = {}
+                    (_ktype38, _vtype39, _size37) = iprot.readMapBegin()
+                    for _i41 in range(_size37):
+                        _key42 = iprot.readI32()
+                        _val43 = iprot.readI32()
+                        self.success[_key42] = _val43
+                    iprot.readMapEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('count_likes_of_posts_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.MAP, 0)
+            oprot.writeMapBegin(TType.I32, TType.I32, len(self.success))
+            for kiter44, viter45 in self.success.items():
+                oprot.writeI32(kiter44)
+                oprot.writeI32(viter45)
+            oprot.writeMapEnd()
+            oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 1)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(count_likes_of_posts_result)
+count_likes_of_posts_result.thrift_spec = (
+    (0, TType.MAP, 'success', (TType.I32, None, TType.I32, None, False), None, ),  # 0
+    (1, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 1
 )
 fix_spec(all_structs)
 del all_structs
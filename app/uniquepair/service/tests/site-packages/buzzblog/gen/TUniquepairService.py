@@ -79,6 +79,16 @@ class Iface(object):
         """
         pass
 
+    def count_grouped(self, request_metadata, domain, second_elems):
+        """
+        Parameters:
+         - request_metadata
+         - domain
+         - second_elems
+
+        """
+        pass
+
 
 class Client(Iface):
     def __init__(self, iprot, oprot=None):
@@ -121,6 +131,8 @@ class Client(Iface):
             return result.success
         if result.e is not None:
             raise result.e
+        if result.overloaded is not None:
+            raise result.overloaded
         raise TApplicationException(TApplicationException.MISSING_RESULT, "get failed: unknown result")
 
     def add(self, request_metadata, domain, first_elem, second_elem):
@@ -161,6 +173,8 @@ class Client(Iface):
             return result.success
         if result.e is not None:
             raise result.e
+        if result.overloaded is not None:
+            raise result.overloaded
         raise TApplicationException(TApplicationException.MISSING_RESULT, "add failed: unknown result")
 
     def remove(self, request_metadata, uniquepair_id):
@@ -195,6 +209,8 @@ class Client(Iface):
         iprot.readMessageEnd()
         if result.e is not None:
             raise result.e
+        if result.overloaded is not None:
+            raise result.overloaded
         return
 
     def find(self, request_metadata, domain, first_elem, second_elem):
@@ -235,6 +251,8 @@ class Client(Iface):
             return result.success
         if result.e is not None:
             raise result.e
+        if result.overloaded is not None:
+            raise result.overloaded
         raise TApplicationException(TApplicationException.MISSING_RESULT, "find failed: unknown result")
 
     def fetch(self, request_metadata, query, limit, offset):
@@ -273,6 +291,8 @@ class Client(Iface):
         iprot.readMessageEnd()
         if result.success is not None:
             return result.success
+        if result.overloaded is not None:
+            raise result.overloaded
         raise TApplicationException(TApplicationException.MISSING_RESULT, "fetch failed: unknown result")
 
     def count(self, request_metadata, query):
@@ -307,8 +327,48 @@ class Client(Iface):
         iprot.readMessageEnd()
         if result.success is not None:
             return result.success
+        if result.overloaded is not None:
+            raise result.overloaded
         raise TApplicationException(TApplicationException.MISSING_RESULT, "count failed: unknown result")
 
+    def count_grouped(self, request_metadata, domain, second_elems):
+        """
+        Parameters:
+         - request_metadata
+         - domain
+         - second_elems
+
+        """
+        self.send_count_grouped(request_metadata, domain, second_elems)
+        return self.recv_count_grouped()
+
+    def send_count_grouped(self, request_metadata, domain, second_elems):
+        self._oprot.writeMessageBegin('count_grouped', TMessageType.CALL, self._seqid)
+        args = count_grouped_args()
+        args.request_metadata = request_metadata
+        args.domain = domain
+        args.second_elems = second_elems
+        args.write(self._oprot)
+        self._oprot.writeMessageEnd()
+        self._oprot.trans.flush()
+
+    def recv_count_grouped(self):
+        iprot = self._iprot
+        (fname, mtype, rseqid) = iprot.readMessageBegin()
+        if mtype == TMessageType.EXCEPTION:
+            x = TApplicationException()
+            x.read(iprot)
+            iprot.readMessageEnd()
+            raise x
+        result = count_grouped_result()
+        result.read(iprot)
+        iprot.readMessageEnd()
+        if result.success is not None:
+            return result.success
+        if result.overloaded is not None:
+            raise result.overloaded
+        raise TApplicationException(TApplicationException.MISSING_RESULT, "count_grouped failed: unknown result")
+
 
 class Processor(Iface, TProcessor):
     def __init__(self, handler):
@@ -320,6 +380,7 @@ class Processor(Iface, TProcessor):
         self._processMap["find"] = Processor.process_find
         self._processMap["fetch"] = Processor.process_fetch
         self._processMap["count"] = Processor.process_count
+        self._processMap["count_grouped"] = Processor.process_count_grouped
         self._on_message_begin = None
 
     def on_message_begin(self, func):
@@ -355,6 +416,9 @@ class Processor(Iface, TProcessor):
         except TUniquepairNotFoundException as e:
             msg_type = TMessageType.REPLY
             result.e = e
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -381,6 +445,9 @@ class Processor(Iface, TProcessor):
         except TUniquepairAlreadyExistsException as e:
             msg_type = TMessageType.REPLY
             result.e = e
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -407,6 +474,9 @@ class Processor(Iface, TProcessor):
         except TUniquepairNotFoundException as e:
             msg_type = TMessageType.REPLY
             result.e = e
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -433,6 +503,9 @@ class Processor(Iface, TProcessor):
         except TUniquepairNotFoundException as e:
             msg_type = TMessageType.REPLY
             result.e = e
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -456,6 +529,9 @@ class Processor(Iface, TProcessor):
             msg_type = TMessageType.REPLY
         except TTransport.TTransportException:
             raise
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -479,6 +555,9 @@ class Processor(Iface, TProcessor):
             msg_type = TMessageType.REPLY
         except TTransport.TTransportException:
             raise
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
         except TApplicationException as ex:
             logging.exception('TApplication exception in handler')
             msg_type = TMessageType.EXCEPTION
@@ -492,6 +571,32 @@ class Processor(Iface, TProcessor):
         oprot.writeMessageEnd()
         oprot.trans.flush()
 
+    def process_count_grouped(self, seqid, iprot, oprot):
+        args = count_grouped_args()
+        args.read(iprot)
+        iprot.readMessageEnd()
+        result = count_grouped_result()
+        try:
+            result.success = self._handler.count_grouped(args.request_metadata, args.domain, args.second_elems)
+            msg_type = TMessageType.REPLY
+        except TTransport.TTransportException:
+            raise
+        except TServerOverloadedException as overloaded:
+            msg_type = TMessageType.REPLY
+            result.overloaded = overloaded
+        except TApplicationException as ex:
+            logging.exception('TApplication exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = ex
+        except Exception:
+            logging.exception('Unexpected exception in handler')
+            msg_type = TMessageType.EXCEPTION
+            result = TApplicationException(TApplicationException.INTERNAL_ERROR, 'Internal error')
+        oprot.writeMessageBegin("count_grouped", msg_type, seqid)
+        result.write(oprot)
+        oprot.writeMessageEnd()
+        oprot.trans.flush()
+
 # HELPER FUNCTIONS AND STRUCTURES
 
 
@@ -575,13 +680,15 @@ class get_result(object):
     Attributes:
      - success
      - e
+     - overloaded
 
     """
 
 
-    def __init__(self, success=None, e=None,):
+    def __init__(self, success=None, e=None, overloaded=None,):
         self.success = success
         self.e = e
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -604,6 +711,12 @@ class get_result(object):
                     self.e.read(iprot)
                 else:
                     iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -622,6 +735,10 @@ class get_result(object):
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
             self.e.write(oprot)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 2)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -642,6 +759,7 @@ all_structs.append(get_result)
 get_result.thrift_spec = (
     (0, TType.STRUCT, 'success', [TUniquepair, None], None, ),  # 0
     (1, TType.STRUCT, 'e', [TUniquepairNotFoundException, None], None, ),  # 1
+    (2, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 2
 )
 
 
@@ -749,13 +867,15 @@ class add_result(object):
     Attributes:
      - success
      - e
+     - overloaded
 
     """
 
 
-    def __init__(self, success=None, e=None,):
+    def __init__(self, success=None, e=None, overloaded=None,):
         self.success = success
         self.e = e
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -778,6 +898,12 @@ class add_result(object):
                     self.e.read(iprot)
                 else:
                     iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -796,6 +922,10 @@ class add_result(object):
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
             self.e.write(oprot)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 2)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -816,6 +946,7 @@ all_structs.append(add_result)
 add_result.thrift_spec = (
     (0, TType.STRUCT, 'success', [TUniquepair, None], None, ),  # 0
     (1, TType.STRUCT, 'e', [TUniquepairAlreadyExistsException, None], None, ),  # 1
+    (2, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 2
 )
 
 
@@ -898,12 +1029,14 @@ class remove_result(object):
     """
     Attributes:
      - e
+     - overloaded
 
     """
 
 
-    def __init__(self, e=None,):
+    def __init__(self, e=None, overloaded=None,):
         self.e = e
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -920,6 +1053,12 @@ class remove_result(object):
                     self.e.read(iprot)
                 else:
                     iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -934,6 +1073,10 @@ class remove_result(object):
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
             self.e.write(oprot)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 2)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -954,6 +1097,7 @@ all_structs.append(remove_result)
 remove_result.thrift_spec = (
     None,  # 0
     (1, TType.STRUCT, 'e', [TUniquepairNotFoundException, None], None, ),  # 1
+    (2, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 2
 )
 
 
@@ -1061,13 +1205,15 @@ class find_result(object):
     Attributes:
      - success
      - e
+     - overloaded
 
     """
 
 
-    def __init__(self, success=None, e=None,):
+    def __init__(self, success=None, e=None, overloaded=None,):
         self.success = success
         self.e = e
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -1090,6 +1236,12 @@ class find_result(object):
                     self.e.read(iprot)
                 else:
                     iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -1108,6 +1260,10 @@ class find_result(object):
             oprot.writeFieldBegin('e', TType.STRUCT, 1)
             self.e.write(oprot)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 2)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -1128,6 +1284,7 @@ all_structs.append(find_result)
 find_result.thrift_spec = (
     (0, TType.STRUCT, 'success', [TUniquepair, None], None, ),  # 0
     (1, TType.STRUCT, 'e', [TUniquepairNotFoundException, None], None, ),  # 1
+    (2, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 2
 )
 
 
@@ -1235,12 +1392,14 @@ class fetch_result(object):
     """
     Attributes:
      - success
+     - overloaded
 
     """
 
 
-    def __init__(self, success=None,):
+    def __init__(self, success=None, overloaded=None,):
         self.success = success
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -1254,14 +1413,20 @@ class fetch_result(object):
             if fid == 0:
                 if ftype == TType.LIST:
                     self.success = []
-                    (_etype24, _size21) = iprot.readListBegin()
-                    for _i25 in range(_size21):
-                        _elem26 = TUniquepair()
-                        _elem26.read(iprot)
-                        self.success.append(_elem26)
+                    (_etype72, _size69) = iprot.readListBegin()
+                    for _i73 in range(_size69):
+                        _elem74 = TUniquepair()
+                        _elem74.read(iprot)
+                        self.success.append(_elem74)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
+            elif fid == 1:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -1275,10 +1440,14 @@ class fetch_result(object):
         if self.success is not None:
             oprot.writeFieldBegin('success', TType.LIST, 0)
             oprot.writeListBegin(TType.STRUCT, len(self.success))
-            for iter27 in self.success:
-                iter27.write(oprot)
+            for iter75 in self.success:
+                iter75.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 1)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -1298,6 +1467,7 @@ class fetch_result(object):
 all_structs.append(fetch_result)
 fetch_result.thrift_spec = (
     (0, TType.LIST, 'success', (TType.STRUCT, [TUniquepair, None], False), None, ),  # 0
+    (1, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 1
 )
 
 
@@ -1381,12 +1551,14 @@ class count_result(object):
     """
     Attributes:
      - success
+     - overloaded
 
     """
 
 
-    def __init__(self, success=None,):
+    def __init__(self, success=None, overloaded=None,):
         self.success = success
+        self.overloaded = overloaded
 
     def read(self, iprot):
         if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
@@ -1402,6 +1574,12 @@ class count_result(object):
                     self.success = iprot.readI32()
                 else:
                     iprot.skip(ftype)
+            elif fid == 1:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
             else:
                 iprot.skip(ftype)
             iprot.readFieldEnd()
@@ -1416,6 +1594,10 @@ class count_result(object):
             oprot.writeFieldBegin('success', TType.I32, 0)
             oprot.writeI32(self.success)
             oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 1)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
         oprot.writeFieldStop()
         oprot.writeStructEnd()
 
@@ -1435,6 +1617,186 @@ class count_result(object):
 all_structs.append(count_result)
 count_result.thrift_spec = (
     (0, TType.I32, 'success', None, None, ),  # 0
+    (1, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 1
+)
+
+
+class count_grouped_args(object):
+    """
+    Attributes:
+     - request_metadata
+     - domain
+     - second_elems
+
+    """
+
+
+    def __init__(self, request_metadata=None, domain=None, second_elems=None,):
+        self.request_metadata = request_metadata
+        self.domain = domain
+        self.second_elems = second_elems
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRUCT:
+                    self.request_metadata = TRequestMetadata()
+                    self.request_metadata.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRING:
+                    self.domain = iprot.readString().decode('utf-8') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.LIST:
+                    self.second_elems = []
+                    (_etype79, _size76) = iprot.readListBegin()
+                    for _i80 in range(_size76):
+                        _elem81 = iprot.readI32()
+                        self.second_elems.append(_elem81)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('count_grouped_args')
+        if self.request_metadata is not None:
+            oprot.writeFieldBegin('request_metadata', TType.STRUCT, 1)
+            self.request_metadata.write(oprot)
+            oprot.writeFieldEnd()
+        if self.domain is not None:
+            oprot.writeFieldBegin('domain', TType.STRING, 2)
+            oprot.writeString(self.domain.encode('utf-8') if sys.version_info[0] == 2 else self.domain)
+            oprot.writeFieldEnd()
+        if self.second_elems is not None:
+            oprot.writeFieldBegin('second_elems', TType.LIST, 3)
+            oprot.writeListBegin(TType.I32, len(self.second_elems))
+            for iter82 in self.second_elems:
+                oprot.writeI32(iter82)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(count_grouped_args)
+count_grouped_args.thrift_spec = (
+    None,  # 0
+    (1, TType.STRUCT, 'request_metadata', [TRequestMetadata, None], None, ),  # 1
+    (2, TType.STRING, 'domain', 'UTF8', None, ),  # 2
+    (3, TType.LIST, 'second_elems', (TType.I32, None, False), None, ),  # 3
+)
+
+
+class count_grouped_result(object):
+    """
+    Attributes:
+     - success
+     - overloaded
+
+    """
+
+
+    def __init__(self, success=None, overloaded=None,):
+        self.success = success
+        self.overloaded = overloaded
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 0:
+                if ftype == TType.MAP:
+                    self.success = {}
+                    (_ktype84, _vtype85, _size83) = iprot.readMapBegin()
+                    for _i87 in range(_size83):
+                        _key88 = iprot.readI32()
+                        _val89 = iprot.readI32()
+                        self.success[_key88] = _val89
+                    iprot.readMapEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 1:
+                if ftype == TType.STRUCT:
+                    self.overloaded = TServerOverloadedException()
+                    self.overloaded.read(iprot)
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('count_grouped_result')
+        if self.success is not None:
+            oprot.writeFieldBegin('success', TType.MAP, 0)
+            oprot.writeMapBegin(TType.I32, TType.I32, len(self.success))
+            for kiter90, viter91 in self.success.items():
+                oprot.writeI32(kiter90)
+                oprot.writeI32(viter91)
+            oprot.writeMapEnd()
+            oprot.writeFieldEnd()
+        if self.overloaded is not None:
+            oprot.writeFieldBegin('overloaded', TType.STRUCT, 1)
+            self.overloaded.write(oprot)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+all_structs.append(count_grouped_result)
+count_grouped_result.thrift_spec = (
+    (0, TType.MAP, 'success', (TType.I32, None, TType.I32, None, False), None, ),  # 0
+    (1, TType.STRUCT, 'overloaded', [TServerOverloadedException, None], None, ),  # 1
 )
 fix_spec(all_structs)
 del all_structs
@@ -2,6 +2,7 @@
 # Systems
 
 import random
+import subprocess
 import time
 import unittest
 
@@ -11,6 +12,22 @@ from buzzblog.uniquepair_client import Client as UniquepairClient
 
 IP_ADDRESS = "localhost"
 PORT = 9094
+DATABASE_HOST = "localhost"
+DATABASE_PORT = 5435
+
+
+def query_database(query):
+  """Run `query` on the uniquepair database and return its output."""
+  return subprocess.check_output(["psql", "-U", "postgres", "-h",
+      DATABASE_HOST, "-p", str(DATABASE_PORT), "-tA", "-c", query]).decode(
+      ).strip()
+
+
+def count_rows(domain, column, elem):
+  """Count the uniquepairs of `domain` whose `column` is `elem` in the
+  Uniquepairs table."""
+  return int(query_database("SELECT COUNT(*) FROM Uniquepairs "
+      "WHERE domain = '%s' AND %s = %d" % (domain, column, elem)))
 
 
 class TestService(unittest.TestCase):
@@ -92,6 +109,49 @@ class TestService(unittest.TestCase):
       self.assertEqual(1, len(fetched_uniquepairs))
       self.assertEqual(uniquepair.id, fetched_uniquepairs[0].id)
 
+  def test_fetch_with_cursor(self):
+    with UniquepairClient(IP_ADDRESS, PORT) as client:
+      # Add 5 uniquepairs with the same first element.
+      first_elem = random.randint(1, 2 ** 16)
+      for i in range(5):
+        client.add(TRequestMetadata(id="1"), "test_fetch_with_cursor",
+            first_elem, i)
+      # Fetch them in pages of 2, each starting after the last uniquepair of
+      # the previous page.
+      fetched_uniquepairs = []
+      cursor = None
+      while True:
+        page = client.fetch(TRequestMetadata(id="2"),
+            TUniquepairQuery(domain="test_fetch_with_cursor",
+                first_elem=first_elem, cursor=cursor), 2, 0)
+        fetched_uniquepairs.extend(page)
+        if len(page) < 2:
+          break
+        cursor = TCursor(created_at=page[-1].created_at, id=page[-1].id)
+      # Check that all uniquepairs were fetched once, most recent first.
+      self.assertEqual([4, 3, 2, 1, 0],
+          [uniquepair.second_elem for uniquepair in fetched_uniquepairs])
+
+  def test_fetch_with_cursor_ignores_offset(self):
+    with UniquepairClient(IP_ADDRESS, PORT) as client:
+      # Add 3 uniquepairs with the same first element.
+      first_elem = random.randint(1, 2 ** 16)
+      for i in range(3):
+        client.add(TRequestMetadata(id="1"), "test_fetch_with_cursor",
+            first_elem, i)
+      newest = client.fetch(TRequestMetadata(id="2"),
+          TUniquepairQuery(domain="test_fetch_with_cursor",
+              first_elem=first_elem), 1, 0)[0]
+      # Fetch after the most recent uniquepair with an offset, which is
+      # ignored.
+      fetched_uniquepairs = client.fetch(TRequestMetadata(id="3"),
+          TUniquepairQuery(domain="test_fetch_with_cursor",
+              first_elem=first_elem,
+              cursor=TCursor(created_at=newest.created_at, id=newest.id)),
+          10, 1)
+      self.assertEqual([1, 0],
+          [uniquepair.second_elem for uniquepair in fetched_uniquepairs])
+
   def test_count(self):
     with UniquepairClient(IP_ADDRESS, PORT) as client:
       # Add 10 random uniquepairs.
@@ -111,6 +171,79 @@ class TestService(unittest.TestCase):
       self.assertEqual(1, client.count(TRequestMetadata(id="5"),
           TUniquepairQuery(domain="test_count", second_elem=0)))
 
+  def test_count_grouped(self):
+    with UniquepairClient(IP_ADDRESS, PORT) as client:
+      # Add 3 uniquepairs whose second element is 1, and 1 whose second element
+      # is 2.
+      for i in range(3):
+        client.add(TRequestMetadata(id="1"), "test_count_grouped",
+            random.randint(1, 2 ** 16), 1)
+      client.add(TRequestMetadata(id="2"), "test_count_grouped",
+          random.randint(1, 2 ** 16), 2)
+      # Count uniquepairs grouped by second element.
+      self.assertEqual({1: 3, 2: 1, 3: 0}, client.count_grouped(
+          TRequestMetadata(id="3"), "test_count_grouped", [1, 2, 3, 1]))
+
+
+  def test_count_triggers(self):
+    with UniquepairClient(IP_ADDRESS, PORT) as client:
+      first_elem = random.randint(1, 2 ** 16)
+      second_elem = random.randint(1, 2 ** 16)
+      first_query = TUniquepairQuery(domain="test_count_triggers",
+          first_elem=first_elem)
+      second_query = TUniquepairQuery(domain="test_count_triggers",
+          second_elem=second_elem)
+      # Count uniquepairs before adding any.
+      n_first = count_rows("test_count_triggers", "first_elem", first_elem)
+      n_second = count_rows("test_count_triggers", "second_elem", second_elem)
+      self.assertEqual(n_first, client.count(TRequestMetadata(id="1"),
+          first_query))
+      self.assertEqual(n_second, client.count(TRequestMetadata(id="2"),
+          second_query))
+      # Add a uniquepair and check that it is counted.
+      uniquepair = client.add(TRequestMetadata(id="3"), "test_count_triggers",
+          first_elem, second_elem)
+      self.assertEqual(n_first + 1,
+          count_rows("test_count_triggers", "first_elem", first_elem))
+      self.assertEqual(n_first + 1, client.count(TRequestMetadata(id="4"),
+          first_query))
+      self.assertEqual(n_second + 1,
+          count_rows("test_count_triggers", "second_elem", second_elem))
+      self.assertEqual(n_second + 1, client.count(TRequestMetadata(id="5"),
+          second_query))
+      # Remove that uniquepair and check that it is not counted anymore.
+      client.remove(TRequestMetadata(id="6"), uniquepair.id)
+      self.assertEqual(n_first,
+          count_rows("test_count_triggers", "first_elem", first_elem))
+      self.assertEqual(n_first, client.count(TRequestMetadata(id="7"),
+          first_query))
+      self.assertEqual(n_second,
+          count_rows("test_count_triggers", "second_elem", second_elem))
+      self.assertEqual(n_second, client.count(TRequestMetadata(id="8"),
+          second_query))
+
+  def test_reconcile_uniquepair_counts(self):
+    with UniquepairClient(IP_ADDRESS, PORT) as client:
+      # Add 2 uniquepairs with the same first element.
+      first_elem = random.randint(1, 2 ** 16)
+      for i in range(2):
+        client.add(TRequestMetadata(id="1"), "test_reconcile", first_elem, i)
+      query = TUniquepairQuery(domain="test_reconcile", first_elem=first_elem)
+      n_rows = count_rows("test_reconcile", "first_elem", first_elem)
+      # Make the counter of the first element drift.
+      query_database("UPDATE UniquepairCounts SET count = count + 5 "
+          "WHERE domain = 'test_reconcile' AND kind = 'f' AND elem = %d" %
+          first_elem)
+      self.assertEqual(n_rows + 5, client.count(TRequestMetadata(id="2"),
+          query))
+      # Reconcile counters and check that the counter matches the rows again.
+      self.assertGreaterEqual(int(query_database(
+          "SELECT reconcile_uniquepair_counts()")), 1)
+      self.assertEqual(n_rows, client.count(TRequestMetadata(id="3"), query))
+      # Check that counters that match are left alone.
+      self.assertEqual(0, int(query_database(
+          "SELECT reconcile_uniquepair_counts()")))
+
 
 if __name__ == "__main__":
   unittest.main()
@@ -0,0 +1,306 @@
+// Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
+// Systems
+
+// Microbenchmarks of the serialization of lists of accounts, posts, likes, and
+// follows, as replies carry them between services: every struct is in expanded
+// mode, so that likes embed an account and a post that embeds its author. Each
+// list is encoded and decoded as the reply of an RPC, in every wire format
+// (binary or compact protocol, buffered or framed transport, with or without
+// zlib; see 'wire_format.h'), over memory instead of a socket. Besides time,
+// benchmarks report the size of the reply ("bytes") and the heap allocations
+// per encode or decode ("allocs").
+// See 'docs/MANUAL.md'.
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <thrift/transport/TBufferTransports.h>
+
+#include <buzzblog/gen/buzzblog_types.h>
+#include <buzzblog/wire_format.h>
+
+
+using namespace apache::thrift::protocol;
+using namespace apache::thrift::transport;
+using namespace gen;
+
+/*
+ * Allocation counting
+ */
+
+static std::atomic<int64_t> n_allocations(0);
+
+// Replacements are not inlined, so that the compiler does not pair `new` with
+// `free` when it checks allocations.
+__attribute__((noinline)) void* operator new(std::size_t size) {
+  n_allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size ? size : 1))
+    return ptr;
+  throw std::bad_alloc();
+}
+
+__attribute__((noinline)) void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+__attribute__((noinline)) void operator delete(void* ptr, std::size_t)
+    noexcept {
+  std::free(ptr);
+}
+
+/*
+ * Data
+ */
+
+// Values are drawn to look like those of a populated deployment: ids and
+// timestamps are large (which matters to variable-length integers of the
+// compact protocol), and post texts are words with up to 200 characters.
+class DataGenerator {
+public:
+  DataGenerator() : _generator(42) {
+  }
+
+  TAccount account() {
+    static const char* first_names[] = {"Ana", "Bruno", "Carla", "Daniel",
+        "Emma", "Felipe", "Gabriela", "Henrique"};
+    static const char* last_names[] = {"Silva", "Santos", "Oliveira", "Souza",
+        "Rodrigues", "Ferreira", "Alves", "Pereira"};
+    TAccount account;
+    account.id = id();
+    account.created_at = created_at();
+    account.active = true;
+    account.username = "user" + std::to_string(account.id);
+    account.first_name = first_names[uniform(0, 7)];
+    account.last_name = last_names[uniform(0, 7)];
+    account.__set_follows_you(uniform(0, 1));
+    account.__set_followed_by_you(uniform(0, 1));
+    account.__set_n_followers(uniform(0, 5000));
+    account.__set_n_following(uniform(0, 500));
+    account.__set_n_posts(uniform(0, 1000));
+    account.__set_n_likes(uniform(0, 10000));
+    return account;
+  }
+
+  TPost post() {
+    TPost post;
+    post.id = id();
+    post.created_at = created_at();
+    post.active = true;
+    static const char* words[] = {"the", "a", "new", "post", "about", "my",
+        "day", "at", "work", "with", "friends", "and", "coffee", "today",
+        "this", "is", "great", "weekend", "photo", "city"};
+    auto length = uniform(1, 200);
+    while (int(post.text.size()) < length)
+      post.text += std::string(words[uniform(0, 19)]) + " ";
+    post.text.resize(length);
+    post.__set_author(account());
+    post.author_id = post.author.id;
+    post.__set_n_likes(uniform(0, 1000));
+    return post;
+  }
+
+  TLike like() {
+    TLike like;
+    like.id = id();
+    like.created_at = created_at();
+    like.account = account();
+    like.account_id = like.account.id;
+    like.post = post();
+    like.post_id = like.post.id;
+    return like;
+  }
+
+  TFollow follow() {
+    TFollow follow;
+    follow.id = id();
+    follow.created_at = created_at();
+    follow.__set_follower(account());
+    follow.follower_id = follow.follower.id;
+    follow.__set_followee(account());
+    follow.followee_id = follow.followee.id;
+    return follow;
+  }
+
+private:
+  int uniform(int min, int max) {
+    return std::uniform_int_distribution<int>(min, max)(_generator);
+  }
+
+  int id() {
+    return uniform(1, 10000000);
+  }
+
+  int created_at() {
+    return uniform(1577836800, 1609459200);
+  }
+
+  std::mt19937 _generator;
+};
+
+/*
+ * Benchmarks
+ */
+
+// The transport stack of a connection.
+struct Stack {
+  std::shared_ptr<TMemoryBuffer> memory;
+  std::shared_ptr<TTransport> transport;
+  std::shared_ptr<TProtocol> protocol;
+};
+
+Stack make_stack(const WireFormat& format) {
+  Stack stack;
+  stack.memory = std::make_shared<TMemoryBuffer>();
+  stack.transport = make_transport(format, stack.memory);
+  stack.protocol = make_protocol(format, stack.transport);
+  return stack;
+}
+
+// Write `items` as the result of an RPC, as generated processors do.
+template <typename T>
+void write_reply(const std::vector<T>& items, TProtocol* protocol) {
+  protocol->writeMessageBegin("list", T_REPLY, 0);
+  protocol->writeStructBegin("result");
+  protocol->writeFieldBegin("success", T_LIST, 0);
+  protocol->writeListBegin(T_STRUCT, items.size());
+  for (const auto& item : items)
+    item.write(protocol);
+  protocol->writeListEnd();
+  protocol->writeFieldEnd();
+  protocol->writeFieldStop();
+  protocol->writeStructEnd();
+  protocol->writeMessageEnd();
+  protocol->getTransport()->writeEnd();
+  protocol->getTransport()->flush();
+}
+
+// Read the result of an RPC into `items`, as generated clients do.
+template <typename T>
+void read_reply(TProtocol* protocol, std::vector<T>* items) {
+  std::string name;
+  TMessageType message_type;
+  int32_t seqid;
+  std::string field_name;
+  TType field_type;
+  int16_t field_id;
+  TType element_type;
+  uint32_t size;
+  protocol->readMessageBegin(name, message_type, seqid);
+  protocol->readStructBegin(name);
+  protocol->readFieldBegin(field_name, field_type, field_id);
+  protocol->readListBegin(element_type, size);
+  items->resize(size);
+  for (auto& item : *items)
+    item.read(protocol);
+  protocol->readListEnd();
+  protocol->readFieldEnd();
+  protocol->readFieldBegin(field_name, field_type, field_id);
+  protocol->readStructEnd();
+  protocol->readMessageEnd();
+  protocol->getTransport()->readEnd();
+}
+
+template <typename T>
+std::vector<T> make_items(T (DataGenerator::*make)(), int n) {
+  DataGenerator generator;
+  std::vector<T> items;
+  for (int i = 0; i < n; i++)
+    items.push_back((generator.*make)());
+  return items;
+}
+
+void set_counters(benchmark::State& state, int64_t allocations,
+    uint32_t bytes) {
+  state.counters["allocs"] = benchmark::Counter(allocations,
+      benchmark::Counter::kAvgIterations);
+  state.counters["bytes"] = bytes;
+  state.SetBytesProcessed(state.iterations() * bytes);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Write a reply in `stack`, returning its bytes.
+template <typename T>
+std::string encode_reply(const std::vector<T>& items, const Stack& stack) {
+  write_reply(items, stack.protocol.get());
+  auto reply = stack.memory->getBufferAsString();
+  stack.memory->resetBuffer();
+  return reply;
+}
+
+// Replies are measured on connections in use: buffers are warm, and
+// compressed streams are past their header.
+template <typename T>
+void encode(benchmark::State& state, T (DataGenerator::*make)(),
+    WireFormat format) {
+  auto items = make_items(make, state.range(0));
+  auto stack = make_stack(format);
+  encode_reply(items, stack);
+  uint32_t bytes = encode_reply(items, stack).size();
+  int64_t start_allocations = n_allocations.load();
+  for (auto _ : state) {
+    write_reply(items, stack.protocol.get());
+    stack.memory->resetBuffer();
+  }
+  set_counters(state, n_allocations.load() - start_allocations, bytes);
+}
+
+template <typename T>
+void decode(benchmark::State& state, T (DataGenerator::*make)(),
+    WireFormat format) {
+  auto items = make_items(make, state.range(0));
+  auto encoder = make_stack(format);
+  auto first_reply = encode_reply(items, encoder);
+  auto reply = encode_reply(items, encoder);
+  auto stack = make_stack(format);
+  stack.memory->resetBuffer((uint8_t*) &first_reply[0], first_reply.size());
+  read_reply(stack.protocol.get(), &items);
+  int64_t start_allocations = n_allocations.load();
+  for (auto _ : state) {
+    stack.memory->resetBuffer((uint8_t*) &reply[0], reply.size());
+    std::vector<T> decoded;
+    read_reply(stack.protocol.get(), &decoded);
+    benchmark::DoNotOptimize(decoded.data());
+  }
+  set_counters(state, n_allocations.load() - start_allocations, reply.size());
+}
+
+template <typename T>
+void register_benchmarks(const std::string& name,
+    T (DataGenerator::*make)()) {
+  for (bool zlib : {false, true}) {
+    for (bool framed : {false, true}) {
+      for (bool compact : {false, true}) {
+        WireFormat format;
+        format.compact = compact;
+        format.framed = framed;
+        format.zlib = zlib;
+        // List sizes: one item, a page of results, and a large page.
+        benchmark::RegisterBenchmark(
+            ("encode/" + name + "/" + format.name()).c_str(), encode<T>, make,
+            format)->Arg(1)->Arg(10)->Arg(100);
+        benchmark::RegisterBenchmark(
+            ("decode/" + name + "/" + format.name()).c_str(), decode<T>, make,
+            format)->Arg(1)->Arg(10)->Arg(100);
+      }
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  register_benchmarks("accounts", &DataGenerator::account);
+  register_benchmarks("posts", &DataGenerator::post);
+  register_benchmarks("likes", &DataGenerator::like);
+  register_benchmarks("follows", &DataGenerator::follow);
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    return 1;
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
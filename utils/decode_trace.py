@@ -0,0 +1,89 @@
+# Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
+# Systems
+
+"""Convert binary traces of RPC calls (see 'app/common/include/call_tracer.h')
+to the text format of '/tmp/calls.log'. Request ids are stored as their 64-bit
+FNV-1a hash, which is printed in hexadecimal instead of the request id
+(`--request_ids` maps hashes back to the request ids listed in a file).
+
+Usage: python3 utils/decode_trace.py [--request_ids FILE] TRACE_FILE...
+"""
+
+import argparse
+import datetime
+import struct
+import sys
+
+
+HEADER = struct.Struct("<8sII")
+BLOCK = struct.Struct("<II")
+STRING = struct.Struct("<BBHHH")
+CALL = struct.Struct("<BBHHHIIQQQ")
+VERSION = 2
+
+
+def fnv1a(s):
+  h = 14695981039346656037
+  for c in s.encode():
+    h = ((h ^ c) * 1099511628211) & 0xFFFFFFFFFFFFFFFF
+  return h
+
+
+def decode_block(data, offset, end, pid, request_ids, out):
+  strings = {1: {}, 2: {}}
+  while offset < end and data[offset] != 0:
+    if data[offset] == 2:
+      _, kind, id_, length, _ = STRING.unpack_from(data, offset)
+      offset += STRING.size
+      strings[kind][id_] = data[offset:offset + length].decode()
+      offset += (length + 7) & ~7
+    elif data[offset] == 1:
+      (_, _, function_id, server_id, _, tid, _, timestamp_ns, request_id_hash,
+          latency_ns) = CALL.unpack_from(data, offset)
+      offset += CALL.size
+      timestamp = datetime.datetime.fromtimestamp(timestamp_ns // 10**9)
+      out.write("[%s.%09d] pid=%d tid=%d request_id=%s server=%s function=%s "
+          "latency=%r\n" % (timestamp.strftime("%H:%M:%S"),
+          timestamp_ns % 10**9, pid, tid,
+          request_ids.get(request_id_hash, "%016x" % request_id_hash),
+          strings[2][server_id], strings[1][function_id], latency_ns / 1e9))
+    else:
+      raise ValueError("invalid entry type %d at offset %d" % (data[offset],
+          offset))
+
+
+def decode(data, request_ids, out):
+  magic, version, pid = HEADER.unpack_from(data, 0)
+  if magic != b"BBTRACE\0" or version != VERSION:
+    raise ValueError("not a trace file (version %d)" % VERSION)
+  offset = HEADER.size
+  while offset < len(data) and data[offset] != 0:
+    type_, size = BLOCK.unpack_from(data, offset)
+    if type_ & 0xFF != 3:
+      raise ValueError("invalid block type %d at offset %d" % (type_ & 0xFF,
+          offset))
+    decode_block(data, offset + BLOCK.size, offset + size, pid, request_ids,
+        out)
+    offset += size
+
+
+def main():
+  parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+  parser.add_argument("--request_ids",
+      help="file with one request id per line")
+  parser.add_argument("trace_files", nargs="+")
+  args = parser.parse_args()
+  request_ids = {}
+  if args.request_ids:
+    with open(args.request_ids) as request_ids_file:
+      for line in request_ids_file:
+        request_ids[fnv1a(line.strip())] = line.strip()
+  # Files are decoded in the order they were written.
+  for trace_file in sorted(args.trace_files,
+      key=lambda path: int(path.rsplit(".", 1)[-1])):
+    with open(trace_file, "rb") as f:
+      decode(f.read(), request_ids, sys.stdout)
+
+
+if __name__ == "__main__":
+  main()
@@ -0,0 +1,433 @@
+// Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
+// Systems
+
+#pragma once
+
+#include <cctype>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <strings.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <yaml-cpp/yaml.h>
+
+#include <buzzblog/account_client.h>
+#include <buzzblog/follow_client.h>
+#include <buzzblog/like_client.h>
+#include <buzzblog/post_client.h>
+#include <buzzblog/wire_format.h>
+
+
+// An account of the workload, on whose behalf operations are made.
+struct Account {
+  int id;
+  std::string username;
+  std::string password;
+};
+
+// Sends the operations of the workload to BuzzBlog. Each worker has its own
+// driver, and so its own connections. Operations throw if they fail; liking a
+// post or following an account twice is not a failure.
+class Driver {
+public:
+  virtual ~Driver() {
+  }
+
+  // Create an account, returning its id.
+  virtual int create_account(const std::string& username,
+      const std::string& password) = 0;
+  // Create a post, returning its id.
+  virtual int create_post(const Account& requester, const std::string& text) = 0;
+  virtual void view_profile(const Account& requester, int account_id) = 0;
+  virtual void list_posts(const Account& requester, int author_id,
+      int limit) = 0;
+  virtual void like(const Account& requester, int post_id) = 0;
+  virtual void follow(const Account& requester, int account_id) = 0;
+
+protected:
+  explicit Driver(int worker) : _worker(worker), _n_requests(0) {
+  }
+
+  std::string next_request_id() {
+    return "loadgen-" + std::to_string(_worker) + "-" +
+        std::to_string(_n_requests++);
+  }
+
+private:
+  const int _worker;
+  int64_t _n_requests;
+};
+
+// Calls the Thrift services directly, as the API Gateway does, bypassing it.
+// Servers are read from `backend.yml`; each worker talks to one server of each
+// service, spreading workers over servers.
+class ThriftDriver : public Driver {
+public:
+  ThriftDriver(int worker, const std::string& backend_filepath)
+  : Driver(worker) {
+    auto backend = YAML::LoadFile(backend_filepath);
+    _account = server(backend["account"], worker);
+    _follow = server(backend["follow"], worker);
+    _like = server(backend["like"], worker);
+    _post = server(backend["post"], worker);
+  }
+
+  int create_account(const std::string& username,
+      const std::string& password) override {
+    return call(&_account, &_account_client, [&](account_service::Client& c) {
+      return c.create_account(metadata(), username, password, "Load",
+          "Generator").id;
+    });
+  }
+
+  int create_post(const Account& requester, const std::string& text) override {
+    return call(&_post, &_post_client, [&](post_service::Client& c) {
+      return c.create_post(metadata(requester), text).id;
+    });
+  }
+
+  void view_profile(const Account& requester, int account_id) override {
+    call(&_account, &_account_client, [&](account_service::Client& c) {
+      return c.retrieve_expanded_account(metadata(requester), account_id).id;
+    });
+  }
+
+  void list_posts(const Account& requester, int author_id, int limit) override {
+    TPostQuery query;
+    query.__set_author_id(author_id);
+    call(&_post, &_post_client, [&](post_service::Client& c) {
+      return int(c.list_posts(metadata(requester), query, limit, 0).size());
+    });
+  }
+
+  void like(const Account& requester, int post_id) override {
+    call(&_like, &_like_client, [&](like_service::Client& c) {
+      try {
+        return c.like_post(metadata(requester), post_id).id;
+      }
+      catch (const TLikeAlreadyExistsException& e) {
+        return 0;
+      }
+    });
+  }
+
+  void follow(const Account& requester, int account_id) override {
+    call(&_follow, &_follow_client, [&](follow_service::Client& c) {
+      try {
+        return c.follow_account(metadata(requester), account_id).id;
+      }
+      catch (const TFollowAlreadyExistsException& e) {
+        return 0;
+      }
+    });
+  }
+
+private:
+  struct Server {
+    std::string host;
+    int port;
+    WireFormat wire_format;
+  };
+
+  static Server server(const YAML::Node& service, int worker) {
+    auto servers = service["service"];
+    auto address = servers[worker % servers.size()].as<std::string>();
+    auto wire_format = parse_wire_format(
+        service["server_mode"] ?
+            service["server_mode"].as<std::string>() : "nonblocking",
+        service["protocol"] ? service["protocol"].as<std::string>() : "binary",
+        service["transport"] ? service["transport"].as<std::string>() : "",
+        service["zlib"] && service["zlib"].as<bool>());
+    return Server{address.substr(0, address.find(":")),
+        std::stoi(address.substr(address.find(":") + 1)), wire_format};
+  }
+
+  // Make a call with the client of a service, connecting it first if needed.
+  // Clients whose connection broke are dropped, to reconnect on the next call.
+  template <typename TClient, typename F>
+  static int call(const Server* server, std::unique_ptr<TClient>* client,
+      F&& rpc) {
+    if (!*client)
+      *client = std::make_unique<TClient>(server->host, server->port, 10000,
+          server->wire_format);
+    try {
+      return rpc(**client);
+    }
+    catch (...) {
+      if (!(*client)->is_reusable())
+        client->reset();
+      throw;
+    }
+  }
+
+  TRequestMetadata metadata() {
+    TRequestMetadata request_metadata;
+    request_metadata.id = next_request_id();
+    return request_metadata;
+  }
+
+  TRequestMetadata metadata(const Account& requester) {
+    auto request_metadata = metadata();
+    request_metadata.__set_requester_id(requester.id);
+    return request_metadata;
+  }
+
+  Server _account;
+  Server _follow;
+  Server _like;
+  Server _post;
+  std::unique_ptr<account_service::Client> _account_client;
+  std::unique_ptr<follow_service::Client> _follow_client;
+  std::unique_ptr<like_service::Client> _like_client;
+  std::unique_ptr<post_service::Client> _post_client;
+};
+
+// Calls the BuzzBlog API over HTTP/1.1 (see 'docs/API.md'), through the load
+// balancer or an API Gateway server, with one keep-alive connection per worker.
+class HttpDriver : public Driver {
+public:
+  HttpDriver(int worker, const std::string& host, int port)
+  : Driver(worker),
+    _host(host),
+    _port(port),
+    _fd(-1) {
+  }
+
+  ~HttpDriver() {
+    disconnect();
+  }
+
+  int create_account(const std::string& username,
+      const std::string& password) override {
+    auto body = request("POST", "/account", nullptr,
+        "{\"username\": \"" + username + "\", \"password\": \"" + password +
+        "\", \"first_name\": \"Load\", \"last_name\": \"Generator\"}");
+    return json_id(body);
+  }
+
+  int create_post(const Account& requester, const std::string& text) override {
+    return json_id(request("POST", "/post", &requester,
+        "{\"text\": \"" + text + "\"}"));
+  }
+
+  void view_profile(const Account& requester, int account_id) override {
+    request("GET", "/account/" + std::to_string(account_id), &requester, "");
+  }
+
+  void list_posts(const Account& requester, int author_id, int limit) override {
+    request("GET", "/post", &requester,
+        "{\"limit\": " + std::to_string(limit) + ", \"offset\": 0}",
+        "&author_id=" + std::to_string(author_id));
+  }
+
+  void like(const Account& requester, int post_id) override {
+    request("POST", "/like", &requester,
+        "{\"post_id\": " + std::to_string(post_id) + "}", "", 400);
+  }
+
+  void follow(const Account& requester, int account_id) override {
+    request("POST", "/follow", &requester,
+        "{\"account_id\": " + std::to_string(account_id) + "}", "", 400);
+  }
+
+private:
+  // Send a request and return the body of its response, which must have
+  // status 200 (or `allowed_status`).
+  std::string request(const std::string& method, const std::string& path,
+      const Account* requester, const std::string& body,
+      const std::string& params = "", int allowed_status = 200) {
+    std::string message = method + " " + path + "?request_id=" +
+        next_request_id() + params + " HTTP/1.1\r\nHost: " + _host +
+        "\r\nContent-Type: application/json\r\nContent-Length: " +
+        std::to_string(body.size()) + "\r\n";
+    if (requester)
+      message += "Authorization: Basic " + base64(requester->username + ":" +
+          requester->password) + "\r\n";
+    message += "\r\n" + body;
+    if (_fd < 0)
+      connect();
+    try {
+      send_all(message);
+      int status;
+      std::string response;
+      bool keep_alive = read_response(&status, &response);
+      if (!keep_alive)
+        disconnect();
+      if (status != 200 && status != allowed_status)
+        throw std::runtime_error("HTTP " + std::to_string(status) + ": " +
+            method + " " + path);
+      return response;
+    }
+    catch (const std::system_error& e) {
+      disconnect();
+      throw;
+    }
+  }
+
+  void connect() {
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* addresses;
+    if (getaddrinfo(_host.c_str(), std::to_string(_port).c_str(), &hints,
+        &addresses) != 0)
+      throw std::runtime_error("Could not resolve " + _host);
+    for (auto address = addresses; address; address = address->ai_next) {
+      _fd = socket(address->ai_family, address->ai_socktype,
+          address->ai_protocol);
+      if (_fd < 0)
+        continue;
+      if (::connect(_fd, address->ai_addr, address->ai_addrlen) == 0)
+        break;
+      close(_fd);
+      _fd = -1;
+    }
+    freeaddrinfo(addresses);
+    if (_fd < 0)
+      throw std::system_error(errno, std::generic_category(),
+          "Could not connect to " + _host);
+    int one = 1;
+    setsockopt(_fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    _buffer.clear();
+  }
+
+  void disconnect() {
+    if (_fd >= 0)
+      close(_fd);
+    _fd = -1;
+  }
+
+  void send_all(const std::string& data) {
+    for (size_t sent = 0; sent < data.size(); ) {
+      auto n = ::send(_fd, data.data() + sent, data.size() - sent,
+          MSG_NOSIGNAL);
+      if (n <= 0)
+        throw std::system_error(errno, std::generic_category(), "send");
+      sent += n;
+    }
+  }
+
+  // Read more of the response into the buffer.
+  void receive() {
+    char chunk[16384];
+    auto n = ::recv(_fd, chunk, sizeof(chunk), 0);
+    if (n <= 0)
+      throw std::system_error(n ? errno : ECONNRESET, std::generic_category(),
+          "recv");
+    _buffer.append(chunk, n);
+  }
+
+  // Take `n` bytes from the buffer, reading them first if needed.
+  std::string take(size_t n) {
+    while (_buffer.size() < n)
+      receive();
+    auto data = _buffer.substr(0, n);
+    _buffer.erase(0, n);
+    return data;
+  }
+
+  std::string take_line() {
+    size_t end;
+    while ((end = _buffer.find("\r\n")) == std::string::npos)
+      receive();
+    auto line = _buffer.substr(0, end);
+    _buffer.erase(0, end + 2);
+    return line;
+  }
+
+  // Read a response, with a body of known length or in chunks. Returns whether
+  // the connection may be reused.
+  bool read_response(int* status, std::string* body) {
+    auto status_line = take_line();
+    *status = std::atoi(status_line.c_str() + status_line.find(' ') + 1);
+    bool keep_alive = status_line.compare(0, 8, "HTTP/1.0") != 0;
+    bool chunked = false;
+    long length = -1;
+    for (auto line = take_line(); !line.empty(); line = take_line()) {
+      auto colon = line.find(':');
+      auto name = line.substr(0, colon);
+      for (auto& c : name)
+        c = tolower(c);
+      auto value = line.substr(colon + 1);
+      value.erase(0, value.find_first_not_of(' '));
+      if (name == "content-length")
+        length = std::atol(value.c_str());
+      else if (name == "transfer-encoding" &&
+          value.find("chunked") != std::string::npos)
+        chunked = true;
+      else if (name == "connection")
+        keep_alive = strncasecmp(value.c_str(), "close", 5) != 0;
+    }
+    body->clear();
+    if (chunked) {
+      long size;
+      while ((size = std::strtol(take_line().c_str(), nullptr, 16)) > 0) {
+        *body += take(size);
+        take_line();
+      }
+      while (!take_line().empty()) {
+      }
+    }
+    else if (length >= 0) {
+      *body = take(length);
+    }
+    else {
+      // The body ends with the connection.
+      try {
+        while (true)
+          receive();
+      }
+      catch (const std::system_error& e) {
+      }
+      *body = std::move(_buffer);
+      _buffer.clear();
+      keep_alive = false;
+    }
+    return keep_alive;
+  }
+
+  // The "id" of the JSON object returned.
+  static int json_id(const std::string& body) {
+    auto key = body.find("\"id\"");
+    if (key == std::string::npos)
+      throw std::runtime_error("No id in response: " + body);
+    auto colon = body.find(':', key);
+    return std::atoi(body.c_str() + colon + 1);
+  }
+
+  static std::string base64(const std::string& data) {
+    static const char digits[] =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string encoded;
+    for (size_t i = 0; i < data.size(); i += 3) {
+      uint32_t n = uint8_t(data[i]) << 16;
+      if (i + 1 < data.size())
+        n |= uint8_t(data[i + 1]) << 8;
+      if (i + 2 < data.size())
+        n |= uint8_t(data[i + 2]);
+      encoded += digits[(n >> 18) & 63];
+      encoded += digits[(n >> 12) & 63];
+      encoded += i + 1 < data.size() ? digits[(n >> 6) & 63] : '=';
+      encoded += i + 2 < data.size() ? digits[n & 63] : '=';
+    }
+    return encoded;
+  }
+
+  const std::string _host;
+  const int _port;
+  int _fd;
+  std::string _buffer;
+};
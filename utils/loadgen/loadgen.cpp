@@ -0,0 +1,270 @@
+// Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
+// Systems
+
+// Load generator of BuzzBlog. It creates a population of accounts with posts,
+// then sends them a mix of operations for a given duration and reports the
+// throughput and latency percentiles of each operation. Targets are either the
+// BuzzBlog API over HTTP or the Thrift services directly. See 'docs/MANUAL.md'.
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cxxopts.hpp>
+
+#include "drivers.h"
+#include "workload.h"
+
+
+struct Config {
+  std::string target;
+  std::string backend_filepath;
+  std::string gateway_host;
+  int gateway_port;
+  std::string mode;
+  int workers;
+  double rate;
+  double think_time_ms;
+  int duration_s;
+  int warmup_s;
+  int n_accounts;
+  int posts_per_account;
+  double zipf;
+  std::string mix;
+  unsigned seed;
+};
+
+// The population of the workload. Accounts are ranked by popularity: the
+// target of an operation is drawn by a Zipf distribution over ranks, while
+// requesters are drawn uniformly.
+struct Population {
+  std::vector<Account> accounts;
+  std::vector<std::vector<int>> posts;      // ids of the posts of each account.
+  std::mutex mutex;                         // guards `posts` while running.
+};
+
+std::unique_ptr<Driver> make_driver(const Config& config, int worker) {
+  if (config.target == "thrift")
+    return std::make_unique<ThriftDriver>(worker, config.backend_filepath);
+  if (config.target == "http")
+    return std::make_unique<HttpDriver>(worker, config.gateway_host,
+        config.gateway_port);
+  throw std::invalid_argument("Invalid target: " + config.target);
+}
+
+// Create the accounts and posts of the population, split across workers.
+void populate(const Config& config,
+    std::vector<std::unique_ptr<Driver>>& drivers, Population* population) {
+  auto run_id = std::to_string(std::time(nullptr));
+  population->accounts.resize(config.n_accounts);
+  population->posts.resize(config.n_accounts);
+  std::vector<std::thread> threads;
+  for (int w = 0; w < config.workers; w++) {
+    threads.emplace_back([&, w] {
+      auto& driver = *drivers[w];
+      for (int i = w; i < config.n_accounts; i += config.workers) {
+        auto& account = population->accounts[i];
+        account.username = "lg" + run_id + "_" + std::to_string(i);
+        account.password = "loadgen";
+        account.id = driver.create_account(account.username, account.password);
+        for (int j = 0; j < config.posts_per_account; j++)
+          population->posts[i].push_back(driver.create_post(account,
+              "Post " + std::to_string(j) + " of " + account.username));
+      }
+    });
+  }
+  for (auto& thread : threads)
+    thread.join();
+}
+
+// Make one operation, chosen from the mix.
+void run_operation(Operation operation, Driver& driver,
+    Population* population, const ZipfSampler& popularity,
+    std::mt19937_64& generator) {
+  auto& accounts = population->accounts;
+  auto& requester = accounts[std::uniform_int_distribution<int>(0,
+      accounts.size() - 1)(generator)];
+  int target = popularity(generator);
+  switch (operation) {
+    case VIEW_PROFILE:
+      driver.view_profile(requester, accounts[target].id);
+      break;
+    case LIST_POSTS:
+      driver.list_posts(requester, accounts[target].id, 10);
+      break;
+    case LIKE: {
+      int post_id;
+      {
+        std::lock_guard<std::mutex> lock(population->mutex);
+        auto& posts = population->posts[target];
+        if (posts.empty())
+          return;
+        post_id = posts[std::uniform_int_distribution<int>(0,
+            posts.size() - 1)(generator)];
+      }
+      driver.like(requester, post_id);
+      break;
+    }
+    case FOLLOW:
+      driver.follow(requester, accounts[target].id);
+      break;
+    case CREATE_POST: {
+      int requester_index = &requester - &accounts[0];
+      int post_id = driver.create_post(requester, "Hello from the load "
+          "generator");
+      std::lock_guard<std::mutex> lock(population->mutex);
+      population->posts[requester_index].push_back(post_id);
+      break;
+    }
+    default:
+      break;
+  }
+}
+
+// Run one worker from `start` to `end`, recording operations that start after
+// `record_from`.
+//
+// In the closed loop, a worker sends its next operation when the previous one
+// returns (after an optional think time), so load adapts to the system. In the
+// open loop, operations arrive as a Poisson process of rate `rate / workers`,
+// regardless of how long earlier ones take, and latency is measured from when
+// each operation was due: a stalled server delays every operation due during
+// the stall, which is then counted rather than omitted.
+void run_worker(const Config& config, int worker, Driver& driver,
+    Population* population, const ZipfSampler& popularity,
+    std::chrono::steady_clock::time_point record_from,
+    std::chrono::steady_clock::time_point end, LatencyRecorder* recorder) {
+  std::mt19937_64 generator(config.seed + worker);
+  OperationMix mix(config.mix);
+  bool open_loop = config.mode == "open";
+  // Times between operations, in ns.
+  std::exponential_distribution<double> interarrival(open_loop ?
+      config.rate / config.workers / 1e9 :
+      config.think_time_ms > 0 ? 1 / (config.think_time_ms * 1e6) : 1);
+  auto due = std::chrono::steady_clock::now();
+  while (true) {
+    if (open_loop) {
+      due += std::chrono::nanoseconds(int64_t(interarrival(generator)));
+      std::this_thread::sleep_until(due);
+    }
+    else {
+      if (config.think_time_ms > 0)
+        std::this_thread::sleep_for(std::chrono::nanoseconds(
+            int64_t(interarrival(generator))));
+      due = std::chrono::steady_clock::now();
+    }
+    if (due >= end)
+      return;
+    auto operation = mix(generator);
+    try {
+      run_operation(operation, driver, population, popularity, generator);
+      if (due >= record_from)
+        recorder->record(operation, std::chrono::steady_clock::now() - due);
+    }
+    catch (const std::exception& e) {
+      if (due >= record_from)
+        recorder->record_error(operation);
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  // Define command-line parameters.
+  cxxopts::Options options("loadgen", "BuzzBlog load generator");
+  options.add_options()
+      ("target", "\"http\" or \"thrift\"",
+          cxxopts::value<std::string>()->default_value("http"))
+      ("backend_filepath", "Thrift servers (thrift target)",
+          cxxopts::value<std::string>()->default_value("conf/backend.yml"))
+      ("gateway", "API host:port (http target)",
+          cxxopts::value<std::string>()->default_value("localhost:8888"))
+      ("mode", "\"closed\" or \"open\" loop",
+          cxxopts::value<std::string>()->default_value("closed"))
+      ("workers", "Concurrent workers (connections)",
+          cxxopts::value<int>()->default_value("16"))
+      ("rate", "Requests per second (open loop)",
+          cxxopts::value<double>()->default_value("100"))
+      ("think_time_ms", "Mean think time (closed loop)",
+          cxxopts::value<double>()->default_value("0"))
+      ("duration_s", "", cxxopts::value<int>()->default_value("60"))
+      ("warmup_s", "Initial seconds not reported",
+          cxxopts::value<int>()->default_value("10"))
+      ("accounts", "", cxxopts::value<int>()->default_value("1000"))
+      ("posts_per_account", "", cxxopts::value<int>()->default_value("5"))
+      ("zipf", "Skew of account popularity (0: uniform)",
+          cxxopts::value<double>()->default_value("1.0"))
+      ("mix", "Weights of operations",
+          cxxopts::value<std::string>()->default_value("view_profile=40,"
+              "list_posts=30,like=15,follow=10,create_post=5"))
+      ("seed", "", cxxopts::value<unsigned>()->default_value("1"))
+      ("help", "Print help");
+
+  // Parse command-line arguments.
+  auto result = options.parse(argc, argv);
+  if (result.count("help")) {
+    std::cout << options.help() << std::endl;
+    return 0;
+  }
+  Config config;
+  config.target = result["target"].as<std::string>();
+  config.backend_filepath = result["backend_filepath"].as<std::string>();
+  auto gateway = result["gateway"].as<std::string>();
+  config.gateway_host = gateway.substr(0, gateway.find(":"));
+  config.gateway_port = std::stoi(gateway.substr(gateway.find(":") + 1));
+  config.mode = result["mode"].as<std::string>();
+  config.workers = result["workers"].as<int>();
+  config.rate = result["rate"].as<double>();
+  config.think_time_ms = result["think_time_ms"].as<double>();
+  config.duration_s = result["duration_s"].as<int>();
+  config.warmup_s = result["warmup_s"].as<int>();
+  config.n_accounts = result["accounts"].as<int>();
+  config.posts_per_account = result["posts_per_account"].as<int>();
+  config.zipf = result["zipf"].as<double>();
+  config.mix = result["mix"].as<std::string>();
+  config.seed = result["seed"].as<unsigned>();
+  if (config.mode != "closed" && config.mode != "open")
+    throw std::invalid_argument("Invalid mode: " + config.mode);
+  OperationMix check_mix(config.mix);
+
+  std::vector<std::unique_ptr<Driver>> drivers;
+  for (int w = 0; w < config.workers; w++)
+    drivers.push_back(make_driver(config, w));
+
+  // Create the population.
+  std::cerr << "Creating " << config.n_accounts << " accounts..." << std::endl;
+  Population population;
+  populate(config, drivers, &population);
+  ZipfSampler popularity(config.n_accounts, config.zipf);
+
+  // Run workers.
+  std::cerr << "Running for " << config.duration_s << " s (" << config.mode <<
+      " loop)..." << std::endl;
+  auto start = std::chrono::steady_clock::now();
+  auto record_from = start + std::chrono::seconds(config.warmup_s);
+  auto end = start + std::chrono::seconds(config.duration_s);
+  std::vector<LatencyRecorder> recorders(config.workers);
+  std::vector<std::thread> threads;
+  for (int w = 0; w < config.workers; w++)
+    threads.emplace_back([&, w] {
+      run_worker(config, w, *drivers[w], &population, popularity, record_from,
+          end, &recorders[w]);
+    });
+  for (auto& thread : threads)
+    thread.join();
+
+  // Report.
+  LatencyRecorder total;
+  for (const auto& recorder : recorders)
+    total.merge(recorder);
+  total.report(std::chrono::duration<double>(end - record_from), stdout);
+  return 0;
+}
@@ -0,0 +1,159 @@
+// Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
+// Systems
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+
+// Operations of the workload, as a user of the application performs them.
+enum Operation {
+  VIEW_PROFILE,       // retrieve an account (expanded mode).
+  LIST_POSTS,         // list the posts of an account.
+  LIKE,               // like a post.
+  FOLLOW,             // follow an account.
+  CREATE_POST,        // write a post.
+  N_OPERATIONS
+};
+
+inline const char* operation_name(int operation) {
+  static const char* names[] = {"view_profile", "list_posts", "like", "follow",
+      "create_post"};
+  return names[operation];
+}
+
+// Samples ranks 0..n-1 with probability proportional to 1 / (rank + 1)^s, so
+// that a few accounts draw most of the traffic, as on social networks. s = 0
+// is uniform.
+class ZipfSampler {
+public:
+  ZipfSampler(int n, double s) : _cdf(n) {
+    double sum = 0;
+    for (int i = 0; i < n; i++)
+      _cdf[i] = sum += 1.0 / std::pow(i + 1, s);
+    for (auto& p : _cdf)
+      p /= sum;
+  }
+
+  template <typename Generator>
+  int operator()(Generator& generator) const {
+    double u = std::uniform_real_distribution<double>(0, 1)(generator);
+    return std::min(int(_cdf.size()) - 1, int(std::lower_bound(_cdf.begin(),
+        _cdf.end(), u) - _cdf.begin()));
+  }
+
+private:
+  std::vector<double> _cdf;
+};
+
+// Chooses operations by weight, parsed from e.g.
+// "view_profile=40,list_posts=30,like=15,follow=10,create_post=5".
+class OperationMix {
+public:
+  explicit OperationMix(const std::string& spec)
+  : _weights(N_OPERATIONS, 0) {
+    std::istringstream in(spec);
+    std::string item;
+    while (std::getline(in, item, ',')) {
+      auto eq = item.find('=');
+      int operation = find(item.substr(0, eq));
+      if (eq == std::string::npos || operation < 0)
+        throw std::invalid_argument("Invalid operation mix: " + spec);
+      _weights[operation] = std::stod(item.substr(eq + 1));
+    }
+    _distribution = std::discrete_distribution<int>(_weights.begin(),
+        _weights.end());
+  }
+
+  template <typename Generator>
+  Operation operator()(Generator& generator) {
+    return Operation(_distribution(generator));
+  }
+
+private:
+  static int find(const std::string& name) {
+    for (int i = 0; i < N_OPERATIONS; i++)
+      if (name == operation_name(i))
+        return i;
+    return -1;
+  }
+
+  std::vector<double> _weights;
+  std::discrete_distribution<int> _distribution;
+};
+
+// Latencies of the operations a worker made, by operation. Latencies are kept
+// exactly, so that percentiles do not depend on a histogram's resolution.
+class LatencyRecorder {
+public:
+  LatencyRecorder() : _latencies(N_OPERATIONS), _errors(N_OPERATIONS, 0) {
+  }
+
+  void record(Operation operation, std::chrono::nanoseconds latency) {
+    _latencies[operation].push_back(latency.count());
+  }
+
+  void record_error(Operation operation) {
+    _errors[operation]++;
+  }
+
+  void merge(const LatencyRecorder& other) {
+    for (int i = 0; i < N_OPERATIONS; i++) {
+      _latencies[i].insert(_latencies[i].end(), other._latencies[i].begin(),
+          other._latencies[i].end());
+      _errors[i] += other._errors[i];
+    }
+  }
+
+  // Print throughput and latency percentiles (in ms) of every operation and of
+  // all of them, over `duration`.
+  void report(std::chrono::duration<double> duration, FILE* out) {
+    fprintf(out, "%-14s %9s %7s %9s %8s %8s %8s %8s %8s %8s\n", "operation",
+        "requests", "errors", "req/s", "mean", "p50", "p90", "p99", "p99.9",
+        "max");
+    std::vector<int64_t> all;
+    int64_t all_errors = 0;
+    for (int i = 0; i < N_OPERATIONS; i++) {
+      if (_latencies[i].empty() && !_errors[i])
+        continue;
+      print(out, operation_name(i), &_latencies[i], _errors[i], duration);
+      all.insert(all.end(), _latencies[i].begin(), _latencies[i].end());
+      all_errors += _errors[i];
+    }
+    print(out, "total", &all, all_errors, duration);
+  }
+
+private:
+  static void print(FILE* out, const char* name, std::vector<int64_t>* samples,
+      int64_t errors, std::chrono::duration<double> duration) {
+    std::sort(samples->begin(), samples->end());
+    double sum = 0;
+    for (auto sample : *samples)
+      sum += sample;
+    auto percentile = [samples](double p) {
+      if (samples->empty())
+        return 0.0;
+      // Nearest-rank percentile.
+      long n = samples->size();
+      long i = std::max(0L, std::min(n - 1, long(std::ceil(p / 100 * n)) - 1));
+      return (*samples)[i] / 1e6;
+    };
+    fprintf(out, "%-14s %9zu %7ld %9.1f %8.2f %8.2f %8.2f %8.2f %8.2f %8.2f\n",
+        name, samples->size(), long(errors),
+        samples->size() / duration.count(),
+        samples->empty() ? 0.0 : sum / samples->size() / 1e6, percentile(50),
+        percentile(90), percentile(99), percentile(99.9), percentile(100));
+  }
+
+  std::vector<std::vector<int64_t>> _latencies;
+  std::vector<int64_t> _errors;
+};
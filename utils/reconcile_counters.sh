@@ -0,0 +1,42 @@
+#!/bin/bash
+
+# Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
+# Systems
+
+# This script repairs drift of the counters kept by the post and uniquepair
+# databases (tables 'PostCounts' and 'UniquepairCounts'), recomputing them from
+# the tables they count. It blocks writes to those tables while it runs, so
+# schedule it (e.g., with cron) when load is low. It also backfills counters of
+# databases whose tables were populated before the counters were created.
+
+# Process command-line arguments.
+set -u
+POSTGRES_USER="postgres"
+POST_DATABASE="localhost:5434"
+UNIQUEPAIR_DATABASE="localhost:5435"
+while [[ $# > 1 ]]; do
+  case $1 in
+    --postgres_user )
+      POSTGRES_USER=$2
+      ;;
+    --post_database )
+      POST_DATABASE=$2
+      ;;
+    --uniquepair_database )
+      UNIQUEPAIR_DATABASE=$2
+      ;;
+    * )
+      echo "Invalid argument: $1"
+      exit 1
+  esac
+  shift
+  shift
+done
+
+# Reconcile counters.
+echo "Post counters repaired: $(psql -U $POSTGRES_USER \
+    -h ${POST_DATABASE%:*} -p ${POST_DATABASE#*:} -tA \
+    -c "SELECT reconcile_post_counts()")"
+echo "Uniquepair counters repaired: $(psql -U $POSTGRES_USER \
+    -h ${UNIQUEPAIR_DATABASE%:*} -p ${UNIQUEPAIR_DATABASE#*:} -tA \
+    -c "SELECT reconcile_uniquepair_counts()")"
@@ -0,0 +1,111 @@
+#!/bin/bash
+
+# Copyright (C) 2020 Georgia Tech Center for Experimental Research in Computer
+# Systems
+
+# This script runs the backend services in your local machine without Docker,
+# so that the load generator can measure them (see 'docs/MANUAL.md'). Servers
+# are those built by the CMake project in the build directory, and databases
+# are PostgreSQL clusters created in the work directory, on the ports of the
+# standard configuration ('conf/backend.yml'). Run it as a user other than root,
+# which PostgreSQL refuses to run as. Stop everything with '--action stop'.
+
+# Define constants.
+SERVICES="account:9090 follow:9091 like:9092 post:9093 uniquepair:9094"
+DATABASES="account:5433 post:5434 uniquepair:5435"
+
+# Change to the parent directory.
+cd "$(dirname "$(dirname "$(readlink -fm "$0")")")"
+
+# Process command-line arguments.
+set -u
+ACTION="start"
+BUILD_DIR="build"
+WORK_DIR="/tmp/buzzblog"
+THREADS=32
+PG_BIN="$(ls -d /usr/lib/postgresql/*/bin 2> /dev/null | tail -n 1)"
+while [[ $# > 1 ]]; do
+  case $1 in
+    --action )
+      ACTION=$2
+      ;;
+    --build_dir )
+      BUILD_DIR=$2
+      ;;
+    --work_dir )
+      WORK_DIR=$2
+      ;;
+    --threads )
+      THREADS=$2
+      ;;
+    --pg_bin )
+      PG_BIN=$2
+      ;;
+    * )
+      echo "Invalid argument: $1"
+      exit 1
+  esac
+  shift
+  shift
+done
+if [[ -n "$PG_BIN" ]]; then
+  export PATH="$PG_BIN:$PATH"
+fi
+
+if [[ "$ACTION" == "stop" ]]; then
+  # Stop servers, which write their profiles if built for PGO.
+  for service_port in $SERVICES; do
+    service=${service_port%:*}
+    if [[ -f $WORK_DIR/$service.pid ]]; then
+      kill $(cat $WORK_DIR/$service.pid) 2> /dev/null
+      rm $WORK_DIR/$service.pid
+    fi
+  done
+  # Stop databases.
+  for database_port in $DATABASES; do
+    database=${database_port%:*}
+    pg_ctl -D $WORK_DIR/pg_$database stop -m fast
+  done
+  exit 0
+elif [[ "$ACTION" != "start" ]]; then
+  echo "Invalid action: $ACTION"
+  exit 1
+fi
+
+# Point the configuration to this machine.
+mkdir -p $WORK_DIR/logs
+sed "s/172\.17\.0\.1/127.0.0.1/g" conf/backend.yml > $WORK_DIR/backend.yml
+
+# Start databases, creating them and their tables on the first run.
+for database_port in $DATABASES; do
+  database=${database_port%:*}
+  port=${database_port#*:}
+  new_database=false
+  if [[ ! -d $WORK_DIR/pg_$database ]]; then
+    initdb -D $WORK_DIR/pg_$database -U postgres --auth=trust > /dev/null
+    new_database=true
+  fi
+  pg_ctl -D $WORK_DIR/pg_$database -l $WORK_DIR/logs/pg_$database.log -w \
+      -o "-p $port -k $WORK_DIR -c max_connections=128" start
+  if [[ "$new_database" == true ]]; then
+    psql -U postgres -h localhost -p $port -q \
+        -f app/$database/database/${database}_schema.sql
+  fi
+done
+
+# Start servers.
+for service_port in $SERVICES; do
+  service=${service_port%:*}
+  port=${service_port#*:}
+  $BUILD_DIR/${service}_server \
+      --host 127.0.0.1 \
+      --port $port \
+      --threads $THREADS \
+      --backend_filepath $WORK_DIR/backend.yml \
+      --postgres_user postgres \
+      --postgres_password postgres \
+      --postgres_dbname postgres \
+      > $WORK_DIR/logs/$service.log 2>&1 &
+  echo $! > $WORK_DIR/$service.pid
+done
+echo "Backend services started. Configuration: $WORK_DIR/backend.yml"